@@ -1,10 +1,20 @@
+#include "MACE/AlignCDC/AlignCDC.h++"
+#include "MACE/AnaMACE/AnaMACE.h++"
+#include "MACE/AnaTargetYield/AnaTargetYield.h++"
+#include "MACE/BenchAcceleratorField/BenchAcceleratorField.h++"
+#include "MACE/CompareGenerator/CompareGenerator.h++"
+#include "MACE/DigiMACE/DigiMACE.h++"
 #include "MACE/GenM2ENNE/GenM2ENNE.h++"
 #include "MACE/GenM2ENNEE/GenM2ENNEE.h++"
 #include "MACE/GenM2ENNGG/GenM2ENNGG.h++"
 #include "MACE/MakeGeometry/MakeGeometry.h++"
+#include "MACE/MixMACE/MixMACE.h++"
 #include "MACE/PhaseI/PhaseI.h++"
 #include "MACE/ReconECAL/ReconECAL.h++"
+#include "MACE/ReconMCP/ReconMCP.h++"
 #include "MACE/ReconMMSTrack/ReconMMSTrack.h++"
+#include "MACE/ReconQA/ReconQA.h++"
+#include "MACE/ReconTTC/ReconTTC.h++"
 #include "MACE/SimDose/SimDose.h++"
 #include "MACE/SimECAL/SimECAL.h++"
 #include "MACE/SimMACE/SimMACE.h++"
@@ -18,13 +28,23 @@
 
 auto main(int argc, char* argv[]) -> int {
     Mustard::Application::SubprogramLauncher launcher;
+    launcher.AddSubprogram<MACE::AlignCDC::AlignCDC>();
+    launcher.AddSubprogram<MACE::AnaMACE::AnaMACE>();
+    launcher.AddSubprogram<MACE::AnaTargetYield::AnaTargetYield>();
+    launcher.AddSubprogram<MACE::BenchAcceleratorField::BenchAcceleratorField>();
+    launcher.AddSubprogram<MACE::CompareGenerator::CompareGenerator>();
+    launcher.AddSubprogram<MACE::DigiMACE::DigiMACE>();
     launcher.AddSubprogram<MACE::GenM2ENNE::GenM2ENNE>();
     launcher.AddSubprogram<MACE::GenM2ENNEE::GenM2ENNEE>();
     launcher.AddSubprogram<MACE::GenM2ENNGG::GenM2ENNGG>();
     launcher.AddSubprogram<MACE::MakeGeometry::MakeGeometry>();
+    launcher.AddSubprogram<MACE::MixMACE::MixMACE>();
     launcher.AddSubprogram<MACE::PhaseI::PhaseI>();
     launcher.AddSubprogram<MACE::ReconECAL::ReconECAL>();
+    launcher.AddSubprogram<MACE::ReconMCP::ReconMCP>();
     launcher.AddSubprogram<MACE::ReconMMSTrack::ReconMMSTrack>();
+    launcher.AddSubprogram<MACE::ReconQA::ReconQA>();
+    launcher.AddSubprogram<MACE::ReconTTC::ReconTTC>();
     launcher.AddSubprogram<MACE::SimDose::SimDose>();
     launcher.AddSubprogram<MACE::SimECAL::SimECAL>();
     launcher.AddSubprogram<MACE::SimMACE::SimMACE>();
@@ -1,5 +1,122 @@
-// #include "MACE/Analysis/DCACalculator.h++"
-#include "Mustard/Env/BasicEnv.h++"
+#include "MACE/AnaMACE/AnaMACE.h++"
+#include "MACE/AnaMACE/CLI.h++"
+#include "MACE/Analysis/EventJoiner.h++"
+#include "MACE/Analysis/SignalSelection.h++"
 
-int main(int /* argc */, char* /* argv */[]) {
+#include "Mustard/Data/Output.h++"
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/Value.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Parallel/ProcessSpecificPath.h++"
+#include "Mustard/ROOTX/MakeTextTMacro.h++"
+
+#include "TFile.h"
+
+#include "mplr/mplr.hpp"
+
+#include "muc/array"
+
+#include "gsl/gsl"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/format.h"
+
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace MACE::AnaMACE {
+
+namespace {
+
+using SignalCandidate = Mustard::Data::TupleModel<
+    Mustard::Data::Value<int, "EvtID", "Event ID">,
+    Mustard::Data::Value<int, "TrkID", "Track ID">,
+    Mustard::Data::Value<float, "w", "Event weight">,
+    Mustard::Data::Value<int, "NPassed", "Number of cuts passed (after 'All')">,
+    Mustard::Data::Value<muc::array3f, "x", "Vertex position on target plane">,
+    Mustard::Data::Value<muc::array3f, "p", "Momentum at vertex">,
+    Mustard::Data::Value<double, "t", "Vertex time">,
+    Mustard::Data::Value<float, "DCA", "Vertex distance to target">,
+    Mustard::Data::Value<float, "MCPdt", "MCP hit time after vertex">,
+    Mustard::Data::Value<float, "MCPdr", "MCP hit distance to expected position">,
+    Mustard::Data::Value<float, "ECALEsum", "Gamma pair total energy">,
+    Mustard::Data::Value<float, "ECALcos", "Gamma pair opening angle cosine">,
+    Mustard::Data::Value<float, "ECALdt", "Gamma pair time difference">>;
+
+} // namespace
+
+AnaMACE::AnaMACE() :
+    Subprogram{"AnaMACE", "Antimuonium signal analysis on reconstructed MMS tracks, MCP hits and ECAL clusters."} {}
+
+auto AnaMACE::Main(int argc, char* argv[]) const -> int {
+    CLI cli;
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+
+    Analysis::SignalSelection selection;
+    cli.ImportSelection(selection);
+    YAML::Node config;
+    selection.Export(config);
+
+    const auto outputPath{Mustard::Parallel::ProcessSpecificPath(cli.OutputFilePath()).replace_extension(".root").generic_string()};
+    TFile file{outputPath.c_str(), cli.OutputFileMode().c_str(), "", ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose};
+    if (not file.IsOpen()) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Cannot open file '{}' with mode '{}'", outputPath, cli.OutputFileMode()));
+    }
+
+    const auto [iFirst, iLast]{cli.DatasetIndexRange()};
+    const auto TreeName{[](const std::string& nameFormat, gsl::index i) { return fmt::vformat(nameFormat, fmt::make_format_args(i)); }};
+    for (auto i{iFirst}; i < iLast; ++i) {
+        const Analysis::EventJoiner joiner{cli.InputFilePath(),
+                                           {.track = TreeName(cli.TrackNameFormat(), i),
+                                            .trackState = TreeName(cli.TrackStateNameFormat(), i),
+                                            .mcpHit = TreeName(cli.MCPHitNameFormat(), i),
+                                            .ecalCluster = TreeName(cli.ECALClusterNameFormat(), i),
+                                            .weight = TreeName(cli.WeightNameFormat(), i)}};
+        Mustard::Data::Output<SignalCandidate> output{TreeName(cli.CandidateNameFormat(), i)};
+        joiner.Join([&](const Analysis::JoinedEvent& event) {
+            const auto candidate{selection(event)};
+            if (not candidate or candidate->nPassed <= 1) {
+                return;
+            }
+            constexpr auto nan{std::numeric_limits<float>::quiet_NaN()};
+            Mustard::Data::Tuple<SignalCandidate> tuple;
+            Get<"EvtID">(tuple) = candidate->evtID;
+            Get<"TrkID">(tuple) = candidate->trkID;
+            Get<"w">(tuple) = candidate->weight;
+            Get<"NPassed">(tuple) = candidate->nPassed;
+            const auto& vertex{candidate->vertex};
+            Get<"x">(tuple) = vertex ? vertex->x : muc::array3d{nan, nan, nan};
+            Get<"p">(tuple) = vertex ? vertex->p : muc::array3d{nan, nan, nan};
+            Get<"t">(tuple) = vertex ? vertex->t : nan;
+            Get<"DCA">(tuple) = vertex ? vertex->dca : nan;
+            const auto& mcp{candidate->mcp};
+            Get<"MCPdt">(tuple) = mcp ? mcp->dt : nan;
+            Get<"MCPdr">(tuple) = mcp ? mcp->dr : nan;
+            const auto& gammaPair{candidate->gammaPair};
+            Get<"ECALEsum">(tuple) = gammaPair ? gammaPair->energySum : nan;
+            Get<"ECALcos">(tuple) = gammaPair ? gammaPair->cosAngle : nan;
+            Get<"ECALdt">(tuple) = gammaPair ? gammaPair->dt : nan;
+            output.Fill(std::move(tuple));
+        });
+        output.Write();
+    }
+
+    auto& cutFlow{selection.TheCutFlow()};
+    cutFlow.Merge();
+    cutFlow.Print();
+    if (mplr::comm_world().rank() == 0) {
+        auto cutFlowNode{config["CutFlow"]};
+        cutFlow.Export(cutFlowNode);
+        Mustard::ROOTX::MakeTextTMacro(YAML::Dump(config), "AnalysisConfig", "Print AnaMACE selection and cut flow")->Write();
+    }
+
+    return EXIT_SUCCESS;
 }
+
+} // namespace MACE::AnaMACE
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::AnaMACE {
+
+class AnaMACE : public Mustard::Application::Subprogram {
+public:
+    AnaMACE();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::AnaMACE
@@ -0,0 +1,99 @@
+#include "MACE/AnaMACE/CLI.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/core.h"
+
+#include <cassert>
+#include <cstdlib>
+
+namespace MACE::AnaMACE {
+
+CLIModule::CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli) :
+    ModuleBase{cli} {
+    TheCLI()
+        ->add_argument("input")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .help("Input file path(s), with reconstruction outputs (ReconMMSTrack, ReconECAL) and MCP hits.");
+    TheCLI()
+        ->add_argument("-o", "--output")
+        .help("Output file path. Suffix '_ana' on input file name by default.");
+    TheCLI()
+        ->add_argument("-m", "--output-mode")
+        .help("Output file creation mode. Default to 'NEW'.");
+
+    TheCLI()
+        ->add_argument("-i", "--index-range")
+        .nargs(1, 2)
+        .scan<'i', gsl::index>()
+        .default_value(std::vector<gsl::index>{0, 1})
+        .help("Set number of datasets (index in [0, size) range), or index range (in [first, last) pattern)");
+
+    TheCLI()
+        ->add_argument("-c", "--selection")
+        .help("Selection configuration YAML file, with Track, Vertex, MCP and ECAL sections overriding built-in defaults "
+              "(in internal units: mm, ns, MeV). Set 'Enabled: false' in MCP or ECAL section to drop that cut.");
+
+    TheCLI()
+        ->add_argument("--track-name")
+        .help("Set MMS track dataset name format. Default to 'G4Run{}/MMSTrack'.");
+    TheCLI()
+        ->add_argument("--track-state-name")
+        .help("Set MMS track state dataset name format. Default to 'G4Run{}/MMSTrackState'. "
+              "Set to empty to extrapolate tracks to the target on the fly.");
+    TheCLI()
+        ->add_argument("--mcp-hit-name")
+        .help("Set MCP hit dataset name format. Default to 'G4Run{}/MCPSimHit'.");
+    TheCLI()
+        ->add_argument("--ecal-cluster-name")
+        .help("Set ECAL cluster dataset name format. Default to 'G4Run{}/ECALCluster'.");
+    TheCLI()
+        ->add_argument("--weight-name")
+        .help("Set primary vertex dataset name format for event weights (e.g. 'G4Run{}/SimPrimaryVertex'). Unweighted by default.");
+    TheCLI()
+        ->add_argument("--candidate-name")
+        .help("Set output signal candidate dataset name format. Default to 'G4Run{}/SignalCandidate'.");
+}
+
+auto CLIModule::OutputFilePath() const -> std::filesystem::path {
+    if (auto output{TheCLI()->present("-o")}) {
+        return *std::move(output);
+    }
+    auto inputList{InputFilePath()};
+    if (inputList.size() > 1) {
+        Mustard::PrintError("Cannot automatically construct output file path since # input file path > 1. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    if (inputList.front().find('*') != std::string::npos) {
+        Mustard::PrintError("Cannot automatically construct output file path since input file path includes wildcards. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    std::filesystem::path input{std::move(inputList.front())};
+    const auto extension{input.extension()};
+    return input.replace_extension().concat("_ana").replace_extension(extension);
+}
+
+auto CLIModule::DatasetIndexRange() const -> std::pair<gsl::index, gsl::index> {
+    auto var{TheCLI()->get<std::vector<gsl::index>>("-i")};
+    assert(var.size() == 1 or var.size() == 2);
+    if (var.size() == 1) {
+        return {0, var.front()};
+    } else {
+        return {var.front(), var.back()};
+    }
+}
+
+auto CLIModule::ImportSelection(Analysis::SignalSelection& selection) const -> void {
+    if (const auto path{TheCLI()->present("-c")}) {
+        try {
+            selection.Import(YAML::LoadFile(*path));
+        } catch (const YAML::Exception& e) {
+            Mustard::PrintError(fmt::format("Invalid selection configuration '{}' ({})", *path, e.what()));
+            std::exit(EXIT_FAILURE);
+        }
+    }
+}
+
+} // namespace MACE::AnaMACE
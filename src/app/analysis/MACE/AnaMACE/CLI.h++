@@ -0,0 +1,51 @@
+#pragma once
+
+#include "MACE/Analysis/SignalSelection.h++"
+#include "MACE/Detector/Description/ECALField.h++"
+#include "MACE/Detector/Description/MMSField.h++"
+#include "MACE/Detector/Description/Solenoid.h++"
+#include "MACE/Detector/Description/Target.h++"
+
+#include "Mustard/CLI/CLI.h++"
+#include "Mustard/CLI/Module/BasicModule.h++"
+#include "Mustard/CLI/Module/DetectorDescriptionModule.h++"
+#include "Mustard/CLI/Module/ModuleBase.h++"
+
+#include "gsl/gsl"
+
+#include <filesystem>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace MACE::AnaMACE {
+
+class CLIModule : public Mustard::CLI::ModuleBase {
+public:
+    CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli);
+
+    auto InputFilePath() const -> auto { return TheCLI()->get<std::vector<std::string>>("input"); }
+    auto OutputFileMode() const -> auto { return TheCLI()->present("-m").value_or("NEW"); }
+    auto OutputFilePath() const -> std::filesystem::path;
+
+    auto DatasetIndexRange() const -> std::pair<gsl::index, gsl::index>;
+
+    auto ImportSelection(Analysis::SignalSelection& selection) const -> void;
+
+    auto TrackNameFormat() const -> auto { return TheCLI()->present("--track-name").value_or("G4Run{}/MMSTrack"); }
+    auto TrackStateNameFormat() const -> auto { return TheCLI()->present("--track-state-name").value_or("G4Run{}/MMSTrackState"); }
+    auto MCPHitNameFormat() const -> auto { return TheCLI()->present("--mcp-hit-name").value_or("G4Run{}/MCPSimHit"); }
+    auto ECALClusterNameFormat() const -> auto { return TheCLI()->present("--ecal-cluster-name").value_or("G4Run{}/ECALCluster"); }
+    auto WeightNameFormat() const -> auto { return TheCLI()->present("--weight-name").value_or(""); }
+    auto CandidateNameFormat() const -> auto { return TheCLI()->present("--candidate-name").value_or("G4Run{}/SignalCandidate"); }
+};
+
+using CLI = Mustard::CLI::CLI<Mustard::CLI::BasicModule,
+                              Mustard::CLI::DetectorDescriptionModule<std::tuple<MACE::Detector::Description::ECALField,
+                                                                                 MACE::Detector::Description::MMSField,
+                                                                                 MACE::Detector::Description::Solenoid,
+                                                                                 MACE::Detector::Description::Target>>,
+                              CLIModule>;
+
+} // namespace MACE::AnaMACE
@@ -0,0 +1,4 @@
+# $1: reconstruction output file (ReconMMSTrack, ReconECAL and MCP hits), $2: selection configuration
+AnaMACE $1 \
+    --selection $2 \
+    --weight-name G4Run{}/SimPrimaryVertex
@@ -0,0 +1,196 @@
+#include "MACE/AlignCDC/AlignCDC.h++"
+#include "MACE/AlignCDC/CLI.h++"
+#include "MACE/Data/MMSTrack.h++"
+#include "MACE/Data/Hit.h++"
+#include "MACE/Data/MergeJoiner.h++"
+#include "MACE/Data/SimHit.h++"
+#include "MACE/Reconstruction/MMSTracking/Alignment/AlignmentParameter.h++"
+#include "MACE/Reconstruction/MMSTracking/Alignment/MillepedeSolver.h++"
+#include "MACE/Reconstruction/MMSTracking/Alignment/TrackResidual.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "Eigen/Core"
+
+#include "mplr/mplr.hpp"
+
+#include "muc/hash_map"
+#include "muc/math"
+
+#include "gsl/gsl"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MACE::AlignCDC {
+
+using namespace Reconstruction::MMSTracking::Alignment;
+
+AlignCDC::AlignCDC() :
+    Subprogram{"AlignCDC", "Track-based CDC alignment and drift velocity calibration."} {}
+
+auto AlignCDC::Main(int argc, char* argv[]) const -> int {
+    CLI cli;
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+
+    AlignmentParameter parameter;
+    const auto groupList{cli.Group()};
+    for (auto group : {AlignmentParameter::Group::SenseLayer, AlignmentParameter::Group::DriftVelocity, AlignmentParameter::Group::Cell}) {
+        parameter.Enabled(group, std::ranges::find(groupList, AlignmentParameter::GroupName(group)) != groupList.cend());
+    }
+    TrackResidual residual{parameter};
+    residual.Resolution(cli.Resolution());
+    residual.MaxResidual(cli.MaxResidual());
+    residual.MinHit(cli.MinHit());
+    MillepedeSolver solver{parameter};
+    solver.PreSigma(cli.PreSigma());
+
+    // tracks of this process, with their drift hits. The drift time starts at the track T0 plus
+    // the time of flight to the cell, or (MC only) at the simulated time the particle passes the cell
+    std::vector<std::pair<TrackResidual::Helix, std::vector<TrackResidual::DriftHit>>> sample;
+    const auto [iFirst, iLast]{cli.DatasetIndexRange()};
+    const auto TreeName{[](const std::string& nameFormat, gsl::index i) { return fmt::vformat(nameFormat, fmt::make_format_args(i)); }};
+    const auto Collect{[&]<typename AHit>(gsl::index i, auto PassTime) {
+        const Data::MergeJoiner<AHit, Data::MMSTrack> joiner{
+            {{{cli.InputFilePath(), TreeName(cli.CDCHitNameFormat(), i)},
+              {cli.TrackFilePath(), TreeName(cli.TrackNameFormat(), i)}}}};
+        joiner.Join([&](int, const auto& event) {
+            const auto& [hit, track]{event};
+            muc::flat_hash_map<int, const Mustard::Data::Tuple<AHit>*> hitOfID;
+            for (auto&& h : hit) {
+                hitOfID.try_emplace(*Get<"HitID">(*h), h.get());
+            }
+            for (auto&& t : track) {
+                std::vector<TrackResidual::DriftHit> driftHit;
+                for (auto hitID : *Get<"HitID">(*t)) {
+                    if (const auto h{hitOfID.find(hitID)};
+                        h != hitOfID.cend()) {
+                        const auto& theHit{*h->second};
+                        driftHit.push_back({*Get<"CellID">(theHit), *Get<"t">(theHit), PassTime(theHit)});
+                    }
+                }
+                sample.emplace_back(TrackResidual::HelixOf(*t), std::move(driftHit));
+            }
+        });
+    }};
+    for (auto i{iFirst}; i < iLast; ++i) {
+        if (cli.TruthDriftTime()) {
+            Collect.template operator()<Data::CDCSimHit>(i, [](auto&& hit) -> double { return *Get<"tHit">(hit); });
+        } else {
+            Collect.template operator()<Data::CDCHit>(i, [](auto&&) { return std::numeric_limits<double>::quiet_NaN(); });
+        }
+    }
+
+    // iterate track refits and global solves, corrections accumulate in the CDC description
+    MillepedeSolver::Result result{Eigen::VectorXd::Zero(parameter.NParameter()), Eigen::VectorXd::Zero(parameter.NParameter()), 0, 0, 0};
+    for (int iteration{}; iteration < cli.MaxIteration(); ++iteration) {
+        solver.Reset();
+        for (auto&& [helix, driftHit] : sample) {
+            const auto fit{residual.Fit(helix, driftHit)};
+            if (fit and fit->chi2 / fit->ndf < cli.MaxChi2PerNDF()) {
+                solver.AddTrack(*fit);
+            }
+        }
+        // errors are only needed for the final solve
+        solver.ComputeError(cli.ComputeError() and iteration + 1 == cli.MaxIteration());
+        result = solver.Solve();
+        parameter.Apply(result.delta);
+        Mustard::MasterPrintLn("Iteration {}: {} tracks, chi2/ndf = {:.4g}, max |correction| {:.4g}",
+                               iteration, result.nTrack, result.chi2 / result.ndf, result.delta.cwiseAbs().maxCoeff());
+    }
+
+    const auto value{parameter.Value()};
+    Mustard::MasterPrintLn("{:>6} {:>18} {:>18} {:>20} {:>20}", "Layer", "dx (um)", "dy (um)", "dphi (urad)", "dv (1e-4)");
+    for (int l{}; l < parameter.NSenseLayer(); ++l) {
+        const auto Format{[&](AlignmentParameter::LayerParameter k, double unit) {
+            const auto i{parameter.LayerIndex(l, k)};
+            return cli.ComputeError() ? fmt::format("{:.3f} +- {:.3f}", value[i] / unit, result.error[i] / unit) :
+                                        fmt::format("{:.3f}", value[i] / unit);
+        }};
+        Mustard::MasterPrintLn("{:>6} {:>18} {:>18} {:>20} {:>20}", l,
+                               Format(AlignmentParameter::kDx, 1e-3), Format(AlignmentParameter::kDy, 1e-3),
+                               Format(AlignmentParameter::kDphi, 1e-6), Format(AlignmentParameter::kDv, 1e-4));
+    }
+
+    if (mplr::comm_world().rank() == 0) {
+        YAML::Node overlay;
+        parameter.Export(overlay);
+        std::ofstream{cli.OutputFilePath()} << YAML::Dump(overlay) << '\n';
+    }
+
+    // recovery of an injected misalignment, up to the constrained modes
+    if (const auto truthPath{cli.TruthFilePath()}) {
+        const auto truthNode{YAML::LoadFile(*truthPath)["CDC"]};
+        if (not truthNode) {
+            Mustard::PrintError(fmt::format("No CDC section in '{}'", *truthPath));
+            return EXIT_FAILURE;
+        }
+        const auto truth{parameter.Value(truthNode)};
+        const auto Compare{[&](const std::string& name, const std::vector<int>& index, bool removeMean, double unit, const char* unitName) {
+            if (index.empty() or not parameter.Free(index.front())) {
+                return;
+            }
+            const auto n{static_cast<double>(index.size())};
+            double meanDiff{};
+            double meanTruth{};
+            for (auto i : index) {
+                meanDiff += (value[i] - truth[i]) / n;
+                meanTruth += truth[i] / n;
+            }
+            if (not removeMean) {
+                meanDiff = 0;
+                meanTruth = 0;
+            }
+            double truthRMS{};
+            double diffRMS{};
+            double pullRMS{};
+            for (auto i : index) {
+                const auto diff{value[i] - truth[i] - meanDiff};
+                truthRMS += muc::pow(truth[i] - meanTruth, 2) / n;
+                diffRMS += muc::pow(diff, 2) / n;
+                pullRMS += muc::pow(diff / result.error[i], 2) / n;
+            }
+            Mustard::MasterPrintLn("{:>10}: injected RMS {:.4g} {}, residual RMS {:.4g} {}, pull RMS {}",
+                                   name, std::sqrt(truthRMS) / unit, unitName, std::sqrt(diffRMS) / unit, unitName,
+                                   cli.ComputeError() ? fmt::format("{:.3g}", std::sqrt(pullRMS)) : "n/a (no --error)");
+        }};
+        const auto LayerIndex{[&](AlignmentParameter::LayerParameter k) {
+            std::vector<int> index;
+            for (int l{}; l < parameter.NSenseLayer(); ++l) {
+                index.emplace_back(parameter.LayerIndex(l, k));
+            }
+            return index;
+        }};
+        Compare("Layer dx", LayerIndex(AlignmentParameter::kDx), true, 1e-3, "um");
+        Compare("Layer dy", LayerIndex(AlignmentParameter::kDy), true, 1e-3, "um");
+        Compare("Layer dphi", LayerIndex(AlignmentParameter::kDphi), true, 1e-6, "urad");
+        Compare("Layer dv", LayerIndex(AlignmentParameter::kDv), false, 1e-4, "x 1e-4");
+        const auto CellIndex{[&](AlignmentParameter::CellParameter k) {
+            std::vector<int> index;
+            for (int c{}; c < parameter.NCell(); ++c) {
+                index.emplace_back(parameter.CellIndex(c, k));
+            }
+            return index;
+        }};
+        Compare("Cell dx", CellIndex(AlignmentParameter::kCellDx), true, 1e-3, "um");
+        Compare("Cell dy", CellIndex(AlignmentParameter::kCellDy), true, 1e-3, "um");
+        Compare("Cell tx", CellIndex(AlignmentParameter::kCellTx), true, 1e-6, "urad");
+        Compare("Cell ty", CellIndex(AlignmentParameter::kCellTy), true, 1e-6, "urad");
+    }
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::AlignCDC
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::AlignCDC {
+
+class AlignCDC : public Mustard::Application::Subprogram {
+public:
+    AlignCDC();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::AlignCDC
@@ -0,0 +1,105 @@
+#include "MACE/AlignCDC/CLI.h++"
+
+#include <cassert>
+
+namespace MACE::AlignCDC {
+
+CLIModule::CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli) :
+    ModuleBase{cli} {
+    TheCLI()
+        ->add_argument("input")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .help("Input file path(s), with CDC hits (simulated with the CDC description to be aligned).");
+    TheCLI()
+        ->add_argument("-t", "--track-input")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .help("Track file path(s), with MMS tracks reconstructed from the input (ReconMMSTrack). Default to the input.");
+    TheCLI()
+        ->add_argument("-o", "--output")
+        .default_value(std::string{"CDCAlignment.yaml"})
+        .help("Output description YAML overlay, with CDC SenseLayerAlignment, CellAlignment and DriftVelocityScale. "
+              "Default to 'CDCAlignment.yaml'.");
+    TheCLI()
+        ->add_argument("--truth")
+        .help("Description YAML with the injected CDC misalignment. If given, solved parameters are compared with it.");
+
+    TheCLI()
+        ->add_argument("-i", "--index-range")
+        .nargs(1, 2)
+        .scan<'i', gsl::index>()
+        .default_value(std::vector<gsl::index>{0, 1})
+        .help("Set number of datasets (index in [0, size) range), or index range (in [first, last) pattern)");
+
+    TheCLI()
+        ->add_argument("--align")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .choices("SenseLayer", "DriftVelocity", "Cell")
+        .default_value(std::vector<std::string>{"SenseLayer", "DriftVelocity"})
+        .help("Parameter groups to fit: sense layer shift and rotation, sense layer drift velocity, cell shift and wire tilt. "
+              "Default to SenseLayer and DriftVelocity.");
+    TheCLI()
+        ->add_argument("--resolution")
+        .scan<'g', double>()
+        .default_value(0.15)
+        .help("Drift distance resolution (mm). Default to 0.15.");
+    TheCLI()
+        ->add_argument("--max-residual")
+        .scan<'g', double>()
+        .default_value(1.5)
+        .help("Hits with (unbiased) residual beyond this are outliers (mm). Default to 1.5.");
+    TheCLI()
+        ->add_argument("--min-hit")
+        .scan<'i', int>()
+        .default_value(8)
+        .help("Minimum number of hits of a track after outlier rejection. Default to 8.");
+    TheCLI()
+        ->add_argument("--max-chi2")
+        .scan<'g', double>()
+        .default_value(10.)
+        .help("Maximum chi2/ndf of the track refit. Default to 10.");
+    TheCLI()
+        ->add_argument("--pre-sigma")
+        .scan<'g', double>()
+        .default_value(10.)
+        .help("Regularization width of every parameter (in internal units: mm, rad). Default to 10.");
+    TheCLI()
+        ->add_argument("--error")
+        .flag()
+        .help("Compute the parameter errors (one extra solve per free parameter). Required by the pulls of --truth.");
+    TheCLI()
+        ->add_argument("--max-iteration")
+        .scan<'i', int>()
+        .default_value(3)
+        .help("Number of alignment iterations (track refit and global solve) on the input tracks. Default to 3.");
+    TheCLI()
+        ->add_argument("--truth-drift-time")
+        .flag()
+        .help("MC only: start the drift time at the simulated time the particle passes the cell (CDCSimHit tHit), "
+              "instead of the track T0 plus the time of flight.");
+
+    TheCLI()
+        ->add_argument("--cdc-hit-name")
+        .help("Set CDC hit dataset name format. Default to 'G4Run{}/CDCSimHit'.");
+    TheCLI()
+        ->add_argument("--track-name")
+        .help("Set MMS track dataset name format. Default to 'G4Run{}/MMSTrack'.");
+}
+
+auto CLIModule::TrackFilePath() const -> std::vector<std::string> {
+    if (auto track{TheCLI()->present<std::vector<std::string>>("-t")}) {
+        return *std::move(track);
+    }
+    return InputFilePath();
+}
+
+auto CLIModule::DatasetIndexRange() const -> std::pair<gsl::index, gsl::index> {
+    auto var{TheCLI()->get<std::vector<gsl::index>>("-i")};
+    assert(var.size() == 1 or var.size() == 2);
+    if (var.size() == 1) {
+        return {0, var.front()};
+    } else {
+        return {var.front(), var.back()};
+    }
+}
+
+} // namespace MACE::AlignCDC
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "MACE/Detector/Description/CDC.h++"
+
+#include "Mustard/CLI/CLI.h++"
+#include "Mustard/CLI/Module/BasicModule.h++"
+#include "Mustard/CLI/Module/DetectorDescriptionModule.h++"
+#include "Mustard/CLI/Module/ModuleBase.h++"
+
+#include "gsl/gsl"
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace MACE::AlignCDC {
+
+class CLIModule : public Mustard::CLI::ModuleBase {
+public:
+    CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli);
+
+    auto InputFilePath() const -> auto { return TheCLI()->get<std::vector<std::string>>("input"); }
+    auto TrackFilePath() const -> std::vector<std::string>;
+    auto OutputFilePath() const -> auto { return TheCLI()->get("-o"); }
+    auto TruthFilePath() const -> auto { return TheCLI()->present("--truth"); }
+
+    auto DatasetIndexRange() const -> std::pair<gsl::index, gsl::index>;
+
+    auto Group() const -> auto { return TheCLI()->get<std::vector<std::string>>("--align"); }
+    auto Resolution() const -> auto { return TheCLI()->get<double>("--resolution"); }
+    auto MaxResidual() const -> auto { return TheCLI()->get<double>("--max-residual"); }
+    auto MinHit() const -> auto { return TheCLI()->get<int>("--min-hit"); }
+    auto MaxChi2PerNDF() const -> auto { return TheCLI()->get<double>("--max-chi2"); }
+    auto PreSigma() const -> auto { return TheCLI()->get<double>("--pre-sigma"); }
+    auto ComputeError() const -> auto { return TheCLI()->get<bool>("--error"); }
+    auto MaxIteration() const -> auto { return TheCLI()->get<int>("--max-iteration"); }
+    auto TruthDriftTime() const -> auto { return TheCLI()->get<bool>("--truth-drift-time"); }
+
+    auto CDCHitNameFormat() const -> auto { return TheCLI()->present("--cdc-hit-name").value_or("G4Run{}/CDCSimHit"); }
+    auto TrackNameFormat() const -> auto { return TheCLI()->present("--track-name").value_or("G4Run{}/MMSTrack"); }
+};
+
+using CLI = Mustard::CLI::CLI<Mustard::CLI::BasicModule,
+                              Mustard::CLI::DetectorDescriptionModule<std::tuple<MACE::Detector::Description::CDC>>,
+                              CLIModule>;
+
+} // namespace MACE::AlignCDC
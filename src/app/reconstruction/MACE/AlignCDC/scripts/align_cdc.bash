@@ -0,0 +1,7 @@
+# $1: simulation output with CDC hits (simulated with the misaligned description, e.g. misalignment.yaml merged),
+# $2: ReconMMSTrack output of $1, $3 (optional): the injected misalignment for the recovery check
+if [ -z "$3" ]; then
+    AlignCDC $1 --track-input $2 --align SenseLayer DriftVelocity -o CDCAlignment.yaml
+else
+    AlignCDC $1 --track-input $2 --align SenseLayer DriftVelocity -o CDCAlignment.yaml --truth $3 --error
+fi
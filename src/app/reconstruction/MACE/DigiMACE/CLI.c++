@@ -0,0 +1,124 @@
+#include "MACE/DigiMACE/CLI.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/core.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace MACE::DigiMACE {
+
+using namespace Mustard::LiteralUnit::Time;
+
+CLIModule::CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli) :
+    ModuleBase{cli} {
+    TheCLI()
+        ->add_argument("input")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .help("Input file path(s).");
+    TheCLI()
+        ->add_argument("-o", "--output")
+        .help("Output file path. Suffix '_raw' on input file name by default.");
+    TheCLI()
+        ->add_argument("-m", "--output-mode")
+        .help("Output file creation mode. Default to 'NEW'.");
+
+    TheCLI()
+        ->add_argument("-i", "--index-range")
+        .nargs(1, 2)
+        .scan<'i', gsl::index>()
+        .default_value(std::vector<gsl::index>{0, 1})
+        .help("Set number of datasets (index in [0, size) range), or index range (in [first, last) pattern)");
+
+    TheCLI()
+        ->add_argument("-w", "--readout-window")
+        .nargs(2)
+        .scan<'g', double>()
+        .default_value(std::vector{-1000., 1000.})
+        .help("Readout window (ns). Hits outside are lost, noise hits are generated inside. Default to [-1000, 1000].");
+    TheCLI()
+        ->add_argument("-f", "--front-end")
+        .help("Front-end configuration YAML file, with CDC, ECAL and TTC sections overriding built-in defaults "
+              "(TDCLSB, ADCLSB, Threshold, DeadTime, NoiseRate, NoiseAmplitude, Efficiency, ChannelEfficiency, DeadChannel; "
+              "in internal units: ns, MeV).");
+
+    TheCLI()
+        ->add_argument("--detector")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .choices("CDC", "ECAL", "TTC")
+        .default_value(std::vector<std::string>{"CDC", "ECAL", "TTC"})
+        .help("Detectors to digitize. Default to all of CDC, ECAL and TTC.");
+    TheCLI()
+        ->add_argument("--cdc-hit-name")
+        .help("Set CDC hit dataset name format. Default to 'G4Run{}/CDCSimHit'.");
+    TheCLI()
+        ->add_argument("--ttc-hit-name")
+        .help("Set TTC hit dataset name format. Default to 'G4Run{}/TTCSimHit'.");
+    TheCLI()
+        ->add_argument("--ecal-hit-name")
+        .help("Set ECAL hit dataset name format. Default to 'G4Run{}/ECALSimHit'.");
+    TheCLI()
+        ->add_argument("--cdc-raw-hit-name")
+        .help("Set CDC raw hit dataset name format. Default to 'G4Run{}/CDCRawHit'.");
+    TheCLI()
+        ->add_argument("--ttc-raw-hit-name")
+        .help("Set TTC raw hit dataset name format. Default to 'G4Run{}/TTCRawHit'.");
+    TheCLI()
+        ->add_argument("--ecal-raw-hit-name")
+        .help("Set ECAL raw hit dataset name format. Default to 'G4Run{}/ECALRawHit'.");
+}
+
+auto CLIModule::DatasetIndexRange() const -> std::pair<gsl::index, gsl::index> {
+    auto var{TheCLI()->get<std::vector<gsl::index>>("-i")};
+    assert(var.size() == 1 or var.size() == 2);
+    if (var.size() == 1) {
+        return {0, var.front()};
+    } else {
+        return {var.front(), var.back()};
+    }
+}
+
+auto CLIModule::OutputFilePath() const -> std::filesystem::path {
+    if (auto output{TheCLI()->present("-o")}) {
+        return *std::move(output);
+    }
+    auto inputList{InputFilePath()};
+    if (inputList.size() > 1) {
+        Mustard::PrintError("Cannot automatically construct output file path since # input file path > 1. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    if (inputList.front().find('*') != std::string::npos) {
+        Mustard::PrintError("Cannot automatically construct output file path since input file path includes wildcards. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    std::filesystem::path input{std::move(inputList.front())};
+    const auto extension{input.extension()};
+    return input.replace_extension().concat("_raw").replace_extension(extension);
+}
+
+auto CLIModule::ReadoutWindow() const -> std::pair<double, double> {
+    const auto var{TheCLI()->get<std::vector<double>>("-w")};
+    return {var.front() * 1_ns, var.back() * 1_ns};
+}
+
+auto CLIModule::FrontEndOf(const std::string& detector) const -> FrontEnd {
+    auto frontEnd{FrontEnd::Default(detector)};
+    if (const auto path{TheCLI()->present("-f")}) {
+        try {
+            if (const auto node{YAML::LoadFile(*path)[detector]}) {
+                frontEnd.Import(node);
+            }
+        } catch (const YAML::Exception& e) {
+            Mustard::PrintError(fmt::format("Invalid front-end configuration '{}' ({})", *path, e.what()));
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    return frontEnd;
+}
+
+} // namespace MACE::DigiMACE
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "MACE/Detector/Description/CDC.h++"
+#include "MACE/Detector/Description/ECAL.h++"
+#include "MACE/Detector/Description/TTC.h++"
+#include "MACE/DigiMACE/FrontEnd.h++"
+
+#include "Mustard/CLI/CLI.h++"
+#include "Mustard/CLI/Module/BasicModule.h++"
+#include "Mustard/CLI/Module/DetectorDescriptionModule.h++"
+#include "Mustard/CLI/Module/ModuleBase.h++"
+#include "Mustard/CLI/Module/MonteCarloModule.h++"
+
+#include "gsl/gsl"
+
+#include <filesystem>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace MACE::DigiMACE {
+
+class CLIModule : public Mustard::CLI::ModuleBase {
+public:
+    CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli);
+
+    auto InputFilePath() const -> auto { return TheCLI()->get<std::vector<std::string>>("input"); }
+    auto OutputFileMode() const -> auto { return TheCLI()->present("-m").value_or("NEW"); }
+    auto OutputFilePath() const -> std::filesystem::path;
+
+    auto DatasetIndexRange() const -> std::pair<gsl::index, gsl::index>;
+
+    auto ReadoutWindow() const -> std::pair<double, double>;
+    auto FrontEndOf(const std::string& detector) const -> FrontEnd;
+
+    auto Detector() const -> auto { return TheCLI()->get<std::vector<std::string>>("--detector"); }
+    auto CDCSimHitNameFormat() const -> auto { return TheCLI()->present("--cdc-hit-name").value_or("G4Run{}/CDCSimHit"); }
+    auto TTCSimHitNameFormat() const -> auto { return TheCLI()->present("--ttc-hit-name").value_or("G4Run{}/TTCSimHit"); }
+    auto ECALSimHitNameFormat() const -> auto { return TheCLI()->present("--ecal-hit-name").value_or("G4Run{}/ECALSimHit"); }
+    auto CDCRawHitNameFormat() const -> auto { return TheCLI()->present("--cdc-raw-hit-name").value_or("G4Run{}/CDCRawHit"); }
+    auto TTCRawHitNameFormat() const -> auto { return TheCLI()->present("--ttc-raw-hit-name").value_or("G4Run{}/TTCRawHit"); }
+    auto ECALRawHitNameFormat() const -> auto { return TheCLI()->present("--ecal-raw-hit-name").value_or("G4Run{}/ECALRawHit"); }
+};
+
+using CLI = Mustard::CLI::CLI<Mustard::CLI::BasicModule,
+                              Mustard::CLI::MonteCarloModule,
+                              Mustard::CLI::DetectorDescriptionModule<std::tuple<MACE::Detector::Description::CDC,
+                                                                                 MACE::Detector::Description::ECAL,
+                                                                                 MACE::Detector::Description::TTC>>,
+                              CLIModule>;
+
+} // namespace MACE::DigiMACE
@@ -0,0 +1,88 @@
+#include "MACE/Data/RawHit.h++"
+#include "MACE/DigiMACE/CLI.h++"
+#include "MACE/DigiMACE/DigiMACE.h++"
+#include "MACE/DigiMACE/Digitizer.h++"
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Parallel/ProcessSpecificPath.h++"
+#include "Mustard/ROOTX/MakeTextTMacro.h++"
+#include "Mustard/Utility/UseXoshiro.h++"
+
+#include "TFile.h"
+
+#include "mplr/mplr.hpp"
+
+#include "muc/hash_map"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MACE::DigiMACE {
+
+DigiMACE::DigiMACE() :
+    Subprogram{"DigiMACE", "Front-end electronics simulation, producing raw hits from simulation data."} {}
+
+auto DigiMACE::Main(int argc, char* argv[]) const -> int {
+    CLI cli;
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+    Mustard::UseXoshiro<256> random{cli};
+
+    const auto outputPath{Mustard::Parallel::ProcessSpecificPath(cli.OutputFilePath()).replace_extension(".root").generic_string()};
+    TFile file{outputPath.c_str(), cli.OutputFileMode().c_str(), "", ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose};
+    if (not file.IsOpen()) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Cannot open file '{}' with mode '{}'", outputPath, cli.OutputFileMode()));
+    }
+
+    const auto readoutWindow{cli.ReadoutWindow()};
+    const auto detector{cli.Detector()};
+    muc::flat_hash_map<std::string, FrontEnd> frontEnd;
+    YAML::Node config;
+    config["ReadoutWindow"].push_back(readoutWindow.first);
+    config["ReadoutWindow"].push_back(readoutWindow.second);
+    for (auto&& name : detector) {
+        auto node{config[name]};
+        frontEnd.emplace(name, cli.FrontEndOf(name)).first->second.Export(node);
+    }
+    if (mplr::comm_world().rank() == 0) {
+        Mustard::ROOTX::MakeTextTMacro(YAML::Dump(config), "DigitizationConfig", "Print DigiMACE front-end configuration")->Write();
+    }
+
+    const auto Enabled{[&](auto&& name) { return std::ranges::find(detector, name) != detector.cend(); }};
+    const auto [iFirst, iLast]{cli.DatasetIndexRange()};
+    const auto TreeName{[](const std::string& nameFormat, gsl::index i) { return fmt::vformat(nameFormat, fmt::make_format_args(i)); }};
+    for (auto i{iFirst}; i < iLast; ++i) {
+        std::vector<std::string> simHitTreeName;
+        for (auto&& [name, nameFormat] : {std::pair{"CDC", cli.CDCSimHitNameFormat()},
+                                          std::pair{"ECAL", cli.ECALSimHitNameFormat()},
+                                          std::pair{"TTC", cli.TTCSimHitNameFormat()}}) {
+            if (Enabled(name)) {
+                simHitTreeName.emplace_back(TreeName(nameFormat, i));
+            }
+        }
+
+        Digitizer digitizer{cli.InputFilePath(), readoutWindow};
+        digitizer.Plan(simHitTreeName);
+        if (Enabled("CDC")) {
+            digitizer.Digitize<Data::CDCReadout>(TreeName(cli.CDCSimHitNameFormat(), i), TreeName(cli.CDCRawHitNameFormat(), i), frontEnd.at("CDC"));
+        }
+        if (Enabled("ECAL")) {
+            digitizer.Digitize<Data::ECALReadout>(TreeName(cli.ECALSimHitNameFormat(), i), TreeName(cli.ECALRawHitNameFormat(), i), frontEnd.at("ECAL"));
+        }
+        if (Enabled("TTC")) {
+            digitizer.Digitize<Data::TTCReadout>(TreeName(cli.TTCSimHitNameFormat(), i), TreeName(cli.TTCRawHitNameFormat(), i), frontEnd.at("TTC"));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::DigiMACE
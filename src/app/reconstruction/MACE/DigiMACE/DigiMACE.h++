@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::DigiMACE {
+
+class DigiMACE : public Mustard::Application::Subprogram {
+public:
+    DigiMACE();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::DigiMACE
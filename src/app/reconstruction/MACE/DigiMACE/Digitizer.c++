@@ -0,0 +1,37 @@
+#include "MACE/DigiMACE/Digitizer.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "ROOT/RDataFrame.hxx"
+
+#include "mplr/mplr.hpp"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace MACE::DigiMACE {
+
+Digitizer::Digitizer(std::vector<std::string> inputFile, std::pair<double, double> readoutWindow) :
+    fInputFile{std::move(inputFile)},
+    fReadoutWindow{readoutWindow},
+    fEvtIDRange{} {
+    if (fReadoutWindow.first >= fReadoutWindow.second) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Empty readout window [{}, {}]", fReadoutWindow.first, fReadoutWindow.second));
+    }
+}
+
+auto Digitizer::Plan(const std::vector<std::string>& simHitTreeName) -> void {
+    // the same events for all detectors: contiguous EvtID block of this process
+    int maxEvtID{-1};
+    for (auto&& name : simHitTreeName) {
+        maxEvtID = std::max(maxEvtID, *ROOT::RDataFrame{name, fInputFile}.Max<int>("EvtID"));
+    }
+    const auto& worldComm{mplr::comm_world()};
+    const auto nEvent{static_cast<long long>(maxEvtID + 1)};
+    fEvtIDRange = {static_cast<int>(nEvent * worldComm.rank() / worldComm.size()),
+                   static_cast<int>(nEvent * (worldComm.rank() + 1) / worldComm.size())};
+}
+
+} // namespace MACE::DigiMACE
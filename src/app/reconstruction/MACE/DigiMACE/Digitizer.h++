@@ -0,0 +1,60 @@
+#pragma once
+
+#include "MACE/DigiMACE/FrontEnd.h++"
+#include "MACE/DigiMACE/ReadoutTraits.h++"
+
+#include "Mustard/Data/Output.h++"
+#include "Mustard/Data/Take.h++"
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include "ROOT/RDataFrame.hxx"
+#include "TRandom.h"
+
+#include "muc/hash_map"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MACE::DigiMACE {
+
+/// @brief Turns simulated hits into raw hits as the front-end electronics would read them out.
+///
+/// Only the readout columns (EvtID, channel ID, t, Edep) are read, so no MC truth reaches the
+/// output. For each event and channel, in order:
+///  - a hit is lost with the channel inefficiency (always on dead channels);
+///  - a hit below the discriminator threshold is lost;
+///  - noise hits are added uniformly in the readout window at the given rate per channel,
+///    with an exponential amplitude above threshold;
+///  - hits outside the readout window, or within the dead time after an accepted hit, are lost;
+///  - time and energy are quantized by TDC and ADC bin widths.
+///
+/// Events are split into contiguous EvtID blocks over processes. Every event in the block
+/// is read out, including those without any simulated hit (noise only).
+class Digitizer {
+public:
+    Digitizer(std::vector<std::string> inputFile, std::pair<double, double> readoutWindow);
+
+    auto Plan(const std::vector<std::string>& simHitTreeName) -> void;
+
+    template<Mustard::Data::TupleModelizable AModel>
+    auto Digitize(const std::string& simHitTreeName, const std::string& rawHitTreeName, const FrontEnd& frontEnd) const -> void;
+
+    auto NEvent() const -> auto { return fEvtIDRange.second - fEvtIDRange.first; }
+
+private:
+    std::vector<std::string> fInputFile;
+    std::pair<double, double> fReadoutWindow;
+
+    std::pair<int, int> fEvtIDRange;
+};
+
+} // namespace MACE::DigiMACE
+
+#include "MACE/DigiMACE/Digitizer.inl"
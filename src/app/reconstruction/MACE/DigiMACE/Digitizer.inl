@@ -0,0 +1,69 @@
+namespace MACE::DigiMACE {
+
+template<Mustard::Data::TupleModelizable AModel>
+auto Digitizer::Digitize(const std::string& simHitTreeName, const std::string& rawHitTreeName, const FrontEnd& frontEnd) const -> void {
+    using Traits = ReadoutTraits<AModel>;
+    using Hit = Mustard::Data::Tuple<AModel>;
+
+    const auto [evtIDFirst, evtIDLast]{fEvtIDRange};
+    muc::flat_hash_map<int, std::vector<std::shared_ptr<Hit>>> simHit;
+    for (auto&& hit : Mustard::Data::Take<AModel>::From(
+             ROOT::RDataFrame{simHitTreeName, fInputFile}.Filter(
+                 [evtIDFirst, evtIDLast](int evtID) { return evtIDFirst <= evtID and evtID < evtIDLast; }, {"EvtID"}))) {
+        simHit[Get<"EvtID">(*hit)].emplace_back(std::move(hit));
+    }
+
+    Mustard::Data::Output<AModel> output{rawHitTreeName};
+    const auto [windowBegin, windowEnd]{fReadoutWindow};
+    const auto nChannel{Traits::NChannel()};
+    const auto Quantize{[](double x, double lsb) { return lsb > 0 ? std::floor(x / lsb) * lsb : x; }};
+    std::vector<std::shared_ptr<Hit>> eventHit;
+    for (auto evtID{evtIDFirst}; evtID < evtIDLast; ++evtID) {
+        eventHit.clear();
+        if (const auto s{simHit.find(evtID)}; s != simHit.cend()) {
+            for (auto&& hit : s->second) {
+                if (*Get<"Edep">(*hit) < frontEnd.threshold or
+                    gRandom->Rndm() >= frontEnd.Efficiency(Traits::Channel(*hit))) {
+                    continue;
+                }
+                eventHit.emplace_back(hit);
+            }
+        }
+        const auto nNoise{static_cast<gsl::index>(gRandom->Poisson(frontEnd.noiseRate * nChannel * (windowEnd - windowBegin)))};
+        for (gsl::index i{}; i < nNoise; ++i) {
+            const auto channel{static_cast<int>(gRandom->Integer(nChannel))};
+            if (frontEnd.Efficiency(channel) == 0) {
+                continue;
+            }
+            const auto& noise{eventHit.emplace_back(std::make_shared<Hit>())};
+            Get<"EvtID">(*noise) = evtID;
+            Traits::Channel(*noise, channel);
+            Get<"t">(*noise) = gRandom->Uniform(windowBegin, windowEnd);
+            Get<"Edep">(*noise) = frontEnd.threshold + gRandom->Exp(frontEnd.noiseAmplitude);
+        }
+
+        std::ranges::sort(eventHit, [](auto&& hit1, auto&& hit2) {
+            return std::pair{Traits::Channel(*hit1), *Get<"t">(*hit1)} <
+                   std::pair{Traits::Channel(*hit2), *Get<"t">(*hit2)};
+        });
+        auto lastChannel{-1};
+        auto deadUntil{windowBegin};
+        for (auto&& hit : eventHit) {
+            const auto channel{Traits::Channel(*hit)};
+            const auto t{*Get<"t">(*hit)};
+            if (t < windowBegin or t > windowEnd or
+                (channel == lastChannel and t < deadUntil)) {
+                continue;
+            }
+            lastChannel = channel;
+            deadUntil = t + frontEnd.deadTime;
+            Get<"t">(*hit) = Quantize(t, frontEnd.tdcLSB);
+            Get<"Edep">(*hit) = Quantize(*Get<"Edep">(*hit), frontEnd.adcLSB);
+            output.Fill(*hit);
+        }
+    }
+
+    output.Write();
+}
+
+} // namespace MACE::DigiMACE
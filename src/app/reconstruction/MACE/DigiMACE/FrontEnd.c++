@@ -0,0 +1,110 @@
+#include "MACE/DigiMACE/FrontEnd.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace MACE::DigiMACE {
+
+using namespace Mustard::LiteralUnit::Energy;
+using namespace Mustard::LiteralUnit::Time;
+
+auto FrontEnd::Efficiency(int channel) const -> double {
+    const auto e{channelEfficiency.find(channel)};
+    return e == channelEfficiency.cend() ? efficiency : e->second;
+}
+
+auto FrontEnd::Import(const YAML::Node& node) -> void {
+    const auto ImportValue{[&node](auto& value, const char* name) {
+        if (const auto v{node[name]}) {
+            value = v.as<std::remove_cvref_t<decltype(value)>>();
+        }
+    }};
+    ImportValue(tdcLSB, "TDCLSB");
+    ImportValue(adcLSB, "ADCLSB");
+    ImportValue(threshold, "Threshold");
+    ImportValue(deadTime, "DeadTime");
+    ImportValue(noiseRate, "NoiseRate");
+    ImportValue(noiseAmplitude, "NoiseAmplitude");
+    ImportValue(efficiency, "Efficiency");
+    if (const auto map{node["ChannelEfficiency"]}) {
+        for (auto&& [channel, e] : map.as<std::map<int, double>>()) {
+            channelEfficiency[channel] = e;
+        }
+    }
+    if (const auto dead{node["DeadChannel"]}) {
+        for (auto&& channel : dead.as<std::vector<int>>()) {
+            channelEfficiency[channel] = 0;
+        }
+    }
+    if (efficiency < 0 or efficiency > 1) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Channel efficiency {} out of [0, 1]", efficiency));
+    }
+}
+
+auto FrontEnd::Export(YAML::Node& node) const -> void {
+    node["TDCLSB"] = tdcLSB;
+    node["ADCLSB"] = adcLSB;
+    node["Threshold"] = threshold;
+    node["DeadTime"] = deadTime;
+    node["NoiseRate"] = noiseRate;
+    node["NoiseAmplitude"] = noiseAmplitude;
+    node["Efficiency"] = efficiency;
+    std::map<int, double> inefficient;
+    std::vector<int> dead;
+    for (auto&& [channel, e] : channelEfficiency) {
+        if (e == 0) {
+            dead.emplace_back(channel);
+        } else {
+            inefficient[channel] = e;
+        }
+    }
+    std::ranges::sort(dead);
+    node["ChannelEfficiency"] = inefficient;
+    node["DeadChannel"] = dead;
+}
+
+auto FrontEnd::Default(std::string_view detector) -> FrontEnd {
+    if (detector == "CDC") {
+        return {.tdcLSB = 1_ns,
+                .adcLSB = 10_eV,
+                .threshold = 100_eV, // a few primary electrons
+                .deadTime = 200_ns,
+                .noiseRate = 1 / 1_ms,
+                .noiseAmplitude = 100_eV,
+                .efficiency = 1,
+                .channelEfficiency = {}};
+    }
+    if (detector == "ECAL") {
+        return {.tdcLSB = 0.5_ns,
+                .adcLSB = 10_keV,
+                .threshold = 50_keV,
+                .deadTime = 1_us,
+                .noiseRate = 10 / 1_s,
+                .noiseAmplitude = 50_keV,
+                .efficiency = 1,
+                .channelEfficiency = {}};
+    }
+    if (detector != "TTC") {
+        Mustard::Throw<std::invalid_argument>(fmt::format("No front-end defaults for detector '{}'", detector));
+    }
+    return {.tdcLSB = 25_ps,
+            .adcLSB = 10_keV,
+            .threshold = 100_keV,
+            .deadTime = 50_ns,
+            .noiseRate = 1 / 1_ms, // SiPM dark counts above threshold
+            .noiseAmplitude = 100_keV,
+            .efficiency = 1,
+            .channelEfficiency = {}};
+}
+
+} // namespace MACE::DigiMACE
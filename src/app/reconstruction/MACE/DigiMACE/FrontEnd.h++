@@ -0,0 +1,32 @@
+#pragma once
+
+#include "muc/hash_map"
+
+#include <string_view>
+
+namespace YAML {
+class Node;
+} // namespace YAML
+
+namespace MACE::DigiMACE {
+
+/// @brief Front-end electronics parameters of a detector, in Geant4 internal units.
+struct FrontEnd {
+    double tdcLSB;                                     // TDC bin width, no quantization if 0
+    double adcLSB;                                     // ADC bin width (in deposited energy), no quantization if 0
+    double threshold;                                  // discriminator threshold (in deposited energy)
+    double deadTime;                                   // non-paralyzable channel dead time after a hit
+    double noiseRate;                                  // noise hit rate per channel
+    double noiseAmplitude;                             // mean noise amplitude above threshold (exponential)
+    double efficiency;                                 // channel efficiency
+    muc::flat_hash_map<int, double> channelEfficiency; // per-channel efficiency, 0 for dead channels
+
+    auto Efficiency(int channel) const -> double;
+
+    auto Import(const YAML::Node& node) -> void;
+    auto Export(YAML::Node& node) const -> void;
+
+    static auto Default(std::string_view detector) -> FrontEnd;
+};
+
+} // namespace MACE::DigiMACE
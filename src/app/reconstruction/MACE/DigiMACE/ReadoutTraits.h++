@@ -0,0 +1,40 @@
+#pragma once
+
+#include "MACE/Data/RawHit.h++"
+#include "MACE/Detector/Description/CDC.h++"
+#include "MACE/Detector/Description/ECAL.h++"
+#include "MACE/Detector/Description/TTC.h++"
+
+#include "Mustard/Data/Tuple.h++"
+
+namespace MACE::DigiMACE {
+
+/// @brief Per-detector readout channel: its ID column and the number of channels.
+template<typename AModel>
+struct ReadoutTraits;
+
+template<>
+struct ReadoutTraits<Data::CDCReadout> {
+    static auto Channel(const Mustard::Data::Tuple<Data::CDCReadout>& hit) -> int { return Get<"CellID">(hit); }
+    static auto Channel(Mustard::Data::Tuple<Data::CDCReadout>& hit, int channel) -> void { Get<"CellID">(hit) = channel; }
+    static auto NChannel() -> int { return Detector::Description::CDC::Instance().CellMap().size(); }
+};
+
+template<>
+struct ReadoutTraits<Data::ECALReadout> {
+    static auto Channel(const Mustard::Data::Tuple<Data::ECALReadout>& hit) -> int { return Get<"ModID">(hit); }
+    static auto Channel(Mustard::Data::Tuple<Data::ECALReadout>& hit, int channel) -> void { Get<"ModID">(hit) = channel; }
+    static auto NChannel() -> int { return Detector::Description::ECAL::Instance().NUnit(); }
+};
+
+template<>
+struct ReadoutTraits<Data::TTCReadout> {
+    static auto Channel(const Mustard::Data::Tuple<Data::TTCReadout>& hit) -> int { return Get<"TileID">(hit); }
+    static auto Channel(Mustard::Data::Tuple<Data::TTCReadout>& hit, int channel) -> void { Get<"TileID">(hit) = channel; }
+    static auto NChannel() -> int {
+        const auto& ttc{Detector::Description::TTC::Instance()};
+        return ttc.NAlongPhi() * ttc.Width().size();
+    }
+};
+
+} // namespace MACE::DigiMACE
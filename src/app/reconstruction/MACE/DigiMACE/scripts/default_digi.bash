@@ -0,0 +1,4 @@
+# $1: simulation (or MixMACE output) file, $2: front-end configuration
+DigiMACE $1 \
+    --front-end $2 \
+    --readout-window -1000 1000
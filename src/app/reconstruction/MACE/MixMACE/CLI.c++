@@ -0,0 +1,141 @@
+#include "MACE/MixMACE/CLI.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+
+#include "muc/math"
+
+#include "fmt/core.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <ranges>
+#include <stdexcept>
+
+namespace MACE::MixMACE {
+
+using namespace Mustard::LiteralUnit::Time;
+
+CLIModule::CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli) :
+    ModuleBase{cli} {
+    TheCLI()
+        ->add_argument("input")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .help("Signal input file path(s).");
+    TheCLI()
+        ->add_argument("-o", "--output")
+        .help("Output file path. Suffix '_mixed' on input file name by default.");
+    TheCLI()
+        ->add_argument("-m", "--output-mode")
+        .help("Output file creation mode. Default to 'NEW'.");
+
+    TheCLI()
+        ->add_argument("-i", "--index-range")
+        .nargs(1, 2)
+        .scan<'i', gsl::index>()
+        .default_value(std::vector<gsl::index>{0, 1})
+        .help("Set number of signal datasets (index in [0, size) range), or index range (in [first, last) pattern)");
+
+    TheCLI()
+        ->add_argument("-b", "--background")
+        .nargs(2)
+        .append()
+        .required()
+        .help("Add a background library simulated with true decay times, and its event rate in Hz (e.g. -b K40.root 2e4). "
+              "Multiple files of one library can be given as a comma-separated list.");
+    TheCLI()
+        ->add_argument("--background-index")
+        .scan<'i', gsl::index>()
+        .default_value(gsl::index{})
+        .help("Dataset index of background libraries. Default to 0.");
+    TheCLI()
+        ->add_argument("-w", "--readout-window")
+        .nargs(2)
+        .scan<'g', double>()
+        .default_value(std::vector{-1000., 1000.})
+        .help("Readout window (ns) relative to the signal event time. Default to [-1000, 1000].");
+    TheCLI()
+        ->add_argument("--lookback")
+        .scan<'g', double>()
+        .default_value(0.)
+        .help("Also overlay background events starting up to this time (ns) before the readout window, "
+              "for background hits delayed within their event. Default to 0.");
+
+    TheCLI()
+        ->add_argument("--detector")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .choices("CDC", "ECAL", "TTC")
+        .default_value(std::vector<std::string>{"CDC", "ECAL", "TTC"})
+        .help("Detectors to mix. Default to all of CDC, ECAL and TTC.");
+    TheCLI()
+        ->add_argument("--cdc-hit-name")
+        .help("Set CDC hit dataset name format. Default to 'G4Run{}/CDCSimHit'.");
+    TheCLI()
+        ->add_argument("--ttc-hit-name")
+        .help("Set TTC hit dataset name format. Default to 'G4Run{}/TTCSimHit'.");
+    TheCLI()
+        ->add_argument("--ecal-hit-name")
+        .help("Set ECAL hit dataset name format. Default to 'G4Run{}/ECALSimHit'.");
+}
+
+auto CLIModule::DatasetIndexRange() const -> std::pair<gsl::index, gsl::index> {
+    auto var{TheCLI()->get<std::vector<gsl::index>>("-i")};
+    assert(var.size() == 1 or var.size() == 2);
+    if (var.size() == 1) {
+        return {0, var.front()};
+    } else {
+        return {var.front(), var.back()};
+    }
+}
+
+auto CLIModule::OutputFilePath() const -> std::filesystem::path {
+    if (auto output{TheCLI()->present("-o")}) {
+        return *std::move(output);
+    }
+    auto inputList{InputFilePath()};
+    if (inputList.size() > 1) {
+        Mustard::PrintError("Cannot automatically construct output file path since # input file path > 1. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    if (inputList.front().find('*') != std::string::npos) {
+        Mustard::PrintError("Cannot automatically construct output file path since input file path includes wildcards. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    std::filesystem::path input{std::move(inputList.front())};
+    const auto extension{input.extension()};
+    return input.replace_extension().concat("_mixed").replace_extension(extension);
+}
+
+auto CLIModule::Background() const -> std::vector<Mixer::Library> {
+    const auto var{TheCLI()->get<std::vector<std::string>>("-b")};
+    Ensures(muc::even(var.size()));
+    std::vector<Mixer::Library> background;
+    for (gsl::index i{}; i < ssize(var); i += 2) {
+        auto& [file, rate]{background.emplace_back()};
+        for (auto&& f : var[i] | std::views::split(',')) {
+            file.emplace_back(f.begin(), f.end());
+        }
+        try {
+            rate = std::stod(var[i + 1]) / 1_s;
+        } catch (const std::logic_error&) {
+            Mustard::PrintError(fmt::format("Invalid background rate '{}' for '{}'", var[i + 1], var[i]));
+            std::exit(EXIT_FAILURE);
+        }
+        if (rate < 0) {
+            Mustard::PrintError(fmt::format("Negative background rate '{}' for '{}'", var[i + 1], var[i]));
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    return background;
+}
+
+auto CLIModule::Lookback() const -> double {
+    return TheCLI()->get<double>("--lookback") * 1_ns;
+}
+
+auto CLIModule::ReadoutWindow() const -> std::pair<double, double> {
+    const auto var{TheCLI()->get<std::vector<double>>("-w")};
+    return {var.front() * 1_ns, var.back() * 1_ns};
+}
+
+} // namespace MACE::MixMACE
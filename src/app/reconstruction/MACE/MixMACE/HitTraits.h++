@@ -0,0 +1,127 @@
+#pragma once
+
+#include "MACE/Data/SimHit.h++"
+#include "MACE/Detector/Description/CDC.h++"
+#include "MACE/Detector/Description/ECAL.h++"
+#include "MACE/Detector/Description/TTC.h++"
+
+#include "Mustard/Data/Tuple.h++"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace MACE::MixMACE {
+
+/// @brief A (signal or time-shifted background) hit, with the index of the event it comes from
+/// (0 for signal, k > 0 for the k-th overlaid background event).
+template<typename AModel>
+struct SourcedHit {
+    std::shared_ptr<Mustard::Data::Tuple<AModel>> hit;
+    int source;
+};
+
+/// @brief Per-detector hit merging rules, the same as the corresponding sensitive detector:
+/// hits on one channel within MergingWindow() after the first one make up one hit,
+/// whose truth is taken from the top hit and Edep is summed.
+template<typename AModel>
+struct HitTraits;
+
+template<>
+struct HitTraits<Data::ECALSimHit> {
+    static auto Channel(const Mustard::Data::Tuple<Data::ECALSimHit>& hit) -> int { return Get<"ModID">(hit); }
+    static auto MergingWindow() -> double { return Detector::Description::ECAL::Instance().ScintillationTimeConstant1(); }
+
+    static auto Shift(Mustard::Data::Tuple<Data::ECALSimHit>& hit, double dt) -> void {
+        Get<"t">(hit) += dt;
+        Get<"t0">(hit) += dt;
+    }
+
+    static auto Combine(Mustard::Data::Tuple<Data::ECALSimHit>& top, int topSource,
+                        std::span<const SourcedHit<Data::ECALSimHit>> cluster) -> void {
+        // nOptPho is counted per module per event, add once per other source event
+        std::vector<int> countedSource{topSource};
+        for (auto&& [hit, source] : cluster) {
+            if (hit.get() == &top) {
+                continue;
+            }
+            Get<"Edep">(top) += Get<"Edep">(*hit);
+            if (std::ranges::find(countedSource, source) == countedSource.cend()) {
+                Get<"nOptPho">(top) += Get<"nOptPho">(*hit);
+                countedSource.emplace_back(source);
+            }
+        }
+    }
+};
+
+template<>
+struct HitTraits<Data::CDCSimHit> {
+    static auto Channel(const Mustard::Data::Tuple<Data::CDCSimHit>& hit) -> int { return Get<"CellID">(hit); }
+    static auto MergingWindow() -> double { return Detector::Description::CDC::Instance().TimeResolutionFWHM(); }
+
+    static auto Shift(Mustard::Data::Tuple<Data::CDCSimHit>& hit, double dt) -> void {
+        Get<"t">(hit) += dt;
+        Get<"tHit">(hit) += dt;
+        Get<"t0">(hit) += dt;
+    }
+
+    static auto Combine(Mustard::Data::Tuple<Data::CDCSimHit>& top, int topSource,
+                        std::span<const SourcedHit<Data::CDCSimHit>> cluster) -> void {
+        // the signal is the leading edge, as in CDCSD (cluster is sorted by t)
+        Get<"t">(top) = *Get<"t">(*cluster.front().hit);
+        Get<"d">(top) = *Get<"d">(*cluster.front().hit);
+        auto nTopHit{1};
+        for (auto&& [hit, source] : cluster) {
+            if (hit.get() == &top) {
+                continue;
+            }
+            Get<"Edep">(top) += Get<"Edep">(*hit); // sum
+            if (source == topSource and Get<"TrkID">(*hit) == Get<"TrkID">(top)) {
+                ++nTopHit;
+                Get<"tHit">(top) += Get<"tHit">(*hit); // mean
+                *Get<"x">(top) += *Get<"x">(*hit);     // mean
+            }
+        }
+        Get<"tHit">(top) /= nTopHit; // mean
+        *Get<"x">(top) /= nTopHit;   // mean
+    }
+};
+
+template<>
+struct HitTraits<Data::TTCSimHit> {
+    static auto Channel(const Mustard::Data::Tuple<Data::TTCSimHit>& hit) -> int { return Get<"TileID">(hit); }
+    static auto MergingWindow() -> double {
+        const auto& ttc{Detector::Description::TTC::Instance()};
+        return ttc.ScintillationRiseTimeConstant1() + ttc.ScintillationDecayTimeConstant1();
+    }
+
+    static auto Shift(Mustard::Data::Tuple<Data::TTCSimHit>& hit, double dt) -> void {
+        Get<"t">(hit) += dt;
+        Get<"t0">(hit) += dt;
+    }
+
+    static auto Combine(Mustard::Data::Tuple<Data::TTCSimHit>& top, int topSource,
+                        std::span<const SourcedHit<Data::TTCSimHit>> cluster) -> void {
+        // nOptPho and ADC are counted per tile per event, add once per other source event
+        const auto AddTo{[](auto& sum, const auto& term) {
+            sum.resize(std::max(sum.size(), term.size()));
+            std::ranges::transform(term, sum, sum.begin(), std::plus{});
+        }};
+        std::vector<int> countedSource{topSource};
+        for (auto&& [hit, source] : cluster) {
+            if (hit.get() == &top) {
+                continue;
+            }
+            Get<"Edep">(top) += Get<"Edep">(*hit);
+            if (std::ranges::find(countedSource, source) == countedSource.cend()) {
+                AddTo(*Get<"nOptPho">(top), *Get<"nOptPho">(*hit));
+                AddTo(*Get<"ADC">(top), *Get<"ADC">(*hit));
+                countedSource.emplace_back(source);
+            }
+        }
+    }
+};
+
+} // namespace MACE::MixMACE
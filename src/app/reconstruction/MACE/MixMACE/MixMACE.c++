@@ -0,0 +1,96 @@
+#include "MACE/Data/SimHit.h++"
+#include "MACE/MixMACE/CLI.h++"
+#include "MACE/MixMACE/Mixer.h++"
+#include "MACE/MixMACE/MixMACE.h++"
+
+#include "Mustard/Env/BasicEnv.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+#include "Mustard/Parallel/ProcessSpecificPath.h++"
+#include "Mustard/ROOTX/MakeTextTMacro.h++"
+#include "Mustard/Utility/UseXoshiro.h++"
+
+#include "TFile.h"
+
+#include "mplr/mplr.hpp"
+
+#include "fmt/format.h"
+#include "fmt/ranges.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+namespace MACE::MixMACE {
+
+MixMACE::MixMACE() :
+    Subprogram{"MixMACE", "Overlay time-structured background onto simulation data (event mixing)."} {}
+
+auto MixMACE::Main(int argc, char* argv[]) const -> int {
+    CLI cli;
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+    Mustard::UseXoshiro<256> random{cli};
+
+    const auto outputPath{Mustard::Parallel::ProcessSpecificPath(cli.OutputFilePath()).replace_extension(".root").generic_string()};
+    TFile file{outputPath.c_str(), cli.OutputFileMode().c_str(), "", ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose};
+    if (not file.IsOpen()) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Cannot open file '{}' with mode '{}'", outputPath, cli.OutputFileMode()));
+    }
+
+    const auto background{cli.Background()};
+    const auto readoutWindow{cli.ReadoutWindow()};
+    const auto detector{cli.Detector()};
+    if (mplr::comm_world().rank() == 0) {
+        std::stringstream mixingConfigText;
+        fmt::print(mixingConfigText, "ReadoutWindow: [{}, {}]\nLookback: {}\nDetector: [{}]\nBackground:\n",
+                   readoutWindow.first, readoutWindow.second, cli.Lookback(), fmt::join(detector, ", "));
+        for (auto&& [bkgFile, rate] : background) {
+            fmt::print(mixingConfigText, "  - File: [{}]\n    Rate: {}\n", fmt::join(bkgFile, ", "), rate);
+        }
+        Mustard::ROOTX::MakeTextTMacro(mixingConfigText.str(), "MixingConfig", "Print MixMACE mixing configuration")->Write();
+    }
+
+    const auto Enabled{[&](auto&& name) { return std::ranges::find(detector, name) != detector.cend(); }};
+    const auto [iFirst, iLast]{cli.DatasetIndexRange()};
+    const auto TreeName{[](const std::string& nameFormat, gsl::index i) { return fmt::vformat(nameFormat, fmt::make_format_args(i)); }};
+    for (auto i{iFirst}; i < iLast; ++i) {
+        std::vector<std::string> signalTreeName;
+        std::vector<std::string> backgroundTreeName;
+        for (auto&& [name, nameFormat] : {std::pair{"CDC", cli.CDCSimHitNameFormat()},
+                                          std::pair{"ECAL", cli.ECALSimHitNameFormat()},
+                                          std::pair{"TTC", cli.TTCSimHitNameFormat()}}) {
+            if (Enabled(name)) {
+                signalTreeName.emplace_back(TreeName(nameFormat, i));
+                backgroundTreeName.emplace_back(TreeName(nameFormat, cli.BackgroundDatasetIndex()));
+            }
+        }
+
+        Mixer mixer{cli.InputFilePath(), background, readoutWindow, cli.Lookback()};
+        mixer.Plan(signalTreeName, backgroundTreeName);
+        if (Mustard::Env::VerboseLevelReach<'I'>()) {
+            std::array<long long, 2> count{mixer.NSignalEvent(), mixer.NOverlaidEvent()};
+            mplr::comm_world().reduce(
+                [](const std::array<long long, 2>& a, const std::array<long long, 2>& b) {
+                    return std::array{a[0] + b[0], a[1] + b[1]};
+                },
+                0, count);
+            Mustard::MasterPrintLn("Dataset {}: {} signal event(s), {} background event(s) overlaid", i, count[0], count[1]);
+        }
+        if (Enabled("CDC")) {
+            mixer.Mix<Data::CDCSimHit>(TreeName(cli.CDCSimHitNameFormat(), i), TreeName(cli.CDCSimHitNameFormat(), cli.BackgroundDatasetIndex()));
+        }
+        if (Enabled("ECAL")) {
+            mixer.Mix<Data::ECALSimHit>(TreeName(cli.ECALSimHitNameFormat(), i), TreeName(cli.ECALSimHitNameFormat(), cli.BackgroundDatasetIndex()));
+        }
+        if (Enabled("TTC")) {
+            mixer.Mix<Data::TTCSimHit>(TreeName(cli.TTCSimHitNameFormat(), i), TreeName(cli.TTCSimHitNameFormat(), cli.BackgroundDatasetIndex()));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::MixMACE
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::MixMACE {
+
+class MixMACE : public Mustard::Application::Subprogram {
+public:
+    MixMACE();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::MixMACE
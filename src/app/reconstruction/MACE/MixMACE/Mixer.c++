@@ -0,0 +1,88 @@
+#include "MACE/MixMACE/Mixer.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "ROOT/RDataFrame.hxx"
+#include "TRandom.h"
+
+#include "mplr/mplr.hpp"
+
+#include "fmt/format.h"
+#include "fmt/ranges.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+
+namespace MACE::MixMACE {
+
+namespace {
+
+auto NEvent(const std::vector<std::string>& treeName, const std::vector<std::string>& file) -> int {
+    int maxEvtID{-1};
+    for (auto&& name : treeName) {
+        maxEvtID = std::max(maxEvtID, *ROOT::RDataFrame{name, file}.Max<int>("EvtID"));
+    }
+    return maxEvtID + 1;
+}
+
+} // namespace
+
+Mixer::Mixer(std::vector<std::string> signalFile, std::vector<Library> background, std::pair<double, double> readoutWindow, double lookback) :
+    fSignalFile{std::move(signalFile)},
+    fBackground{std::move(background)},
+    fReadoutWindow{readoutWindow},
+    fLookback{lookback},
+    fEvtIDRange{},
+    fPlan{} {
+    if (fReadoutWindow.first >= fReadoutWindow.second) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Empty readout window [{}, {}]", fReadoutWindow.first, fReadoutWindow.second));
+    }
+    if (fLookback < 0) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Negative lookback time ({})", fLookback));
+    }
+}
+
+auto Mixer::Plan(const std::vector<std::string>& signalTreeName, const std::vector<std::string>& backgroundTreeName) -> void {
+    // signal: contiguous EvtID block of this process
+    const auto& worldComm{mplr::comm_world()};
+    const auto nSignal{static_cast<long long>(NEvent(signalTreeName, fSignalFile))};
+    fEvtIDRange = {static_cast<int>(nSignal * worldComm.rank() / worldComm.size()),
+                   static_cast<int>(nSignal * (worldComm.rank() + 1) / worldComm.size())};
+
+    // background: number of simulated events (i.e. decays) in each library
+    std::vector<int> nBackground;
+    nBackground.reserve(fBackground.size());
+    for (auto&& [file, rate] : fBackground) {
+        nBackground.emplace_back(NEvent(backgroundTreeName, file));
+        if (nBackground.back() == 0) {
+            Mustard::PrintWarning(fmt::format("Background library {} has no hit, ignoring it", fmt::join(file, ",")));
+        }
+    }
+
+    // overlay plan, shared by all detectors
+    const auto [windowBegin, windowEnd]{fReadoutWindow};
+    fPlan.clear();
+    fPlan.resize(NSignalEvent());
+    for (auto&& overlay : fPlan) {
+        for (int library{}; library < std::ssize(fBackground); ++library) {
+            if (nBackground[library] == 0) {
+                continue;
+            }
+            const auto n{static_cast<gsl::index>(gRandom->Poisson(fBackground[library].rate * (windowEnd - windowBegin + fLookback)))};
+            for (gsl::index i{}; i < n; ++i) {
+                overlay.push_back({library,
+                                   static_cast<int>(gRandom->Integer(nBackground[library])),
+                                   gRandom->Uniform(windowBegin - fLookback, windowEnd)});
+            }
+        }
+    }
+}
+
+auto Mixer::NOverlaidEvent() const -> gsl::index {
+    return std::transform_reduce(fPlan.cbegin(), fPlan.cend(), gsl::index{}, std::plus{},
+                                 [](auto&& overlay) { return std::ssize(overlay); });
+}
+
+} // namespace MACE::MixMACE
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "MACE/MixMACE/HitTraits.h++"
+
+#include "Mustard/Data/Output.h++"
+#include "Mustard/Data/Take.h++"
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include "ROOT/RDataFrame.hxx"
+
+#include "muc/hash_map"
+#include "muc/hash_set"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <span>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace MACE::MixMACE {
+
+/// @brief Overlays background events onto signal events.
+///
+/// Each background library is a separate simulation with true (unscaled) decay times,
+/// occurring at a given rate. For every signal event, the number of events from each library
+/// is Poisson distributed with mean rate x (lookback + window length), and each of them is
+/// shifted by a uniform time offset in [window begin - lookback, window end]; background hits
+/// ending up outside the readout window are dropped. The overlay plan is drawn once per
+/// signal event, so that the same background events appear in all detectors.
+/// Hits are then re-merged per channel with the detector's time resolution (see HitTraits).
+/// Background tracks get negative TrkID, so truth matching can tell them from signal.
+///
+/// Signal events are split into contiguous EvtID blocks over processes; background libraries
+/// are read in full by every process.
+class Mixer {
+public:
+    struct Library {
+        std::vector<std::string> file;
+        double rate;
+    };
+
+public:
+    Mixer(std::vector<std::string> signalFile, std::vector<Library> background, std::pair<double, double> readoutWindow, double lookback);
+
+    auto Plan(const std::vector<std::string>& signalTreeName, const std::vector<std::string>& backgroundTreeName) -> void;
+
+    template<Mustard::Data::TupleModelizable AModel>
+    auto Mix(const std::string& signalTreeName, const std::string& backgroundTreeName) const -> void;
+
+    auto NSignalEvent() const -> auto { return fEvtIDRange.second - fEvtIDRange.first; }
+    auto NOverlaidEvent() const -> gsl::index;
+
+private:
+    struct Overlay {
+        int library;
+        int evtID;
+        double offset;
+    };
+
+private:
+    std::vector<std::string> fSignalFile;
+    std::vector<Library> fBackground;
+    std::pair<double, double> fReadoutWindow;
+    double fLookback;
+
+    std::pair<int, int> fEvtIDRange;
+    std::vector<std::vector<Overlay>> fPlan;
+};
+
+} // namespace MACE::MixMACE
+
+#include "MACE/MixMACE/Mixer.inl"
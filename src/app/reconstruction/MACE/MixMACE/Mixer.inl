@@ -0,0 +1,105 @@
+namespace MACE::MixMACE {
+
+template<Mustard::Data::TupleModelizable AModel>
+auto Mixer::Mix(const std::string& signalTreeName, const std::string& backgroundTreeName) const -> void {
+    using Hit = Mustard::Data::Tuple<AModel>;
+    using EventHit = muc::flat_hash_map<int, std::vector<std::shared_ptr<Hit>>>;
+    const auto GroupByEvent{[](std::vector<std::shared_ptr<Hit>> hit) {
+        EventHit event;
+        for (auto&& h : hit) {
+            event[Get<"EvtID">(*h)].emplace_back(std::move(h));
+        }
+        return event;
+    }};
+
+    // signal of this process
+    const auto [evtIDFirst, evtIDLast]{fEvtIDRange};
+    const auto signal{GroupByEvent(Mustard::Data::Take<AModel>::From(
+        ROOT::RDataFrame{signalTreeName, fSignalFile}.Filter(
+            [evtIDFirst, evtIDLast](int evtID) { return evtIDFirst <= evtID and evtID < evtIDLast; }, {"EvtID"})))};
+
+    // background events used by this process
+    std::vector<EventHit> background;
+    background.reserve(fBackground.size());
+    for (int library{}; library < std::ssize(fBackground); ++library) {
+        muc::flat_hash_set<int> used;
+        for (auto&& overlay : fPlan) {
+            for (auto&& [l, evtID, _] : overlay) {
+                if (l == library) {
+                    used.emplace(evtID);
+                }
+            }
+        }
+        background.emplace_back(GroupByEvent(Mustard::Data::Take<AModel>::From(
+            ROOT::RDataFrame{backgroundTreeName, fBackground[library].file}.Filter(
+                [&used](int evtID) { return used.contains(evtID); }, {"EvtID"}))));
+    }
+
+    Mustard::Data::Output<AModel> output{signalTreeName};
+    const auto [windowBegin, windowEnd]{fReadoutWindow};
+    const auto mergingWindow{HitTraits<AModel>::MergingWindow()};
+    std::vector<SourcedHit<AModel>> eventHit;
+    for (auto evtID{evtIDFirst}; evtID < evtIDLast; ++evtID) {
+        eventHit.clear();
+        if (const auto s{signal.find(evtID)}; s != signal.cend()) {
+            for (auto&& hit : s->second) {
+                eventHit.push_back({hit, 0});
+            }
+        }
+        for (int source{1}; auto&& [library, bkgEvtID, offset] : fPlan[evtID - evtIDFirst]) {
+            if (const auto b{background[library].find(bkgEvtID)}; b != background[library].cend()) {
+                for (auto&& bkgHit : b->second) {
+                    if (const auto t{*Get<"t">(*bkgHit) + offset};
+                        t < windowBegin or t > windowEnd) {
+                        continue;
+                    }
+                    // the same background event may be overlaid more than once, copy
+                    auto hit{std::make_shared<Hit>(*bkgHit)};
+                    HitTraits<AModel>::Shift(*hit, offset);
+                    Get<"TrkID">(*hit) = -*Get<"TrkID">(*hit);
+                    eventHit.push_back({std::move(hit), source});
+                }
+            }
+            ++source;
+        }
+        if (eventHit.empty()) {
+            continue;
+        }
+
+        // re-merge hits per channel, as in the sensitive detector
+        std::ranges::sort(eventHit, [](auto&& hit1, auto&& hit2) {
+            return std::pair{HitTraits<AModel>::Channel(*hit1.hit), *Get<"t">(*hit1.hit)} <
+                   std::pair{HitTraits<AModel>::Channel(*hit2.hit), *Get<"t">(*hit2.hit)};
+        });
+        std::vector<std::shared_ptr<Hit>> mergedHit;
+        for (auto clusterBegin{eventHit.begin()}; clusterBegin != eventHit.end();) {
+            const auto channel{HitTraits<AModel>::Channel(*clusterBegin->hit)};
+            const auto windowClosingTime{*Get<"t">(*clusterBegin->hit) + mergingWindow};
+            const auto clusterEnd{std::find_if_not(clusterBegin, eventHit.end(), [&](auto&& hit) {
+                return HitTraits<AModel>::Channel(*hit.hit) == channel and Get<"t">(*hit.hit) <= windowClosingTime;
+            })};
+            const std::span cluster{clusterBegin, clusterEnd};
+            // top hit: signal first, then the smallest track ID
+            const auto& [topHit, topSource]{*std::ranges::min_element(cluster, [](auto&& hit1, auto&& hit2) {
+                const auto Key{[](auto&& hit) { return std::pair{hit.source != 0, std::abs(*Get<"TrkID">(*hit.hit))}; }};
+                return Key(hit1) < Key(hit2);
+            })};
+            HitTraits<AModel>::Combine(*topHit, topSource, cluster);
+            mergedHit.emplace_back(topHit);
+            clusterBegin = clusterEnd;
+        }
+
+        std::ranges::sort(mergedHit, [](auto&& hit1, auto&& hit2) {
+            return std::tie(Get<"TrkID">(*hit1), Get<"t">(*hit1)) < std::tie(Get<"TrkID">(*hit2), Get<"t">(*hit2));
+        });
+        for (int hitID{}; auto&& hit : mergedHit) {
+            Get<"EvtID">(*hit) = evtID;
+            Get<"HitID">(*hit) = hitID++;
+            output.Fill(*hit);
+        }
+    }
+
+    output.Write();
+}
+
+} // namespace MACE::MixMACE
@@ -0,0 +1,5 @@
+# $1: signal file, $2: background library file, $3: background rate (Hz)
+MixMACE $1 \
+    --background $2 $3 \
+    --readout-window -1000 1000 \
+    --lookback 1000
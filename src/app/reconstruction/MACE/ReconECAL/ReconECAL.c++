@@ -1,3 +1,4 @@
+#include "MACE/Data/Cluster.h++"
 #include "MACE/Data/SimHit.h++"
 #include "MACE/Detector/Description/ECAL.h++"
 #include "MACE/ReconECAL/ReconECAL.h++"
@@ -22,11 +23,13 @@
 #include "TTree.h"
 
 #include "muc/algorithm"
+#include "muc/array"
 
 #include "fmt/format.h"
 
 #include <algorithm>
 #include <ranges>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -68,13 +71,15 @@ auto ReconECAL::Main(int argc, char* argv[]) const -> int {
     }
 
     TFile outputFile{Mustard::Parallel::ProcessSpecificPath("dual_coin.root").generic_string().c_str(), "RECREATE"};
-    using ECALEnergy = Mustard::Data::TupleModel<Mustard::Data::Value<float, "Edep", "Energy deposition">,
+    using ECALEnergy = Mustard::Data::TupleModel<Mustard::Data::Value<int, "EvtID", "Event ID">,
+                                                 Mustard::Data::Value<float, "Edep", "Energy deposition">,
                                                  Mustard::Data::Value<float, "Edep1", "Energy deposition 1">,
                                                  Mustard::Data::Value<float, "Edep2", "Energy deposition 2">,
                                                  Mustard::Data::Value<float, "dE", "Delta energy">,
                                                  Mustard::Data::Value<double, "theta", "angel">,
                                                  Mustard::Data::Value<double, "dt0", "Delta time">>;
     Mustard::Data::Output<ECALEnergy> reconEnergy{"G4Run0/ReconECAL"};
+    Mustard::Data::Output<Data::ECALCluster> reconCluster{"G4Run0/ECALCluster"};
 
     Mustard::Data::Processor processor;
     processor.Process<Data::ECALSimHit>(
@@ -108,7 +113,9 @@ auto ReconECAL::Main(int argc, char* argv[]) const -> int {
             auto firstSeedModule = potentialSeedModule.begin();
             auto secondSeedModule = std::ranges::next(potentialSeedModule.begin());
 
-            const auto Clustering = [&](std::unordered_set<short>& set, std::vector<short>::iterator it) {
+            CLHEP::Hep3Vector firstCentroid;
+            CLHEP::Hep3Vector secondCentroid;
+            const auto Clustering = [&](std::unordered_set<short>& set, std::vector<short>::iterator it, CLHEP::Hep3Vector& centroid) {
                 set.insert(*it); // add seed module
                 for (auto&& m : faceList[*it].neighborModuleID) {
                     set.insert(m); // add 1st layer
@@ -119,23 +126,43 @@ auto ReconECAL::Main(int argc, char* argv[]) const -> int {
                 }
 
                 float energy{};
+                centroid = {};
                 for (auto&& m : set) {
                     if (not hitDict.contains(m) or Get<"Edep">(*hitDict.at(m)) < 50_keV) {
                         continue;
                     }
-                    energy += smear(Get<"Edep">(*hitDict.at(m)));
+                    const auto e{smear(Get<"Edep">(*hitDict.at(m)))};
+                    energy += e;
+                    centroid += e * centroidMap.at(m);
+                }
+                if (energy > 0) {
+                    centroid /= energy;
                 }
                 return energy;
             };
 
-            auto firstClusterEnergy = Clustering(firstCluster, firstSeedModule);
-            auto secondClusterEnergy = Clustering(secondCluster, secondSeedModule);
+            auto firstClusterEnergy = Clustering(firstCluster, firstSeedModule, firstCentroid);
+            auto secondClusterEnergy = Clustering(secondCluster, secondSeedModule, secondCentroid);
 
             if (firstClusterEnergy > 590_keV or secondClusterEnergy > 590_keV) {
                 return;
             }
 
+            for (int clusterID{}; auto&& [seed, cluster, energy, centroid] : {std::tuple{*firstSeedModule, &firstCluster, firstClusterEnergy, firstCentroid},
+                                                                             std::tuple{*secondSeedModule, &secondCluster, secondClusterEnergy, secondCentroid}}) {
+                Mustard::Data::Tuple<Data::ECALCluster> clusterTuple;
+                Get<"EvtID">(clusterTuple) = Get<"EvtID">(*hitDict.at(seed));
+                Get<"ClsID">(clusterTuple) = clusterID++;
+                Get<"SeedID">(clusterTuple) = seed;
+                Get<"ModID">(clusterTuple)->assign(cluster->begin(), cluster->end());
+                Get<"t">(clusterTuple) = *Get<"t">(*hitDict.at(seed));
+                Get<"Edep">(clusterTuple) = energy;
+                Get<"x">(clusterTuple) = muc::array3d{centroid.x(), centroid.y(), centroid.z()};
+                reconCluster.Fill(std::move(clusterTuple));
+            }
+
             Mustard::Data::Tuple<ECALEnergy> energyTuple;
+            Get<"EvtID">(energyTuple) = Get<"EvtID">(*hitDict.at(*firstSeedModule));
             Get<"Edep">(energyTuple) = firstClusterEnergy + secondClusterEnergy;
             Get<"Edep1">(energyTuple) = firstClusterEnergy;
             Get<"Edep2">(energyTuple) = secondClusterEnergy;
@@ -146,6 +173,7 @@ auto ReconECAL::Main(int argc, char* argv[]) const -> int {
         });
 
     reconEnergy.Write();
+    reconCluster.Write();
 
     return EXIT_SUCCESS;
 }
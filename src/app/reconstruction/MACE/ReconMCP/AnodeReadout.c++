@@ -0,0 +1,204 @@
+#include "MACE/Detector/Description/MCP.h++"
+#include "MACE/ReconMCP/AnodeReadout.h++"
+
+#include "TRandom.h"
+
+#include "muc/hash_map"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <tuple>
+
+namespace MACE::ReconMCP {
+
+AnodeReadout::AnodeReadout() :
+    fStrip{},
+    fPitch{},
+    fN{},
+    fCloudSigma{},
+    fGainMean{},
+    fGainResolution{},
+    fNoise{},
+    fThreshold{},
+    fTimeResolution{},
+    fTimeWindow{},
+    fDeadChannel{} {
+    const auto& mcp{Detector::Description::MCP::Instance()};
+    fStrip = mcp.AnodeStrip();
+    fPitch = mcp.AnodePitch();
+    fN = mcp.NAnodeChannelPerSide();
+    fCloudSigma = mcp.ChargeCloudSigma();
+    fGainMean = mcp.GainMean();
+    fGainResolution = mcp.GainResolution();
+    fNoise = mcp.ChannelNoise();
+    fThreshold = mcp.ChannelThreshold();
+    fTimeResolution = mcp.TimeResolutionFWHM() / (2 * std::sqrt(2 * std::numbers::ln2));
+    fTimeWindow = mcp.TimeResolutionFWHM();
+    fDeadChannel.insert(mcp.DeadChannel().cbegin(), mcp.DeadChannel().cend());
+}
+
+auto AnodeReadout::Amplify(muc::array2d x, double t) const -> Avalanche {
+    return {x, gRandom->Gaus(t, fTimeResolution), std::max(0., gRandom->Gaus(fGainMean, fGainResolution * fGainMean))};
+}
+
+auto AnodeReadout::Digitize(const std::vector<Avalanche>& avalanche) const -> std::vector<ChannelHit> {
+    muc::flat_hash_map<int, std::pair<double, double>> sum; // channel -> (charge, charge * time)
+    const auto Add{[&](int channelID, double charge, double t) {
+        auto& [q, qt]{sum[channelID]};
+        q += charge;
+        qt += charge * t;
+    }};
+    for (auto&& [x, t, charge] : avalanche) {
+        const auto shareX{Share(x[0])};
+        const auto shareY{Share(x[1])};
+        if (fStrip) {
+            for (auto&& [i, f] : shareX) {
+                Add(i, charge / 2 * f, t);
+            }
+            for (auto&& [j, f] : shareY) {
+                Add(fN + j, charge / 2 * f, t);
+            }
+        } else {
+            for (auto&& [i, fx] : shareX) {
+                for (auto&& [j, fy] : shareY) {
+                    Add(j * fN + i, charge * fx * fy, t);
+                }
+            }
+        }
+    }
+
+    std::vector<ChannelHit> channelHit;
+    for (auto&& [channelID, value] : sum) {
+        const auto& [q, qt]{value};
+        const auto charge{q + gRandom->Gaus(0, fNoise)};
+        if (q <= 0 or charge < fThreshold or fDeadChannel.contains(channelID)) {
+            continue;
+        }
+        channelHit.push_back({channelID, charge, qt / q});
+    }
+    std::ranges::sort(channelHit, {}, &ChannelHit::channelID);
+    return channelHit;
+}
+
+auto AnodeReadout::Clusterize(const std::vector<ChannelHit>& channelHit) const -> std::vector<Cluster> {
+    return fStrip ? StripCluster(channelHit) : PixelCluster(channelHit);
+}
+
+auto AnodeReadout::Share(double x) const -> std::vector<std::pair<int, double>> {
+    const auto i0{static_cast<int>(std::floor((x + fN * fPitch / 2) / fPitch))};
+    if (fCloudSigma <= 0) {
+        if (0 <= i0 and i0 < fN) {
+            return {{i0, 1}};
+        }
+        return {};
+    }
+    const auto CDF{[&](double edge) { return std::erfc((x - edge) / (std::numbers::sqrt2 * fCloudSigma)) / 2; }};
+    const auto reach{static_cast<int>(std::ceil(4 * fCloudSigma / fPitch))};
+    std::vector<std::pair<int, double>> share;
+    for (auto i{std::max(0, i0 - reach)}; i <= std::min(fN - 1, i0 + reach); ++i) {
+        if (const auto f{CDF(Center(i) + fPitch / 2) - CDF(Center(i) - fPitch / 2)};
+            f > 0) {
+            share.emplace_back(i, f);
+        }
+    }
+    return share;
+}
+
+template<typename ANeighbor>
+auto AnodeReadout::Group(const std::vector<ChannelHit>& channelHit, ANeighbor&& Neighbor) const -> std::vector<std::vector<const ChannelHit*>> {
+    std::vector<std::vector<const ChannelHit*>> group;
+    std::vector<bool> grouped(channelHit.size());
+    for (gsl::index seed{}; seed < std::ssize(channelHit); ++seed) {
+        if (grouped[seed]) {
+            continue;
+        }
+        grouped[seed] = true;
+        auto& member{group.emplace_back(1, &channelHit[seed])};
+        for (gsl::index k{}; k < std::ssize(member); ++k) {
+            for (gsl::index i{}; i < std::ssize(channelHit); ++i) {
+                if (not grouped[i] and
+                    Neighbor(member[k]->channelID, channelHit[i].channelID) and
+                    std::abs(member[k]->t - channelHit[i].t) <= fTimeWindow) {
+                    grouped[i] = true;
+                    member.emplace_back(&channelHit[i]);
+                }
+            }
+        }
+    }
+    return group;
+}
+
+auto AnodeReadout::PixelCluster(const std::vector<ChannelHit>& channelHit) const -> std::vector<Cluster> {
+    std::vector<Cluster> cluster;
+    for (auto&& group : Group(channelHit, [this](int a, int b) {
+             return std::abs(a % fN - b % fN) <= 1 and std::abs(a / fN - b / fN) <= 1;
+         })) {
+        double q{};
+        double qx{};
+        double qy{};
+        double qt{};
+        for (auto&& hit : group) {
+            q += hit->charge;
+            qx += hit->charge * Center(hit->channelID % fN);
+            qy += hit->charge * Center(hit->channelID / fN);
+            qt += hit->charge * hit->t;
+        }
+        cluster.push_back({{qx / q, qy / q}, qt / q, q, static_cast<int>(group.size())});
+    }
+    return cluster;
+}
+
+auto AnodeReadout::StripCluster(const std::vector<ChannelHit>& channelHit) const -> std::vector<Cluster> {
+    // 1-D clusters on each layer
+    std::vector<ChannelHit> stripHit[2];
+    for (auto&& hit : channelHit) {
+        const auto layer{hit.channelID < fN ? 0 : 1};
+        stripHit[layer].push_back({hit.channelID - layer * fN, hit.charge, hit.t});
+    }
+    std::vector<Cluster> layerCluster[2];
+    for (auto layer : {0, 1}) {
+        for (auto&& group : Group(stripHit[layer], [](int a, int b) { return std::abs(a - b) <= 1; })) {
+            double q{};
+            double qx{};
+            double qt{};
+            for (auto&& hit : group) {
+                q += hit->charge;
+                qx += hit->charge * Center(hit->channelID);
+                qt += hit->charge * hit->t;
+            }
+            layerCluster[layer].push_back({{qx / q, 0}, qt / q, q, static_cast<int>(group.size())});
+        }
+    }
+
+    // pair x and y clusters of the same avalanche, best charge agreement first
+    std::vector<std::tuple<double, gsl::index, gsl::index>> candidate;
+    for (gsl::index i{}; i < std::ssize(layerCluster[0]); ++i) {
+        for (gsl::index j{}; j < std::ssize(layerCluster[1]); ++j) {
+            const auto& cx{layerCluster[0][i]};
+            const auto& cy{layerCluster[1][j]};
+            if (std::abs(cx.t - cy.t) <= fTimeWindow) {
+                candidate.emplace_back(std::abs(cx.charge - cy.charge) / (cx.charge + cy.charge), i, j);
+            }
+        }
+    }
+    std::ranges::sort(candidate);
+    std::vector<bool> paired[2]{std::vector<bool>(layerCluster[0].size()), std::vector<bool>(layerCluster[1].size())};
+    std::vector<Cluster> cluster;
+    for (auto&& [_, i, j] : candidate) {
+        if (paired[0][i] or paired[1][j]) {
+            continue;
+        }
+        paired[0][i] = true;
+        paired[1][j] = true;
+        const auto& cx{layerCluster[0][i]};
+        const auto& cy{layerCluster[1][j]};
+        const auto q{cx.charge + cy.charge};
+        cluster.push_back({{cx.x[0], cy.x[0]}, (cx.charge * cx.t + cy.charge * cy.t) / q, q, cx.nChannel + cy.nChannel});
+    }
+    return cluster;
+}
+
+} // namespace MACE::ReconMCP
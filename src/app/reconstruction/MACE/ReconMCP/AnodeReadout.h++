@@ -0,0 +1,74 @@
+#pragma once
+
+#include "muc/array"
+#include "muc/hash_set"
+
+#include <utility>
+#include <vector>
+
+namespace MACE::ReconMCP {
+
+/// @brief MCP anode readout, configured from the MCP description.
+///
+/// The electron cloud of an avalanche is a 2-D Gaussian on the anode, shared over pixels or
+/// (equally between the two layers) over crossed x/y strips. Channels add the charge of all
+/// avalanches of an event, get Gaussian noise, and fire above threshold unless dead.
+/// Fired channels are clustered (pixels: 8-connected, strips: adjacent, then x and y
+/// clusters paired by charge), all within the MCP time resolution, and the cluster
+/// position and time are charge-weighted.
+class AnodeReadout {
+public:
+    struct Avalanche {
+        muc::array2d x;
+        double t;
+        double charge;
+    };
+
+    struct ChannelHit {
+        int channelID;
+        double charge;
+        double t;
+    };
+
+    struct Cluster {
+        muc::array2d x;
+        double t;
+        double charge;
+        int nChannel;
+    };
+
+public:
+    AnodeReadout();
+
+    auto TimeWindow() const -> auto { return fTimeWindow; }
+
+    /// @brief The avalanche of a detected hit, with a random gain and the time resolution applied.
+    auto Amplify(muc::array2d x, double t) const -> Avalanche;
+    auto Digitize(const std::vector<Avalanche>& avalanche) const -> std::vector<ChannelHit>;
+    auto Clusterize(const std::vector<ChannelHit>& channelHit) const -> std::vector<Cluster>;
+
+private:
+    auto Center(int i) const -> double { return (i + 0.5) * fPitch - fN * fPitch / 2; }
+    /// @brief Fractions of charge centered at x on channels along a side, as (index, fraction).
+    auto Share(double x) const -> std::vector<std::pair<int, double>>;
+    auto PixelCluster(const std::vector<ChannelHit>& channelHit) const -> std::vector<Cluster>;
+    auto StripCluster(const std::vector<ChannelHit>& channelHit) const -> std::vector<Cluster>;
+    /// @brief Groups of channel hits connected by Neighbor and the time window.
+    template<typename ANeighbor>
+    auto Group(const std::vector<ChannelHit>& channelHit, ANeighbor&& Neighbor) const -> std::vector<std::vector<const ChannelHit*>>;
+
+private:
+    bool fStrip;
+    double fPitch;
+    int fN;
+    double fCloudSigma;
+    double fGainMean;
+    double fGainResolution;
+    double fNoise;
+    double fThreshold;
+    double fTimeResolution;
+    double fTimeWindow;
+    muc::flat_hash_set<int> fDeadChannel;
+};
+
+} // namespace MACE::ReconMCP
@@ -0,0 +1,80 @@
+#include "MACE/ReconMCP/CLI.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include <cassert>
+#include <cstdlib>
+
+namespace MACE::ReconMCP {
+
+CLIModule::CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli) :
+    ModuleBase{cli} {
+    TheCLI()
+        ->add_argument("input")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .help("Input file path(s), with MCP hits.");
+    TheCLI()
+        ->add_argument("-o", "--output")
+        .help("Output file path. Suffix '_mcp' on input file name by default.");
+    TheCLI()
+        ->add_argument("-m", "--output-mode")
+        .help("Output file creation mode. Default to 'NEW'.");
+
+    TheCLI()
+        ->add_argument("-i", "--index-range")
+        .nargs(1, 2)
+        .scan<'i', gsl::index>()
+        .default_value(std::vector<gsl::index>{0, 1})
+        .help("Set number of datasets (index in [0, size) range), or index range (in [first, last) pattern)");
+
+    TheCLI()
+        ->add_argument("--match-radius")
+        .scan<'g', double>()
+        .default_value(2.)
+        .help("A reconstructed hit matches an MCP hit (MC truth) within this distance (mm). Default to 2.");
+    TheCLI()
+        ->add_argument("--map-bin")
+        .scan<'i', int>()
+        .default_value(50)
+        .help("Number of bins along x and y of the efficiency and resolution maps. Default to 50.");
+
+    TheCLI()
+        ->add_argument("--mcp-hit-name")
+        .help("Set MCP hit dataset name format. Default to 'G4Run{}/MCPSimHit'.");
+    TheCLI()
+        ->add_argument("--mcp-recon-hit-name")
+        .help("Set output reconstructed MCP hit dataset name format. Default to 'G4Run{}/MCPReconHit'.");
+    TheCLI()
+        ->add_argument("--mcp-map-name")
+        .help("Set output map name prefix format, followed by 'Efficiency', 'ResolutionX' and 'ResolutionY'. Default to 'G4Run{}/MCP'.");
+}
+
+auto CLIModule::OutputFilePath() const -> std::filesystem::path {
+    if (auto output{TheCLI()->present("-o")}) {
+        return *std::move(output);
+    }
+    auto inputList{InputFilePath()};
+    if (inputList.size() > 1) {
+        Mustard::PrintError("Cannot automatically construct output file path since # input file path > 1. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    if (inputList.front().find('*') != std::string::npos) {
+        Mustard::PrintError("Cannot automatically construct output file path since input file path includes wildcards. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    std::filesystem::path input{std::move(inputList.front())};
+    const auto extension{input.extension()};
+    return input.replace_extension().concat("_mcp").replace_extension(extension);
+}
+
+auto CLIModule::DatasetIndexRange() const -> std::pair<gsl::index, gsl::index> {
+    auto var{TheCLI()->get<std::vector<gsl::index>>("-i")};
+    assert(var.size() == 1 or var.size() == 2);
+    if (var.size() == 1) {
+        return {0, var.front()};
+    } else {
+        return {var.front(), var.back()};
+    }
+}
+
+} // namespace MACE::ReconMCP
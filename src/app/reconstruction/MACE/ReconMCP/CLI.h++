@@ -0,0 +1,44 @@
+#pragma once
+
+#include "MACE/Detector/Description/MCP.h++"
+
+#include "Mustard/CLI/CLI.h++"
+#include "Mustard/CLI/Module/BasicModule.h++"
+#include "Mustard/CLI/Module/DetectorDescriptionModule.h++"
+#include "Mustard/CLI/Module/ModuleBase.h++"
+#include "Mustard/CLI/Module/MonteCarloModule.h++"
+
+#include "gsl/gsl"
+
+#include <filesystem>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace MACE::ReconMCP {
+
+class CLIModule : public Mustard::CLI::ModuleBase {
+public:
+    CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli);
+
+    auto InputFilePath() const -> auto { return TheCLI()->get<std::vector<std::string>>("input"); }
+    auto OutputFileMode() const -> auto { return TheCLI()->present("-m").value_or("NEW"); }
+    auto OutputFilePath() const -> std::filesystem::path;
+
+    auto DatasetIndexRange() const -> std::pair<gsl::index, gsl::index>;
+
+    auto MatchRadius() const -> auto { return TheCLI()->get<double>("--match-radius"); }
+    auto NMapBin() const -> auto { return TheCLI()->get<int>("--map-bin"); }
+
+    auto MCPHitNameFormat() const -> auto { return TheCLI()->present("--mcp-hit-name").value_or("G4Run{}/MCPSimHit"); }
+    auto MCPReconHitNameFormat() const -> auto { return TheCLI()->present("--mcp-recon-hit-name").value_or("G4Run{}/MCPReconHit"); }
+    auto MCPMapNameFormat() const -> auto { return TheCLI()->present("--mcp-map-name").value_or("G4Run{}/MCP"); }
+};
+
+using CLI = Mustard::CLI::CLI<Mustard::CLI::BasicModule,
+                              Mustard::CLI::MonteCarloModule,
+                              Mustard::CLI::DetectorDescriptionModule<std::tuple<MACE::Detector::Description::MCP>>,
+                              CLIModule>;
+
+} // namespace MACE::ReconMCP
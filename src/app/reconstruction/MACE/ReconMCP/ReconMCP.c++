@@ -0,0 +1,208 @@
+#include "MACE/Data/SimHit.h++"
+#include "MACE/Detector/Description/MCP.h++"
+#include "MACE/ReconMCP/AnodeReadout.h++"
+#include "MACE/ReconMCP/CLI.h++"
+#include "MACE/ReconMCP/ReconMCP.h++"
+
+#include "Mustard/Data/Output.h++"
+#include "Mustard/Data/Processor.h++"
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/Value.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Parallel/ProcessSpecificPath.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+#include "Mustard/Utility/UseXoshiro.h++"
+
+#include "ROOT/RDataFrame.hxx"
+#include "TEfficiency.h"
+#include "TFile.h"
+#include "TProfile2D.h"
+
+#include "mplr/mplr.hpp"
+
+#include "mpi.h"
+
+#include "muc/array"
+#include "muc/math"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace MACE::ReconMCP {
+
+namespace {
+
+using MCPReconHit = Mustard::Data::TupleModel<
+    Mustard::Data::Value<int, "EvtID", "Event ID">,
+    Mustard::Data::Value<int, "ClsID", "Cluster ID">,
+    Mustard::Data::Value<short, "NChannel", "Number of fired anode channels">,
+    Mustard::Data::Value<double, "t", "Reconstructed hit time">,
+    Mustard::Data::Value<float, "Charge", "Cluster charge (number of electrons)">,
+    Mustard::Data::Value<muc::array2f, "x", "Reconstructed hit position">,
+    Mustard::Data::Value<int, "HitID", "Matched MCP hit ID (MC truth), -1 if unmatched">,
+    Mustard::Data::Value<int, "TrkID", "Track ID of the matched hit (MC truth)">,
+    Mustard::Data::Value<double, "tTrue", "Matched hit time (MC truth)">,
+    Mustard::Data::Value<muc::array2f, "xTrue", "Matched hit position (MC truth)">>;
+
+} // namespace
+
+using namespace Mustard::LiteralUnit::Length;
+
+ReconMCP::ReconMCP() :
+    Subprogram{"ReconMCP", "Microchannel plate (MCP) anode digitization and hit reconstruction."} {}
+
+auto ReconMCP::Main(int argc, char* argv[]) const -> int {
+    CLI cli;
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+    Mustard::UseXoshiro<256> random{cli};
+
+    const auto& mcp{Detector::Description::MCP::Instance()};
+    const AnodeReadout readout;
+    const auto matchRadius{cli.MatchRadius() * 1_mm};
+    const auto nBin{cli.NMapBin()};
+    if (nBin < 1) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Number of map bins ({}) should be at least 1", nBin));
+    }
+    const auto halfSize{mcp.Diameter() / 2};
+
+    const auto outputPath{Mustard::Parallel::ProcessSpecificPath(cli.OutputFilePath()).replace_extension(".root").generic_string()};
+    TFile file{outputPath.c_str(), cli.OutputFileMode().c_str(), "", ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose};
+    if (not file.IsOpen()) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Cannot open file '{}' with mode '{}'", outputPath, cli.OutputFileMode()));
+    }
+
+    std::array<unsigned long long, 2> count{}; // MCP hits, matched hits
+    std::array<double, 2> sumResidual2{};
+    const auto [iFirst, iLast]{cli.DatasetIndexRange()};
+    const auto TreeName{[](const std::string& nameFormat, gsl::index i) { return fmt::vformat(nameFormat, fmt::make_format_args(i)); }};
+    for (auto i{iFirst}; i < iLast; ++i) {
+        Mustard::Data::Output<MCPReconHit> reconHitOutput{TreeName(cli.MCPReconHitNameFormat(), i)};
+
+        // maps over the MCP plane, truth position
+        const std::filesystem::path mapPath{TreeName(cli.MCPMapNameFormat(), i)};
+        const auto prefix{mapPath.filename().generic_string()};
+        TEfficiency efficiency{(prefix + "Efficiency").c_str(), "MCP hit efficiency;x (mm);y (mm)",
+                               nBin, -halfSize, halfSize, nBin, -halfSize, halfSize};
+        TProfile2D resolutionX{(prefix + "ResolutionX").c_str(), "MCP x resolution;x (mm);y (mm);x_{rec} - x_{true} (mm)",
+                               nBin, -halfSize, halfSize, nBin, -halfSize, halfSize, "s"};
+        TProfile2D resolutionY{(prefix + "ResolutionY").c_str(), "MCP y resolution;x (mm);y (mm);y_{rec} - y_{true} (mm)",
+                               nBin, -halfSize, halfSize, nBin, -halfSize, halfSize, "s"};
+        efficiency.SetDirectory(nullptr);
+        resolutionX.SetDirectory(nullptr);
+        resolutionY.SetDirectory(nullptr);
+
+        Mustard::Data::Processor processor;
+        processor.Process<Data::MCPSimHit>(
+            ROOT::RDataFrame{TreeName(cli.MCPHitNameFormat(), i), cli.InputFilePath()}, int{}, "EvtID",
+            [&](bool byPass, auto&& event) {
+                if (byPass) {
+                    return;
+                }
+                std::vector<AnodeReadout::Avalanche> avalanche;
+                for (auto&& hit : event) {
+                    if (*Get<"Trig">(*hit)) {
+                        avalanche.emplace_back(readout.Amplify(Get<"x">(*hit).template As<muc::array2d>(), *Get<"t">(*hit)));
+                    }
+                }
+                const auto cluster{readout.Clusterize(readout.Digitize(avalanche))};
+
+                // truth matching, closest pairs first
+                std::vector<std::tuple<double, gsl::index, gsl::index>> candidate; // (distance, hit, cluster)
+                for (gsl::index h{}; h < std::ssize(event); ++h) {
+                    if (not *Get<"Trig">(*event[h])) {
+                        continue;
+                    }
+                    const auto x{Get<"x">(*event[h]).template As<muc::array2d>()};
+                    for (gsl::index c{}; c < std::ssize(cluster); ++c) {
+                        if (const auto d{std::hypot(cluster[c].x[0] - x[0], cluster[c].x[1] - x[1])};
+                            d <= matchRadius) {
+                            candidate.emplace_back(d, h, c);
+                        }
+                    }
+                }
+                std::ranges::sort(candidate);
+                std::vector<gsl::index> clusterOfHit(event.size(), -1);
+                std::vector<gsl::index> hitOfCluster(cluster.size(), -1);
+                for (auto&& [_, h, c] : candidate) {
+                    if (clusterOfHit[h] < 0 and hitOfCluster[c] < 0) {
+                        clusterOfHit[h] = c;
+                        hitOfCluster[c] = h;
+                    }
+                }
+
+                const auto evtID{*Get<"EvtID">(*event.front())};
+                for (gsl::index c{}; c < std::ssize(cluster); ++c) {
+                    const auto& [x, t, charge, nChannel]{cluster[c]};
+                    Mustard::Data::Tuple<MCPReconHit> reconHit;
+                    Get<"EvtID">(reconHit) = evtID;
+                    Get<"ClsID">(reconHit) = c;
+                    Get<"NChannel">(reconHit) = nChannel;
+                    Get<"t">(reconHit) = t;
+                    Get<"Charge">(reconHit) = charge;
+                    Get<"x">(reconHit) = x;
+                    if (const auto h{hitOfCluster[c]}; h >= 0) {
+                        const auto& hit{*event[h]};
+                        Get<"HitID">(reconHit) = *Get<"HitID">(hit);
+                        Get<"TrkID">(reconHit) = *Get<"TrkID">(hit);
+                        Get<"tTrue">(reconHit) = *Get<"t">(hit);
+                        Get<"xTrue">(reconHit) = *Get<"x">(hit);
+                    } else {
+                        Get<"HitID">(reconHit) = -1;
+                        Get<"TrkID">(reconHit) = -1;
+                        Get<"tTrue">(reconHit) = 0;
+                        Get<"xTrue">(reconHit) = muc::array2f{};
+                    }
+                    reconHitOutput.Fill(std::move(reconHit));
+                }
+
+                // every hit reaching the MCP counts, including those lost in the MCP itself
+                for (gsl::index h{}; h < std::ssize(event); ++h) {
+                    const auto x{Get<"x">(*event[h]).template As<muc::array2d>()};
+                    const auto matched{clusterOfHit[h] >= 0};
+                    efficiency.Fill(matched, x[0], x[1]);
+                    ++count[0];
+                    if (not matched) {
+                        continue;
+                    }
+                    const auto& reconX{cluster[clusterOfHit[h]].x};
+                    resolutionX.Fill(x[0], x[1], reconX[0] - x[0]);
+                    resolutionY.Fill(x[0], x[1], reconX[1] - x[1]);
+                    ++count[1];
+                    sumResidual2[0] += muc::pow(reconX[0] - x[0], 2);
+                    sumResidual2[1] += muc::pow(reconX[1] - x[1], 2);
+                }
+            });
+
+        reconHitOutput.Write();
+        (mapPath.has_parent_path() ? file.mkdir(mapPath.parent_path().generic_string().c_str(), "", true) : &file)->cd();
+        efficiency.Write();
+        resolutionX.Write();
+        resolutionY.Write();
+        file.cd();
+    }
+
+    const auto comm{mplr::comm_world().native_handle()};
+    MPI_Allreduce(MPI_IN_PLACE, count.data(), count.size(), MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+    MPI_Allreduce(MPI_IN_PLACE, sumResidual2.data(), sumResidual2.size(), MPI_DOUBLE, MPI_SUM, comm);
+    const auto nMatched{std::max(count[1], 1ull)};
+    Mustard::MasterPrintLn("MCP hit efficiency {:.4g} ({} of {}), RMS residual x {:.4g} mm, y {:.4g} mm",
+                           static_cast<double>(count[1]) / std::max(count[0], 1ull), count[1], count[0],
+                           std::sqrt(sumResidual2[0] / nMatched) / 1_mm, std::sqrt(sumResidual2[1] / nMatched) / 1_mm);
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::ReconMCP
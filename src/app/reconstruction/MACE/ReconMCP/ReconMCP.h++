@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::ReconMCP {
+
+class ReconMCP : public Mustard::Application::Subprogram {
+public:
+    ReconMCP();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::ReconMCP
@@ -0,0 +1,3 @@
+# $1: simulation output file (with MCPSimHit), further arguments are passed on (e.g. an MCP description
+# with the anode readout, like strip_anode.yaml)
+ReconMCP "$@" --match-radius 2
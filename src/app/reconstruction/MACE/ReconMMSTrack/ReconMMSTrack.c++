@@ -2,6 +2,8 @@
 #include "MACE/Data/MMSTrack.h++"
 #include "MACE/Data/SimHit.h++"
 #include "MACE/ReconMMSTrack/ReconMMSTrack.h++"
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/Covariance.h++"
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/TrackExtrapolator.h++"
 #include "MACE/Reconstruction/MMSTracking/Finder/TruthFinder.h++"
 #include "MACE/Reconstruction/MMSTracking/Fitter/GenFitDAFFitter.h++"
 #include "MACE/Reconstruction/MMSTracking/Fitter/GenFitReferenceKalmanFitter.h++"
@@ -17,6 +19,8 @@
 #include "ROOT/RDataFrame.hxx"
 #include "TFile.h"
 
+#include "gsl/gsl"
+
 #include <algorithm>
 #include <array>
 #include <cassert>
@@ -43,11 +47,15 @@ auto ReconMMSTrack::Main(int argc, char* argv[]) const -> int {
     TFile file{Mustard::Parallel::ProcessSpecificPath("output.root").generic_string().c_str(), "RECREATE"};
     Mustard::Data::Output<Data::MMSTrack> reconTrack{"G4Run0/MMSTrack"};
     Mustard::Data::Output<Data::MMSTrack> reconTrackError{"G4Run0/MMSTrackError"};
+    Mustard::Data::Output<Data::MMSTrackState> reconTrackState{"G4Run0/MMSTrackState"};
 
     MMSTracking::TruthFinder finder;
     // MMSTracking::TruthFitter fitter;
     MMSTracking::GenFitDAFFitter fitter{0.2};
     // fitter.EnableEventDisplay(true);
+    MMSTracking::TrackExtrapolator extrapolator;
+    const std::array surface{MMSTracking::TrackExtrapolator::TargetPlane(), // SurfID 0
+                             MMSTracking::TrackExtrapolator::MCPPlane()};   // SurfID 1
 
     Mustard::Data::Processor processor;
     auto nextTrackID{0};
@@ -64,6 +72,23 @@ auto ReconMMSTrack::Main(int argc, char* argv[]) const -> int {
                 }
                 reconTrack.Fill(*track);
 
+                for (gsl::index surfaceID{}; surfaceID < std::ssize(surface); ++surfaceID) {
+                    const auto state{extrapolator.Extrapolate(*track, surface[surfaceID])};
+                    if (not state) {
+                        continue;
+                    }
+                    Mustard::Data::Tuple<Data::MMSTrackState> trackState;
+                    Get<"EvtID">(trackState) = Get<"EvtID">(*track);
+                    Get<"TrkID">(trackState) = Get<"TrkID">(*track);
+                    Get<"SurfID">(trackState) = surfaceID;
+                    Get<"t">(trackState) = state->t;
+                    Get<"s">(trackState) = state->s;
+                    Get<"x">(trackState) = state->x;
+                    Get<"p">(trackState) = state->p;
+                    Get<"cov">(trackState) = MMSTracking::PackCovariance<6>(state->cov);
+                    reconTrackState.Fill(std::move(trackState));
+                }
+
                 using namespace Mustard::VectorArithmeticOperator;
                 Mustard::Data::Tuple<Data::MMSTrack> trackError;
                 Get<"EvtID">(trackError) = Get<"EvtID">(*track);
@@ -80,6 +105,7 @@ auto ReconMMSTrack::Main(int argc, char* argv[]) const -> int {
                 Get<"phi0">(trackError) = Get<"phi0">(*track) - Get<"phi0">(*good.seed);
                 Get<"z0">(trackError) = Get<"z0">(*track) - Get<"z0">(*good.seed);
                 Get<"theta0">(trackError) = Get<"theta0">(*track) - Get<"theta0">(*good.seed);
+                Get<"cov">(trackError) = Get<"cov">(*track);
                 reconTrackError.Fill(std::move(trackError));
 
                 nextTrackID = trackID;
@@ -88,6 +114,7 @@ auto ReconMMSTrack::Main(int argc, char* argv[]) const -> int {
 
     reconTrack.Write();
     reconTrackError.Write();
+    reconTrackState.Write();
     // fitter.OpenEventDisplay();
 
     return EXIT_SUCCESS;
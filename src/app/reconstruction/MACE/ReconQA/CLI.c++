@@ -0,0 +1,99 @@
+#include "MACE/ReconQA/CLI.h++"
+
+#include <cassert>
+
+namespace MACE::ReconQA {
+
+CLIModule::CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli) :
+    ModuleBase{cli} {
+    TheCLI()
+        ->add_argument("input")
+        .nargs(argparse::nargs_pattern::any)
+        .default_value(std::vector<std::string>{})
+        .help("Input file path(s), with MC truth (MMSSimTrack, ECALSimHit, or SciFiSimHit of Phase-I). Not needed with --compare.");
+    TheCLI()
+        ->add_argument("-r", "--recon-input")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .help("Reconstruction file path(s), with MMS tracks, ECAL clusters or SciFi points reconstructed from the input. Default to the input.");
+    TheCLI()
+        ->add_argument("-o", "--output")
+        .default_value(std::string{"ReconQA.root"})
+        .help("Output file path of monitoring histograms. Default to 'ReconQA.root'.");
+    TheCLI()
+        ->add_argument("-m", "--output-mode")
+        .help("Output file creation mode. Default to 'NEW'.");
+
+    TheCLI()
+        ->add_argument("-i", "--index-range")
+        .nargs(1, 2)
+        .scan<'i', gsl::index>()
+        .default_value(std::vector<gsl::index>{0, 1})
+        .help("Set number of datasets (index in [0, size) range), or index range (in [first, last) pattern)");
+
+    TheCLI()
+        ->add_argument("--min-purity")
+        .scan<'g', double>()
+        .default_value(0.5)
+        .help("A track matches a truth track if at least this fraction of its hits belongs to it. Default to 0.5.");
+    TheCLI()
+        ->add_argument("--scifi-match-distance")
+        .scan<'g', double>()
+        .default_value(5.)
+        .help("A SciFi point matches a simulated fiber hit within this distance (mm). Default to 5.");
+
+    TheCLI()
+        ->add_argument("--reference")
+        .help("Reference monitoring file (output of a previous run). If given, the output is compared with it.");
+    TheCLI()
+        ->add_argument("--compare")
+        .nargs(2)
+        .help("Compare two monitoring files (reference, then test) without filling, and exit.");
+    TheCLI()
+        ->add_argument("--suspicious")
+        .scan<'g', double>()
+        .default_value(3.)
+        .help("A comparison is suspicious above this Z (sigma). Default to 3.");
+    TheCLI()
+        ->add_argument("--failed")
+        .scan<'g', double>()
+        .default_value(5.)
+        .help("A comparison fails above this Z (sigma). Default to 5.");
+
+    TheCLI()
+        ->add_argument("--sim-track-name")
+        .help("Set truth track dataset name format. Set to '' to skip track monitoring. Default to 'G4Run{}/MMSSimTrack'.");
+    TheCLI()
+        ->add_argument("--track-name")
+        .help("Set reconstructed track dataset name format. Default to 'G4Run{}/MMSTrack'.");
+    TheCLI()
+        ->add_argument("--ecal-hit-name")
+        .help("Set ECAL hit dataset name format. Set to '' to skip ECAL monitoring. Default to 'G4Run{}/ECALSimHit'.");
+    TheCLI()
+        ->add_argument("--ecal-cluster-name")
+        .help("Set ECAL cluster dataset name format. Default to 'G4Run{}/ECALCluster'.");
+    TheCLI()
+        ->add_argument("--scifi-hit-name")
+        .help("Set Phase-I SciFi hit dataset name format (e.g. 'G4Run{}/SciFiHit'). Default to '' (SciFi monitoring skipped).");
+    TheCLI()
+        ->add_argument("--scifi-point-name")
+        .help("Set ReconSciFi point dataset name format. Default to 'G4Run{}/ReconTrack'.");
+}
+
+auto CLIModule::ReconFilePath() const -> std::vector<std::string> {
+    if (auto recon{TheCLI()->present<std::vector<std::string>>("-r")}) {
+        return *std::move(recon);
+    }
+    return InputFilePath();
+}
+
+auto CLIModule::DatasetIndexRange() const -> std::pair<gsl::index, gsl::index> {
+    auto var{TheCLI()->get<std::vector<gsl::index>>("-i")};
+    assert(var.size() == 1 or var.size() == 2);
+    if (var.size() == 1) {
+        return {0, var.front()};
+    } else {
+        return {var.front(), var.back()};
+    }
+}
+
+} // namespace MACE::ReconQA
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "MACE/Detector/Description/ECAL.h++"
+
+#include "Mustard/CLI/CLI.h++"
+#include "Mustard/CLI/Module/BasicModule.h++"
+#include "Mustard/CLI/Module/DetectorDescriptionModule.h++"
+#include "Mustard/CLI/Module/ModuleBase.h++"
+
+#include "gsl/gsl"
+
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace MACE::ReconQA {
+
+class CLIModule : public Mustard::CLI::ModuleBase {
+public:
+    CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli);
+
+    auto InputFilePath() const -> auto { return TheCLI()->get<std::vector<std::string>>("input"); }
+    auto ReconFilePath() const -> std::vector<std::string>;
+    auto OutputFilePath() const -> auto { return TheCLI()->get("-o"); }
+    auto OutputFileMode() const -> auto { return TheCLI()->present("-m").value_or("NEW"); }
+
+    auto DatasetIndexRange() const -> std::pair<gsl::index, gsl::index>;
+
+    auto MinPurity() const -> auto { return TheCLI()->get<double>("--min-purity"); }
+    auto SciFiMatchDistance() const -> auto { return TheCLI()->get<double>("--scifi-match-distance"); }
+
+    auto ReferenceFilePath() const -> auto { return TheCLI()->present("--reference"); }
+    auto CompareFilePath() const -> auto { return TheCLI()->present<std::vector<std::string>>("--compare"); }
+    auto SuspiciousZ() const -> auto { return TheCLI()->get<double>("--suspicious"); }
+    auto FailedZ() const -> auto { return TheCLI()->get<double>("--failed"); }
+
+    auto SimTrackNameFormat() const -> auto { return TheCLI()->present("--sim-track-name").value_or("G4Run{}/MMSSimTrack"); }
+    auto TrackNameFormat() const -> auto { return TheCLI()->present("--track-name").value_or("G4Run{}/MMSTrack"); }
+    auto ECALHitNameFormat() const -> auto { return TheCLI()->present("--ecal-hit-name").value_or("G4Run{}/ECALSimHit"); }
+    auto ECALClusterNameFormat() const -> auto { return TheCLI()->present("--ecal-cluster-name").value_or("G4Run{}/ECALCluster"); }
+    auto SciFiHitNameFormat() const -> auto { return TheCLI()->present("--scifi-hit-name").value_or(""); }
+    auto SciFiPointNameFormat() const -> auto { return TheCLI()->present("--scifi-point-name").value_or("G4Run{}/ReconTrack"); }
+};
+
+using CLI = Mustard::CLI::CLI<Mustard::CLI::BasicModule,
+                              Mustard::CLI::DetectorDescriptionModule<std::tuple<MACE::Detector::Description::ECAL>>,
+                              CLIModule>;
+
+} // namespace MACE::ReconQA
@@ -0,0 +1,176 @@
+#include "MACE/Data/Cluster.h++"
+#include "MACE/Data/MMSTrack.h++"
+#include "MACE/Data/MergeJoiner.h++"
+#include "MACE/Data/SimHit.h++"
+#include "MACE/PhaseI/Data/SimHit.h++"
+#include "MACE/PhaseI/Data/Track.h++"
+#include "MACE/ReconQA/CLI.h++"
+#include "MACE/ReconQA/ReconQA.h++"
+#include "MACE/Reconstruction/Monitoring/ECALClusterMonitor.h++"
+#include "MACE/Reconstruction/Monitoring/RegressionTest.h++"
+#include "MACE/Reconstruction/Monitoring/SciFiMonitor.h++"
+#include "MACE/Reconstruction/Monitoring/TrackMonitor.h++"
+
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "TFile.h"
+
+#include "mplr/mplr.hpp"
+
+#include "mpi.h"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace MACE::ReconQA {
+
+namespace {
+
+/// @return EXIT_FAILURE if any comparison failed, on all processes
+auto Compare(const RegressionTest& regression, const std::string& referencePath, const std::string& testPath) -> int {
+    const auto master{mplr::comm_world().rank() == 0};
+    // files are opened on master only, the failure (0: none, 1: reference, 2: test) is broadcast
+    std::unique_ptr<TFile> reference;
+    std::unique_ptr<TFile> test;
+    int unopened{};
+    if (master) {
+        const auto Open{[](const std::string& path) {
+            std::unique_ptr<TFile> file{TFile::Open(path.c_str(), "READ")};
+            if (file != nullptr and not file->IsOpen()) {
+                file.reset();
+            }
+            return file;
+        }};
+        reference = Open(referencePath);
+        test = Open(testPath);
+        unopened = reference == nullptr ? 1 : (test == nullptr ? 2 : 0);
+    }
+    MPI_Bcast(&unopened, 1, MPI_INT, 0, mplr::comm_world().native_handle());
+    if (unopened) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Cannot open file '{}'", unopened == 1 ? referencePath : testPath));
+    }
+
+    int status{EXIT_SUCCESS};
+    if (master) {
+        const auto result{regression.Compare(*reference, *test)};
+        RegressionTest::Print(result);
+        if (RegressionTest::Worst(result) == RegressionTest::Verdict::Failed) {
+            Mustard::PrintError(fmt::format("'{}' regresses from '{}'", testPath, referencePath));
+            status = EXIT_FAILURE;
+        }
+    }
+    MPI_Bcast(&status, 1, MPI_INT, 0, mplr::comm_world().native_handle());
+    return status;
+}
+
+} // namespace
+
+ReconQA::ReconQA() :
+    Subprogram{"ReconQA", "Reconstruction quality monitoring against MC truth, and regression check between runs."} {}
+
+auto ReconQA::Main(int argc, char* argv[]) const -> int {
+    CLI cli;
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+
+    const RegressionTest regression{cli.SuspiciousZ(), cli.FailedZ()};
+    if (const auto compare{cli.CompareFilePath()}) {
+        return Compare(regression, compare->front(), compare->back());
+    }
+    const auto input{cli.InputFilePath()};
+    if (input.empty()) {
+        Mustard::PrintError("No input file. Give input file path(s), or use --compare");
+        return EXIT_FAILURE;
+    }
+    const auto recon{cli.ReconFilePath()};
+
+    TrackMonitor trackMonitor{cli.MinPurity()};
+    ECALClusterMonitor ecalMonitor;
+    SciFiMonitor sciFiMonitor{cli.SciFiMatchDistance()};
+
+    // an empty truth name skips the detector, with its reconstructed objects
+    const auto trackEnabled{not cli.SimTrackNameFormat().empty()};
+    const auto ecalEnabled{not cli.ECALHitNameFormat().empty()};
+    const auto sciFiEnabled{not cli.SciFiHitNameFormat().empty()};
+    const auto [iFirst, iLast]{cli.DatasetIndexRange()};
+    const auto TreeName{[](const std::string& nameFormat, gsl::index i) { return fmt::vformat(nameFormat, fmt::make_format_args(i)); }};
+    for (auto i{iFirst}; i < iLast; ++i) {
+        const Data::MergeJoiner<Data::MMSSimTrack, Data::MMSTrack, Data::ECALSimHit, Data::ECALCluster> joiner{
+            {{{input, trackEnabled ? TreeName(cli.SimTrackNameFormat(), i) : ""},
+              {recon, trackEnabled ? TreeName(cli.TrackNameFormat(), i) : ""},
+              {input, ecalEnabled ? TreeName(cli.ECALHitNameFormat(), i) : ""},
+              {recon, ecalEnabled ? TreeName(cli.ECALClusterNameFormat(), i) : ""}}}};
+        joiner.Join([&](int, const auto& event) {
+            const auto& [simTrack, track, ecalHit, ecalCluster]{event};
+            if (not simTrack.empty() or not track.empty()) {
+                trackMonitor.Fill(track, simTrack);
+            }
+            if (not ecalHit.empty() or not ecalCluster.empty()) {
+                ecalMonitor.Fill(ecalCluster, ecalHit);
+            }
+        });
+        // Phase-I SciFi comes from its own simulation and reconstruction
+        if (sciFiEnabled) {
+            const Data::MergeJoiner<PhaseI::Data::SciFiSimHit, PhaseI::Data::ReconTrack> sciFiJoiner{
+                {{{input, TreeName(cli.SciFiHitNameFormat(), i)},
+                  {recon, TreeName(cli.SciFiPointNameFormat(), i)}}}};
+            sciFiJoiner.Join([&](int, const auto& event) {
+                const auto& [sciFiHit, sciFiPoint]{event};
+                sciFiMonitor.Fill(sciFiPoint, sciFiHit);
+            });
+        }
+    }
+
+    trackMonitor.Merge();
+    ecalMonitor.Merge();
+    sciFiMonitor.Merge();
+    if (trackEnabled) {
+        trackMonitor.Print();
+    }
+    if (ecalEnabled) {
+        ecalMonitor.Print();
+    }
+    if (sciFiEnabled) {
+        sciFiMonitor.Print();
+    }
+
+    // written on master, whether the file opened is broadcast before anyone throws
+    const auto outputPath{cli.OutputFilePath()};
+    int opened{true};
+    if (mplr::comm_world().rank() == 0) {
+        TFile file{outputPath.c_str(), cli.OutputFileMode().c_str(), "", ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose};
+        opened = file.IsOpen();
+        if (opened) {
+            if (trackEnabled) {
+                file.mkdir("MMSTrack")->cd();
+                trackMonitor.Write();
+            }
+            if (ecalEnabled) {
+                file.mkdir("ECALCluster")->cd();
+                ecalMonitor.Write();
+            }
+            if (sciFiEnabled) {
+                file.mkdir("SciFi")->cd();
+                sciFiMonitor.Write();
+            }
+            file.Close();
+        }
+    }
+    MPI_Bcast(&opened, 1, MPI_INT, 0, mplr::comm_world().native_handle());
+    if (not opened) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Cannot open file '{}' with mode '{}'", outputPath, cli.OutputFileMode()));
+    }
+
+    if (const auto reference{cli.ReferenceFilePath()}) {
+        return Compare(regression, *reference, cli.OutputFilePath());
+    }
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::ReconQA
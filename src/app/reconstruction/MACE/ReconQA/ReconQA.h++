@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::ReconQA {
+
+class ReconQA : public Mustard::Application::Subprogram {
+public:
+    ReconQA();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::ReconQA
@@ -0,0 +1,3 @@
+# $1: simulation output file (with MMSSimTrack and ECALSimHit), $2: reconstruction output file (with MMSTrack and
+# ECALCluster), $3: reference monitoring file of a known-good run, further arguments are passed on
+ReconQA "$1" -r "$2" --reference "$3" "${@:4}" -m RECREATE
@@ -0,0 +1,3 @@
+# $1: SimMACEPhaseI output file (with SciFiHit), $2: ReconSciFi output file (with ReconTrack), $3: reference monitoring
+# file of a known-good run, further arguments are passed on
+ReconQA "$1" -r "$2" --sim-track-name '' --ecal-hit-name '' --scifi-hit-name 'G4Run{}/SciFiHit' --reference "$3" "${@:4}" -m RECREATE
@@ -0,0 +1,117 @@
+#include "MACE/ReconTTC/CLI.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/core.h"
+
+#include <cassert>
+#include <cstdlib>
+
+namespace MACE::ReconTTC {
+
+using namespace Mustard::LiteralUnit::Time;
+
+CLIModule::CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli) :
+    ModuleBase{cli} {
+    TheCLI()
+        ->add_argument("input")
+        .nargs(argparse::nargs_pattern::at_least_one)
+        .help("Input file path(s), with TTC hits and TTC SiPM (optical photon) hits.");
+    TheCLI()
+        ->add_argument("-o", "--output")
+        .help("Output file path. Suffix '_ttc' on input file name by default.");
+    TheCLI()
+        ->add_argument("-m", "--output-mode")
+        .help("Output file creation mode. Default to 'NEW'.");
+
+    TheCLI()
+        ->add_argument("-i", "--index-range")
+        .nargs(1, 2)
+        .scan<'i', gsl::index>()
+        .default_value(std::vector<gsl::index>{0, 1})
+        .help("Set number of datasets (index in [0, size) range), or index range (in [first, last) pattern)");
+
+    TheCLI()
+        ->add_argument("--photon-threshold")
+        .scan<'i', int>()
+        .default_value(3)
+        .help("SiPM leading-edge threshold in number of photons. The SiPM time is the arrival time of that photon. Default to 3.");
+    TheCLI()
+        ->add_argument("-c", "--calibration")
+        .help("Time calibration YAML file (Walk: [c0, c1], SiPMResolution, TileOffset; in ns). "
+              "Time walk and tile offsets are fitted on input if not given.");
+    TheCLI()
+        ->add_argument("--max-iteration")
+        .scan<'i', int>()
+        .default_value(50)
+        .help("Maximum number of tile offset calibration iterations. Default to 50.");
+    TheCLI()
+        ->add_argument("--tolerance")
+        .scan<'g', double>()
+        .default_value(1e-3)
+        .help("Tile offset calibration converges when no offset shifts more than this (ns). Default to 0.001.");
+
+    TheCLI()
+        ->add_argument("--ttc-hit-name")
+        .help("Set TTC hit dataset name format. Default to 'G4Run{}/TTCSimHit'.");
+    TheCLI()
+        ->add_argument("--ttc-sipm-hit-name")
+        .help("Set TTC SiPM hit dataset name format. Default to 'G4Run{}/TTCSiPMHit'.");
+    TheCLI()
+        ->add_argument("--ttc-time-hit-name")
+        .help("Set output TTC hit time dataset name format. Default to 'G4Run{}/TTCTimeHit'.");
+    TheCLI()
+        ->add_argument("--ttc-t0-name")
+        .help("Set output event T0 dataset name format. Default to 'G4Run{}/TTCEventT0'.");
+}
+
+auto CLIModule::OutputFilePath() const -> std::filesystem::path {
+    if (auto output{TheCLI()->present("-o")}) {
+        return *std::move(output);
+    }
+    auto inputList{InputFilePath()};
+    if (inputList.size() > 1) {
+        Mustard::PrintError("Cannot automatically construct output file path since # input file path > 1. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    if (inputList.front().find('*') != std::string::npos) {
+        Mustard::PrintError("Cannot automatically construct output file path since input file path includes wildcards. Use -o or --output");
+        std::exit(EXIT_FAILURE);
+    }
+    std::filesystem::path input{std::move(inputList.front())};
+    const auto extension{input.extension()};
+    return input.replace_extension().concat("_ttc").replace_extension(extension);
+}
+
+auto CLIModule::DatasetIndexRange() const -> std::pair<gsl::index, gsl::index> {
+    auto var{TheCLI()->get<std::vector<gsl::index>>("-i")};
+    assert(var.size() == 1 or var.size() == 2);
+    if (var.size() == 1) {
+        return {0, var.front()};
+    } else {
+        return {var.front(), var.back()};
+    }
+}
+
+auto CLIModule::Tolerance() const -> double {
+    return TheCLI()->get<double>("--tolerance") * 1_ns;
+}
+
+auto CLIModule::ImportCalibration(TimeCalibration& calibration) const -> bool {
+    const auto path{TheCLI()->present("-c")};
+    if (not path) {
+        return false;
+    }
+    try {
+        calibration.Import(YAML::LoadFile(*path));
+    } catch (const YAML::Exception& e) {
+        Mustard::PrintError(fmt::format("Invalid time calibration '{}' ({})", *path, e.what()));
+        std::exit(EXIT_FAILURE);
+    }
+    return true;
+}
+
+} // namespace MACE::ReconTTC
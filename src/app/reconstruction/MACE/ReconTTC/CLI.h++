@@ -0,0 +1,43 @@
+#pragma once
+
+#include "MACE/ReconTTC/TimeCalibration.h++"
+
+#include "Mustard/CLI/CLI.h++"
+#include "Mustard/CLI/Module/BasicModule.h++"
+#include "Mustard/CLI/Module/ModuleBase.h++"
+
+#include "gsl/gsl"
+
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MACE::ReconTTC {
+
+class CLIModule : public Mustard::CLI::ModuleBase {
+public:
+    CLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli);
+
+    auto InputFilePath() const -> auto { return TheCLI()->get<std::vector<std::string>>("input"); }
+    auto OutputFileMode() const -> auto { return TheCLI()->present("-m").value_or("NEW"); }
+    auto OutputFilePath() const -> std::filesystem::path;
+
+    auto DatasetIndexRange() const -> std::pair<gsl::index, gsl::index>;
+
+    auto PhotonThreshold() const -> auto { return TheCLI()->get<int>("--photon-threshold"); }
+    auto MaxIteration() const -> auto { return TheCLI()->get<int>("--max-iteration"); }
+    auto Tolerance() const -> double;
+    /// @return false if no calibration file is given, i.e. calibration should be fitted.
+    auto ImportCalibration(TimeCalibration& calibration) const -> bool;
+
+    auto TTCHitNameFormat() const -> auto { return TheCLI()->present("--ttc-hit-name").value_or("G4Run{}/TTCSimHit"); }
+    auto TTCSiPMHitNameFormat() const -> auto { return TheCLI()->present("--ttc-sipm-hit-name").value_or("G4Run{}/TTCSiPMHit"); }
+    auto TTCTimeHitNameFormat() const -> auto { return TheCLI()->present("--ttc-time-hit-name").value_or("G4Run{}/TTCTimeHit"); }
+    auto TTCEventT0NameFormat() const -> auto { return TheCLI()->present("--ttc-t0-name").value_or("G4Run{}/TTCEventT0"); }
+};
+
+using CLI = Mustard::CLI::CLI<Mustard::CLI::BasicModule,
+                              CLIModule>;
+
+} // namespace MACE::ReconTTC
@@ -0,0 +1,208 @@
+#include "MACE/Data/MergeJoiner.h++"
+#include "MACE/Data/SensorHit.h++"
+#include "MACE/Data/SimHit.h++"
+#include "MACE/ReconTTC/CLI.h++"
+#include "MACE/ReconTTC/ReconTTC.h++"
+#include "MACE/ReconTTC/TimeCalibration.h++"
+
+#include "Mustard/Data/Output.h++"
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/Value.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Parallel/ProcessSpecificPath.h++"
+#include "Mustard/ROOTX/MakeTextTMacro.h++"
+
+#include "TFile.h"
+
+#include "mplr/mplr.hpp"
+
+#include "gsl/gsl"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MACE::ReconTTC {
+
+namespace {
+
+using TTCTimeHit = Mustard::Data::TupleModel<
+    Mustard::Data::Value<int, "EvtID", "Event ID">,
+    Mustard::Data::Value<int, "HitID", "Hit ID">,
+    Mustard::Data::Value<short, "TileID", "Hit detector ID">,
+    Mustard::Data::Value<int, "TrkID", "Track ID (of the tile hit)">,
+    Mustard::Data::Value<bool, "Good", "At least one SiPM fired">,
+    Mustard::Data::Value<double, "t", "Reconstructed hit time">,
+    Mustard::Data::Value<double, "tTrue", "Tile hit time">,
+    Mustard::Data::Value<float, "Edep", "Energy deposition">,
+    Mustard::Data::Value<std::vector<short>, "SiPMID", "Fired SiPM IDs">,
+    Mustard::Data::Value<std::vector<float>, "tSiPM", "Walk-corrected SiPM times">,
+    Mustard::Data::Value<std::vector<float>, "ADC", "Number of photons on fired SiPMs">>;
+
+using TTCEventT0 = Mustard::Data::TupleModel<
+    Mustard::Data::Value<int, "EvtID", "Event ID">,
+    Mustard::Data::Value<int, "NHit", "Number of good hits">,
+    Mustard::Data::Value<double, "T0", "Event time (weighted by number of fired SiPMs)">,
+    Mustard::Data::Value<float, "T0Err", "Expected T0 resolution">,
+    Mustard::Data::Value<double, "T0True", "Event time from tile hit times">>;
+
+/// @brief Assigns photons to the latest hit on the same tile before them, and finds the SiPM leading edges.
+auto AppendTileHit(const auto& tileHit, const auto& siPMHit, int photonThreshold, std::vector<TileHit>& hit) -> void {
+    const auto first{std::ssize(hit)};
+    for (auto&& h : tileHit) {
+        hit.push_back({*Get<"EvtID">(*h), *Get<"HitID">(*h), *Get<"TileID">(*h), *Get<"TrkID">(*h), *Get<"PDGID">(*h),
+                       *Get<"t">(*h), *Get<"Edep">(*h), Get<"x">(*h).template As<muc::array3d>(), Get<"p">(*h).template As<muc::array3d>(), {}});
+    }
+    std::vector<gsl::index> sorted(hit.size() - first);
+    std::iota(sorted.begin(), sorted.end(), first);
+    const auto TileTime{[&](gsl::index i) { return std::pair{hit[i].tileID, hit[i].tTrue}; }};
+    std::ranges::sort(sorted, {}, TileTime);
+
+    std::map<std::pair<gsl::index, short>, std::vector<double>> photonTime; // (hit, SiPM) -> photon arrival times
+    for (auto&& photon : siPMHit) {
+        const auto tileID{*Get<"TileID">(*photon)};
+        const auto t{*Get<"t">(*photon)};
+        const auto next{std::ranges::upper_bound(sorted, std::pair{tileID, t}, {}, TileTime)};
+        if (next == sorted.cbegin() or hit[*std::prev(next)].tileID != tileID) {
+            continue;
+        }
+        photonTime[{*std::prev(next), *Get<"SiPMID">(*photon)}].emplace_back(t);
+    }
+    for (auto&& [key, time] : photonTime) {
+        if (std::ssize(time) < photonThreshold) {
+            continue;
+        }
+        const auto edge{time.begin() + (photonThreshold - 1)};
+        std::ranges::nth_element(time, edge);
+        hit[key.first].siPM.push_back({key.second, *edge, static_cast<int>(time.size())});
+    }
+}
+
+} // namespace
+
+ReconTTC::ReconTTC() :
+    Subprogram{"ReconTTC", "Timing counter (TTC) hit time and event T0 reconstruction."} {}
+
+auto ReconTTC::Main(int argc, char* argv[]) const -> int {
+    CLI cli;
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+
+    const auto photonThreshold{cli.PhotonThreshold()};
+    if (photonThreshold < 1) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Photon threshold ({}) should be at least 1", photonThreshold));
+    }
+
+    // tile hits of this process, with SiPM leading edges
+    const auto [iFirst, iLast]{cli.DatasetIndexRange()};
+    const auto TreeName{[](const std::string& nameFormat, gsl::index i) { return fmt::vformat(nameFormat, fmt::make_format_args(i)); }};
+    std::vector<std::vector<TileHit>> hit;
+    for (auto i{iFirst}; i < iLast; ++i) {
+        auto& datasetHit{hit.emplace_back()};
+        const Data::MergeJoiner<Data::TTCSimHit, Data::TTCSiPMHit> joiner{
+            {{{cli.InputFilePath(), TreeName(cli.TTCHitNameFormat(), i)},
+              {cli.InputFilePath(), TreeName(cli.TTCSiPMHitNameFormat(), i)}}}};
+        joiner.Join([&](int, const auto& event) {
+            const auto& [tileHit, siPMHit]{event};
+            AppendTileHit(tileHit, siPMHit, photonThreshold, datasetHit);
+        });
+    }
+
+    // time calibration
+    TimeCalibration calibration;
+    if (not cli.ImportCalibration(calibration)) {
+        calibration.FitWalk(hit);
+        const auto nIteration{calibration.FitTileOffset(hit, cli.MaxIteration(), cli.Tolerance())};
+        Mustard::MasterPrintLn("Time walk c0 = {:.4g} ns, c1 = {:.4g} ns, SiPM time resolution {:.4g} ns, tile offsets in {} iteration(s)",
+                               calibration.WalkConstant(), calibration.WalkCoefficient(),
+                               calibration.SiPMResolution(), nIteration);
+    }
+
+    const auto outputPath{Mustard::Parallel::ProcessSpecificPath(cli.OutputFilePath()).replace_extension(".root").generic_string()};
+    TFile file{outputPath.c_str(), cli.OutputFileMode().c_str(), "", ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose};
+    if (not file.IsOpen()) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Cannot open file '{}' with mode '{}'", outputPath, cli.OutputFileMode()));
+    }
+    if (mplr::comm_world().rank() == 0) {
+        YAML::Node config;
+        config["PhotonThreshold"] = photonThreshold;
+        calibration.Export(config);
+        Mustard::ROOTX::MakeTextTMacro(YAML::Dump(config), "TTCCalibration", "Print ReconTTC time calibration")->Write();
+    }
+
+    // per-hit time and per-event T0
+    for (auto i{iFirst}; i < iLast; ++i) {
+        Mustard::Data::Output<TTCTimeHit> timeHitOutput{TreeName(cli.TTCTimeHitNameFormat(), i)};
+        Mustard::Data::Output<TTCEventT0> t0Output{TreeName(cli.TTCEventT0NameFormat(), i)};
+        const auto& datasetHit{hit[i - iFirst]};
+        for (auto eventBegin{datasetHit.cbegin()}; eventBegin != datasetHit.cend();) {
+            const auto eventEnd{std::find_if(eventBegin, datasetHit.cend(), [&](auto&& h) { return h.evtID != eventBegin->evtID; })};
+            int nGood{};
+            double sumW{};
+            double sumWT{};
+            double sumWTTrue{};
+            for (auto&& h : std::ranges::subrange{eventBegin, eventEnd}) {
+                const auto t{calibration.HitTime(h)};
+                Mustard::Data::Tuple<TTCTimeHit> timeHit;
+                Get<"EvtID">(timeHit) = h.evtID;
+                Get<"HitID">(timeHit) = h.hitID;
+                Get<"TileID">(timeHit) = h.tileID;
+                Get<"TrkID">(timeHit) = h.trkID;
+                Get<"Good">(timeHit) = not h.siPM.empty();
+                Get<"t">(timeHit) = t;
+                Get<"tTrue">(timeHit) = h.tTrue;
+                Get<"Edep">(timeHit) = h.edep;
+                std::vector<short> siPMIDList;
+                std::vector<float> tSiPMList;
+                std::vector<float> adc;
+                for (auto&& [siPMID, tSiPM, nPhoton] : h.siPM) {
+                    siPMIDList.emplace_back(siPMID);
+                    tSiPMList.emplace_back(tSiPM - calibration.Walk(nPhoton));
+                    adc.emplace_back(nPhoton);
+                }
+                Get<"SiPMID">(timeHit) = std::move(siPMIDList);
+                Get<"tSiPM">(timeHit) = std::move(tSiPMList);
+                Get<"ADC">(timeHit) = std::move(adc);
+                timeHitOutput.Fill(std::move(timeHit));
+                if (h.siPM.empty()) {
+                    continue;
+                }
+                // each fired SiPM is an independent measurement
+                const auto w{static_cast<double>(h.siPM.size())};
+                ++nGood;
+                sumW += w;
+                sumWT += w * t;
+                sumWTTrue += w * h.tTrue;
+            }
+            if (nGood > 0) {
+                Mustard::Data::Tuple<TTCEventT0> t0;
+                Get<"EvtID">(t0) = eventBegin->evtID;
+                Get<"NHit">(t0) = nGood;
+                Get<"T0">(t0) = sumWT / sumW;
+                Get<"T0Err">(t0) = calibration.SiPMResolution() / std::sqrt(sumW);
+                Get<"T0True">(t0) = sumWTTrue / sumW;
+                t0Output.Fill(std::move(t0));
+            }
+            eventBegin = eventEnd;
+        }
+        timeHitOutput.Write();
+        t0Output.Write();
+    }
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::ReconTTC
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::ReconTTC {
+
+class ReconTTC : public Mustard::Application::Subprogram {
+public:
+    ReconTTC();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::ReconTTC
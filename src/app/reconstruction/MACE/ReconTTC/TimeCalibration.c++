@@ -0,0 +1,224 @@
+#include "MACE/ReconTTC/TimeCalibration.h++"
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/TrackExtrapolator.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "Eigen/Core"
+
+#include "mplr/mplr.hpp"
+
+#include "mpi.h"
+
+#include "muc/math"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
+namespace MACE::ReconTTC {
+
+TimeCalibration::TimeCalibration() :
+    fWalkConstant{},
+    fWalkCoefficient{},
+    fSiPMResolution{},
+    fTileOffset{} {}
+
+auto TimeCalibration::Walk(double nPhoton) const -> double {
+    return fWalkConstant + fWalkCoefficient / std::sqrt(nPhoton);
+}
+
+auto TimeCalibration::TileOffset(int tileID) const -> double {
+    return 0 <= tileID and tileID < std::ssize(fTileOffset) ? fTileOffset[tileID] : 0;
+}
+
+auto TimeCalibration::HitTime(const TileHit& hit) const -> double {
+    if (hit.siPM.empty()) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    const auto sum{std::transform_reduce(hit.siPM.cbegin(), hit.siPM.cend(), 0., std::plus{},
+                                         [this](auto&& siPM) { return siPM.t - Walk(siPM.nPhoton); })};
+    return sum / hit.siPM.size() - TileOffset(hit.tileID);
+}
+
+auto TimeCalibration::FitWalk(const std::vector<std::vector<TileHit>>& hit) -> void {
+    // linear least squares of (t - tTrue) = c0 + c1 * x, x = 1 / sqrt(nPhoton)
+    const auto& worldComm{mplr::comm_world()};
+    std::array<double, 5> sum{}; // n, x, x^2, y, xy
+    for (auto&& dataset : hit) {
+        for (auto&& h : dataset) {
+            for (auto&& [_, t, nPhoton] : h.siPM) {
+                const auto x{1 / std::sqrt(nPhoton)};
+                const auto y{t - h.tTrue};
+                sum[0] += 1;
+                sum[1] += x;
+                sum[2] += x * x;
+                sum[3] += y;
+                sum[4] += x * y;
+            }
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, sum.data(), sum.size(), MPI_DOUBLE, MPI_SUM, worldComm.native_handle());
+    const auto& [n, sx, sxx, sy, sxy]{sum};
+    if (n == 0) {
+        Mustard::PrintWarning("No fired SiPM, time walk not fitted");
+        return;
+    }
+    const auto determinant{n * sxx - sx * sx};
+    if (std::abs(determinant) <= std::numeric_limits<double>::epsilon() * n * sxx) {
+        Mustard::PrintWarning("Single SiPM amplitude, time walk fitted as a constant");
+        fWalkConstant = sy / n;
+        fWalkCoefficient = 0;
+    } else {
+        fWalkConstant = (sxx * sy - sx * sxy) / determinant;
+        fWalkCoefficient = (n * sxy - sx * sy) / determinant;
+    }
+
+    double sumR2{};
+    for (auto&& dataset : hit) {
+        for (auto&& h : dataset) {
+            for (auto&& [_, t, nPhoton] : h.siPM) {
+                sumR2 += muc::pow(t - h.tTrue - Walk(nPhoton), 2);
+            }
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &sumR2, 1, MPI_DOUBLE, MPI_SUM, worldComm.native_handle());
+    fSiPMResolution = std::sqrt(sumR2 / n);
+}
+
+auto TimeCalibration::FitTileOffset(const std::vector<std::vector<TileHit>>& hit, int maxIteration, double tolerance) -> int {
+    const auto& worldComm{mplr::comm_world()};
+    using Reconstruction::MMSTracking::TrackExtrapolator;
+    const TrackExtrapolator extrapolator;
+
+    // hits of the same track in an event, at least 2 of them, with their time of flight from the first one
+    std::vector<std::vector<const TileHit*>> track;
+    std::vector<std::vector<double>> flightTime;
+    int maxTileID{-1};
+    for (auto&& dataset : hit) {
+        std::vector<const TileHit*> sorted;
+        for (auto&& h : dataset) {
+            if (not h.siPM.empty()) {
+                sorted.emplace_back(&h);
+            }
+        }
+        std::ranges::stable_sort(sorted, [](auto&& h1, auto&& h2) { return std::pair{h1->evtID, h1->trkID} < std::pair{h2->evtID, h2->trkID}; });
+        for (auto begin{sorted.cbegin()}; begin != sorted.cend();) {
+            const auto end{std::find_if(begin, sorted.cend(), [&](auto&& h) { return h->evtID != (*begin)->evtID or h->trkID != (*begin)->trkID; })};
+            const auto& first{**begin};
+            const TrackExtrapolator::State state{0, 0, first.x, first.p, Eigen::Matrix<double, 6, 6>::Zero()};
+            const auto particle{TrackExtrapolator::ParticleOf(first.pdgID)};
+            if (not particle) {
+                begin = end;
+                continue;
+            }
+            std::vector<const TileHit*> trackHit{*begin};
+            std::vector<double> trackFlightTime{0};
+            for (auto&& h : std::ranges::subrange{std::next(begin), end}) {
+                const auto pMag{muc::hypot(h->p[0], h->p[1], h->p[2])};
+                const auto arrival{extrapolator.Extrapolate(state, particle->charge, particle->mass,
+                                                            TrackExtrapolator::Plane{h->x, {h->p[0] / pMag, h->p[1] / pMag, h->p[2] / pMag}})};
+                if (arrival) {
+                    trackHit.emplace_back(h);
+                    trackFlightTime.emplace_back(arrival->t);
+                }
+            }
+            if (trackHit.size() >= 2) {
+                for (auto&& h : trackHit) {
+                    maxTileID = std::max<int>(maxTileID, h->tileID);
+                }
+                track.emplace_back(std::move(trackHit));
+                flightTime.emplace_back(std::move(trackFlightTime));
+            }
+            begin = end;
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &maxTileID, 1, MPI_INT, MPI_MAX, worldComm.native_handle());
+    fTileOffset.assign(maxTileID + 1, 0);
+    if (fTileOffset.empty()) {
+        Mustard::PrintWarning("No track with more than one TTC hit, tile offsets not calibrated");
+        return 0;
+    }
+
+    std::vector<double> sum(2 * fTileOffset.size()); // residual sum and count of each tile
+    std::vector<double> time;
+    for (int iteration{1}; iteration <= maxIteration; ++iteration) {
+        std::ranges::fill(sum, 0);
+        for (gsl::index k{}; k < std::ssize(track); ++k) {
+            const auto& trackHit{track[k]};
+            time.clear();
+            for (gsl::index i{}; i < std::ssize(trackHit); ++i) {
+                time.emplace_back(HitTime(*trackHit[i]) - flightTime[k][i]);
+            }
+            const auto mean{std::reduce(time.cbegin(), time.cend()) / time.size()};
+            for (gsl::index i{}; i < std::ssize(trackHit); ++i) {
+                sum[2 * trackHit[i]->tileID] += time[i] - mean;
+                sum[2 * trackHit[i]->tileID + 1] += 1;
+            }
+        }
+        MPI_Allreduce(MPI_IN_PLACE, sum.data(), sum.size(), MPI_DOUBLE, MPI_SUM, worldComm.native_handle());
+
+        double maxShift{};
+        for (gsl::index tile{}; tile < std::ssize(fTileOffset); ++tile) {
+            if (sum[2 * tile + 1] > 0) {
+                const auto shift{sum[2 * tile] / sum[2 * tile + 1]};
+                fTileOffset[tile] += shift;
+                maxShift = std::max(maxShift, std::abs(shift));
+            }
+        }
+        // fix the global time reference (the walk constant), mean offset of calibrated tiles to 0
+        double offsetSum{};
+        int nCalibrated{};
+        for (gsl::index tile{}; tile < std::ssize(fTileOffset); ++tile) {
+            if (sum[2 * tile + 1] > 0) {
+                offsetSum += fTileOffset[tile];
+                ++nCalibrated;
+            }
+        }
+        for (gsl::index tile{}; tile < std::ssize(fTileOffset); ++tile) {
+            if (sum[2 * tile + 1] > 0) {
+                fTileOffset[tile] -= offsetSum / nCalibrated;
+            }
+        }
+        if (maxShift < tolerance) {
+            return iteration;
+        }
+    }
+    Mustard::PrintWarning(fmt::format("Tile offsets not converged in {} iterations", maxIteration));
+    return maxIteration;
+}
+
+auto TimeCalibration::Import(const YAML::Node& node) -> void {
+    if (const auto walk{node["Walk"]}) {
+        const auto c{walk.as<std::vector<double>>()};
+        if (c.size() != 2) {
+            Mustard::Throw<std::invalid_argument>(fmt::format("Walk should be [c0, c1], got {} value(s)", c.size()));
+        }
+        fWalkConstant = c[0];
+        fWalkCoefficient = c[1];
+    }
+    if (const auto resolution{node["SiPMResolution"]}) {
+        fSiPMResolution = resolution.as<double>();
+    }
+    if (const auto offset{node["TileOffset"]}) {
+        fTileOffset = offset.as<std::vector<double>>();
+    }
+}
+
+auto TimeCalibration::Export(YAML::Node& node) const -> void {
+    node["Walk"].push_back(fWalkConstant);
+    node["Walk"].push_back(fWalkCoefficient);
+    node["SiPMResolution"] = fSiPMResolution;
+    node["TileOffset"] = fTileOffset;
+}
+
+} // namespace MACE::ReconTTC
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "muc/array"
+
+#include "gsl/gsl"
+
+#include <vector>
+
+namespace YAML {
+class Node;
+} // namespace YAML
+
+namespace MACE::ReconTTC {
+
+/// @brief Leading-edge time of one SiPM: arrival time of the n-th photon (n = photon threshold).
+struct SiPMTime {
+    short siPMID;
+    double t;
+    int nPhoton; // all photons of this hit on the SiPM, i.e. the amplitude
+};
+
+/// @brief A TTC tile hit with its fired SiPMs.
+struct TileHit {
+    int evtID;
+    int hitID;
+    short tileID;
+    int trkID;
+    int pdgID;
+    double tTrue;
+    float edep;
+    muc::array3d x; // hit position and momentum, for the time of flight between hits of a track
+    muc::array3d p;
+    std::vector<SiPMTime> siPM;
+};
+
+/// @brief TTC time calibration: SiPM time-walk correction and tile time offsets.
+///
+/// The corrected SiPM time is t - (c0 + c1 / sqrt(nPhoton)), the tile hit time is the mean of corrected
+/// SiPM times minus the tile offset. The time walk is fitted on simulation (against the truth hit time).
+/// Tile offsets are calibrated iteratively on hits of the same track: each hit time minus its expected
+/// time of flight from the first hit of the track (the path length of the track extrapolated from that
+/// hit to the plane through the hit, normal to its momentum, with the charge and mass of the particle
+/// by its PDG ID) is compared with the mean of its track,
+/// and tile offsets are shifted by the mean residual until they converge. The mean offset is fixed to
+/// zero. Fits are done over all processes.
+class TimeCalibration {
+public:
+    TimeCalibration();
+
+    auto WalkConstant() const -> auto { return fWalkConstant; }
+    auto WalkCoefficient() const -> auto { return fWalkCoefficient; }
+    auto Walk(double nPhoton) const -> double;
+    auto TileOffset(int tileID) const -> double;
+    auto SiPMResolution() const -> auto { return fSiPMResolution; }
+
+    /// @brief Walk-corrected, offset-subtracted hit time. NaN if no SiPM fired.
+    auto HitTime(const TileHit& hit) const -> double;
+
+    auto FitWalk(const std::vector<std::vector<TileHit>>& hit) -> void;
+    /// @return Number of iterations done.
+    auto FitTileOffset(const std::vector<std::vector<TileHit>>& hit, int maxIteration, double tolerance) -> int;
+
+    auto Import(const YAML::Node& node) -> void;
+    auto Export(YAML::Node& node) const -> void;
+
+private:
+    double fWalkConstant;
+    double fWalkCoefficient;
+    double fSiPMResolution;
+    std::vector<double> fTileOffset;
+};
+
+} // namespace MACE::ReconTTC
@@ -0,0 +1,6 @@
+# $1: SimTTC output file (with TTCSimHit and TTCSiPMHit), $2 (optional): time calibration
+if [ -z "$2" ]; then
+    ReconTTC $1 --photon-threshold 3
+else
+    ReconTTC $1 --photon-threshold 3 --calibration $2
+fi
@@ -0,0 +1,233 @@
+#include "MACE/AnaTargetYield/AnaTargetYield.h++"
+#include "MACE/Detector/Description/Target.h++"
+#include "MACE/SimTarget/Analysis.h++"
+
+#include "Mustard/CLI/BasicCLI.h++"
+#include "Mustard/Data/Processor.h++"
+#include "Mustard/Detector/Description/DescriptionIO.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "ROOT/RDataFrame.hxx"
+
+#include "mplr/mplr.hpp"
+
+#include "muc/array"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MACE::AnaTargetYield {
+
+using namespace std::string_literals;
+
+namespace {
+
+struct DesignPoint {
+    std::string description;
+    std::optional<double> thickness;
+    std::optional<double> spacing;
+    std::optional<double> diameter;
+};
+
+auto ApplyDesignPoint(const DesignPoint& point) -> void {
+    Mustard::Detector::Description::DescriptionIO::Import<Detector::Description::Target>(point.description);
+    auto& target{Detector::Description::Target::Instance()};
+    switch (target.ShapeType()) {
+    case Detector::Description::Target::TargetShapeType::Cuboid:
+        if (point.thickness) {
+            target.Cuboid().Thickness(*point.thickness);
+        }
+        if (point.spacing) {
+            target.Cuboid().Perforated().Spacing(*point.spacing);
+        }
+        if (point.diameter) {
+            target.Cuboid().Perforated().Diameter(*point.diameter);
+        }
+        return;
+    case Detector::Description::Target::TargetShapeType::MultiLayer:
+        if (point.thickness) {
+            target.MultiLayer().Thickness(*point.thickness);
+        }
+        if (point.spacing) {
+            target.MultiLayer().Perforated().Spacing(*point.spacing);
+        }
+        if (point.diameter) {
+            target.MultiLayer().Perforated().Diameter(*point.diameter);
+        }
+        return;
+    case Detector::Description::Target::TargetShapeType::Cylinder:
+        if (point.thickness) {
+            target.Cylinder().Thickness(*point.thickness);
+        }
+        if (point.spacing or point.diameter) {
+            Mustard::PrintWarning("Cylinder target has no perforation, --spacing and --diameter are ignored");
+        }
+        return;
+    }
+}
+
+/// Split [0, n) into nThread chunks and run Task(begin, count) on each in its own thread.
+auto ParallelFor(gsl::index n, int nThread, const std::function<void(gsl::index, gsl::index)>& Task) -> void {
+    std::vector<std::jthread> thread;
+    thread.reserve(nThread);
+    const auto chunk{(n + nThread - 1) / nThread};
+    for (gsl::index begin{}; begin < n; begin += chunk) {
+        thread.emplace_back(Task, begin, std::min(chunk, n - begin));
+    }
+}
+
+/// Binomial proportion k/n and its standard error.
+auto Proportion(unsigned long long k, unsigned long long n) -> std::array<double, 2> {
+    if (n == 0) {
+        return {};
+    }
+    const auto p{static_cast<double>(k) / n};
+    return {p, std::sqrt(p * (1 - p) / n)};
+}
+
+} // namespace
+
+AnaTargetYield::AnaTargetYield() :
+    Subprogram{"AnaTargetYield", "Re-evaluate muonium yields of stored SimTarget MuoniumTrack trees against target descriptions."} {}
+
+auto AnaTargetYield::Main(int argc, char* argv[]) const -> int {
+    Mustard::CLI::BasicCLI<> cli;
+    cli->add_argument("input").help("Input file path(s).").nargs(argparse::nargs_pattern::at_least_one);
+    cli->add_argument("-t", "--input-tree").help("Input tree name.").default_value("G4Run0/MuoniumTrack"s).required().nargs(1);
+    cli->add_argument("-c", "--description").help("Description YAML file path(s), each is a design point.").nargs(argparse::nargs_pattern::at_least_one).required();
+    cli->add_argument("--thickness").help("Scan over target thickness (applied to the selected shape).").nargs(argparse::nargs_pattern::at_least_one).scan<'g', double>();
+    cli->add_argument("--spacing").help("Scan over perforation spacing.").nargs(argparse::nargs_pattern::at_least_one).scan<'g', double>();
+    cli->add_argument("--diameter").help("Scan over perforation hole diameter.").nargs(argparse::nargs_pattern::at_least_one).scan<'g', double>();
+    cli->add_argument("-n", "--n-muon").help("Number of simulated muons. If not set, yields are normalized to formed muonium.").nargs(1).scan<'i', unsigned long long>();
+    cli->add_argument("-j", "--n-thread").help("Number of threads per process.").default_value(1).required().nargs(1).scan<'i', int>();
+    cli->add_argument("-o", "--output").help("Output CSV file path.").default_value("target_yield.csv"s).required().nargs(1);
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+
+    // Design points: descriptions x thickness x spacing x diameter
+
+    std::vector<DesignPoint> designPoint;
+    const auto Values{[&](const char* name) -> std::vector<std::optional<double>> {
+        const auto value{cli->present<std::vector<double>>(name)};
+        if (not value) {
+            return {std::nullopt};
+        }
+        return {value->begin(), value->end()};
+    }};
+    for (auto&& description : cli->get<std::vector<std::string>>("--description")) {
+        for (auto&& thickness : Values("--thickness")) {
+            for (auto&& spacing : Values("--spacing")) {
+                for (auto&& diameter : Values("--diameter")) {
+                    designPoint.push_back({description, thickness, spacing, diameter});
+                }
+            }
+        }
+    }
+
+    // Load decay positions (SoA), distributed over processes
+
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+    Mustard::Data::Processor processor;
+    processor.Process<SimTarget::MuoniumTrack>(
+        ROOT::RDataFrame{cli->get("--input-tree"), cli->get<std::vector<std::string>>("input")}, int{}, "EvtID",
+        [&](bool byPass, auto&& event) {
+            if (byPass) {
+                return;
+            }
+            for (auto&& track : event) {
+                const auto r{Get<"x">(*track).As<muc::array3d>()};
+                x.emplace_back(r[0]);
+                y.emplace_back(r[1]);
+                z.emplace_back(r[2]);
+            }
+        });
+
+    // Evaluate yields
+
+    const auto nThread{std::max(1, cli->get<int>("--n-thread"))};
+    const auto nDecay{ssize(x)};
+    const auto contain{std::make_unique_for_overwrite<bool[]>(nDecay)};
+    const auto detectable{std::make_unique_for_overwrite<bool[]>(nDecay)};
+    std::vector<std::array<unsigned long long, 4>> yieldData;
+    yieldData.reserve(designPoint.size());
+    for (auto&& point : designPoint) {
+        ApplyDesignPoint(point);
+        const auto& target{Detector::Description::Target::Instance()};
+        ParallelFor(nDecay, nThread, [&](gsl::index begin, gsl::index count) {
+            const auto Sub{[&](auto&& v) { return std::span{v}.subspan(begin, count); }};
+            target.Contain(Sub(x), Sub(y), Sub(z), std::span{contain.get() + begin, static_cast<std::size_t>(count)});
+            target.DetectableAt(Sub(x), Sub(y), Sub(z), std::span{detectable.get() + begin, static_cast<std::size_t>(count)});
+        });
+        auto& [nFormed, nTargetDecay, nVacuumDecay, nDetectableDecay]{yieldData.emplace_back()};
+        nFormed = nDecay;
+        nTargetDecay = std::count(contain.get(), contain.get() + nDecay, true);
+        nVacuumDecay = nFormed - nTargetDecay;
+        nDetectableDecay = 0;
+        for (gsl::index i{}; i < nDecay; ++i) {
+            nDetectableDecay += not contain[i] and detectable[i];
+        }
+    }
+
+    // Reduce and write
+
+    const auto& worldComm{mplr::comm_world()};
+    for (auto&& data : yieldData) {
+        worldComm.reduce(
+            [](const std::array<unsigned long long, 4>& a, const std::array<unsigned long long, 4>& b) {
+                std::array<unsigned long long, 4> c;
+                std::ranges::transform(a, b, c.begin(), std::plus{});
+                return c;
+            },
+            0, data);
+    }
+    if (worldComm.rank() != 0) {
+        return EXIT_SUCCESS;
+    }
+
+    const auto outputPath{cli->get("--output")};
+    const auto file{std::fopen(outputPath.c_str(), "wx")};
+    if (file == nullptr) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Cannot create '{}' (already exists?)", outputPath));
+    }
+    const auto nMuon{cli->present<unsigned long long>("--n-muon")};
+    fmt::println(file, "description,thickness,spacing,diameter,nMuon,nMFormed,nMTargetDecay,nMVacuumDecay,nMDetectableDecay,"
+                       "vacuumYield,vacuumYieldError,detectableYield,detectableYieldError");
+    Mustard::MasterPrintLn("{:>6} {:>12} {:>12} {:>12} {:>24} {:>24}", "Point", "Thickness", "Spacing", "Diameter", "Vacuum yield", "Detectable yield");
+    for (gsl::index i{}; i < ssize(designPoint); ++i) {
+        const auto& [description, thickness, spacing, diameter]{designPoint[i]};
+        const auto& [nFormed, nTargetDecay, nVacuumDecay, nDetectableDecay]{yieldData[i]};
+        const auto nNormalization{nMuon.value_or(nFormed)};
+        const auto [vacuumYield, vacuumYieldError]{Proportion(nVacuumDecay, nNormalization)};
+        const auto [detectableYield, detectableYieldError]{Proportion(nDetectableDecay, nNormalization)};
+        const auto Optional{[](auto&& v) { return v ? fmt::format("{}", *v) : ""s; }};
+        fmt::println(file, "{},{},{},{},{},{},{},{},{},{},{},{},{}",
+                     description, Optional(thickness), Optional(spacing), Optional(diameter),
+                     nMuon ? fmt::format("{}", *nMuon) : ""s, nFormed, nTargetDecay, nVacuumDecay, nDetectableDecay,
+                     vacuumYield, vacuumYieldError, detectableYield, detectableYieldError);
+        Mustard::MasterPrintLn("{:>6} {:>12} {:>12} {:>12} {:>11.4e} +/- {:<9.2e} {:>11.4e} +/- {:<9.2e}",
+                               i, Optional(thickness), Optional(spacing), Optional(diameter),
+                               vacuumYield, vacuumYieldError, detectableYield, detectableYieldError);
+    }
+    std::fclose(file);
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::AnaTargetYield
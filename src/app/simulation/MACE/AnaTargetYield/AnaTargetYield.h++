@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::AnaTargetYield {
+
+class AnaTargetYield : public Mustard::Application::Subprogram {
+public:
+    AnaTargetYield();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::AnaTargetYield
@@ -47,6 +47,7 @@
 #include "MACE/Detector/Description/ECAL.h++"
 #include "MACE/Detector/Description/MCP.h++"
 #include "MACE/Detector/Field/AcceleratorField.h++"
+#include "MACE/Detector/Field/AsConcreteG4Field.h++"
 #include "MACE/Detector/Field/ECALField.h++"
 #include "MACE/Detector/Field/MMSField.h++"
 #include "MACE/Detector/Field/SolenoidFieldS1.h++"
@@ -58,7 +59,6 @@
 #include "MACE/SimDose/Messenger/DetectorMessenger.h++"
 
 #include "Mustard/Detector/Definition/DefinitionBase.h++"
-#include "Mustard/Detector/Field/AsG4Field.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
 
 #include "G4ChordFinder.hh"
@@ -214,26 +214,26 @@ auto DetectorConstruction::Construct() -> G4VPhysicalVolume* {
                     chordFinder->SetDeltaChord(fDeltaChord);
                     detector.RegisterField(std::make_unique<G4FieldManager>(field, chordFinder), forceToAllDaughters);
                 }};
-            RegisterField(mmsField, new Mustard::Detector::Field::AsG4Field<MACE::Detector::Field::MMSField>, false);
-            RegisterField(solenoidFieldS1, new Mustard::Detector::Field::AsG4Field<MACE::Detector::Field::SolenoidFieldS1>, false);
-            RegisterField(solenoidFieldT1, new Mustard::Detector::Field::AsG4Field<MACE::Detector::Field::SolenoidFieldT1>, false);
-            RegisterField(solenoidFieldS2, new Mustard::Detector::Field::AsG4Field<MACE::Detector::Field::SolenoidFieldS2>, false);
-            RegisterField(solenoidFieldT2, new Mustard::Detector::Field::AsG4Field<MACE::Detector::Field::SolenoidFieldT2>, false);
-            RegisterField(solenoidFieldS3, new Mustard::Detector::Field::AsG4Field<MACE::Detector::Field::SolenoidFieldS3>, false);
-            RegisterField(ecalField, new Mustard::Detector::Field::AsG4Field<MACE::Detector::Field::ECALField>, false);
+            MACE::Detector::Field::VisitAsG4Field<MACE::Detector::Field::MMSField>([&](auto field) { RegisterField(mmsField, field, false); });
+            MACE::Detector::Field::VisitAsG4Field<MACE::Detector::Field::SolenoidFieldS1>([&](auto field) { RegisterField(solenoidFieldS1, field, false); });
+            MACE::Detector::Field::VisitAsG4Field<MACE::Detector::Field::SolenoidFieldT1>([&](auto field) { RegisterField(solenoidFieldT1, field, false); });
+            MACE::Detector::Field::VisitAsG4Field<MACE::Detector::Field::SolenoidFieldS2>([&](auto field) { RegisterField(solenoidFieldS2, field, false); });
+            MACE::Detector::Field::VisitAsG4Field<MACE::Detector::Field::SolenoidFieldT2>([&](auto field) { RegisterField(solenoidFieldT2, field, false); });
+            MACE::Detector::Field::VisitAsG4Field<MACE::Detector::Field::SolenoidFieldS3>([&](auto field) { RegisterField(solenoidFieldS3, field, false); });
+            MACE::Detector::Field::VisitAsG4Field<MACE::Detector::Field::ECALField>([&](auto field) { RegisterField(ecalField, field, false); });
         }
         { // Accelerator EM field, must be reigstered after MMS magnetic field
-            using Field = Mustard::Detector::Field::AsG4Field<MACE::Detector::Field::AcceleratorField>;
-            using Equation = G4EqMagElectricField;
-            using Stepper = G4TDormandPrince45<Equation, 8>;
-            using Driver = G4InterpolationDriver<Stepper>;
-            const auto field{new Field};
-            const auto equation{new Equation{field}}; // clang-format off
-            const auto stepper{new Stepper{equation, 8}};
-            const auto driver{new Driver{fMinDriverStep, stepper, 8}}; // clang-format on
-            const auto chordFinder{new G4ChordFinder{driver}};
-            chordFinder->SetDeltaChord(fDeltaChord);
-            acceleratorField.RegisterField(std::make_unique<G4FieldManager>(field, chordFinder), false);
+            MACE::Detector::Field::VisitAsG4Field<MACE::Detector::Field::AcceleratorField>([&](auto field) {
+                using Equation = G4EqMagElectricField;
+                using Stepper = G4TDormandPrince45<Equation, 8>;
+                using Driver = G4InterpolationDriver<Stepper>;
+                const auto equation{new Equation{field}}; // clang-format off
+                const auto stepper{new Stepper{equation, 8}};
+                const auto driver{new Driver{fMinDriverStep, stepper, 8}}; // clang-format on
+                const auto chordFinder{new G4ChordFinder{driver}};
+                chordFinder->SetDeltaChord(fDeltaChord);
+                acceleratorField.RegisterField(std::make_unique<G4FieldManager>(field, chordFinder), false);
+            });
         }
     }
 
@@ -25,11 +25,29 @@
 #include "G4SystemOfUnits.hh"
 
 #include <array>
+#include <utility>
 
 namespace MACE::SimECAL::inline Action {
 
 using namespace Mustard::LiteralUnit;
 
+namespace {
+
+// sensitive detectors outlive /run/reinitializeGeometry (e.g. in a design scan) and cannot be registered twice,
+// so a reused one reloads what it derived from the (possibly re-imported) descriptions
+template<typename ASD>
+auto FindOrNewSD(const G4String& name, auto&&... args) -> ASD* {
+    if (const auto sd{static_cast<ASD*>(G4SDManager::GetSDMpointer()->FindSensitiveDetector(name, false))}) {
+        if constexpr (requires { sd->ReloadDescription(); }) {
+            sd->ReloadDescription();
+        }
+        return sd;
+    }
+    return new ASD{name, std::forward<decltype(args)>(args)...};
+}
+
+} // namespace
+
 DetectorConstruction::DetectorConstruction() :
     PassiveSingleton{this},
     G4VUserDetectorConstruction{},
@@ -66,12 +84,12 @@ auto DetectorConstruction::Construct() -> G4VPhysicalVolume* {
     // ecalShield.RegisterRegion(shieldRegion);
 
     const auto& ecalName{MACE::Detector::Description::ECAL::Instance().Name()};
-    const auto ecalPMSD{new SD::ECALPMSD{ecalName + "PM"}};
+    const auto ecalPMSD{FindOrNewSD<SD::ECALPMSD>(ecalName + "PM")};
 
-    ecalCrystal.RegisterSD(new SD::ECALSD{ecalName, ecalPMSD});
+    ecalCrystal.RegisterSD(FindOrNewSD<SD::ECALSD>(ecalName, ecalPMSD));
     ecalPhotoSensor.RegisterSD("ECALPMCathode", ecalPMSD);
 
-    mcp.RegisterSD(new SD::MCPSD{MACE::Detector::Description::MCP::Instance().Name()});
+    mcp.RegisterSD(FindOrNewSD<SD::MCPSD>(MACE::Detector::Description::MCP::Instance().Name()));
 
     // fWorld->ParallelExport("ECALPhaseII.gdml");
 
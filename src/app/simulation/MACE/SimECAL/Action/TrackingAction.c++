@@ -2,6 +2,7 @@
 #include "MACE/SimECAL/Action/PrimaryGeneratorAction.h++"
 #include "MACE/SimECAL/Action/TrackingAction.h++"
 #include "MACE/SimECAL/Analysis.h++"
+#include "MACE/Simulation/Generator/PrimaryIndex.h++"
 
 #include "G4Event.hh"
 #include "G4EventManager.hh"
@@ -45,6 +46,7 @@ auto TrackingAction::UpdateDecayVertexData(const G4Track& track) -> void {
         auto& vertex{fDecayVertexData.emplace_back(std::make_unique_for_overwrite<Mustard::Data::Tuple<Data::SimDecayVertex>>())};
         Get<"EvtID">(*vertex) = eventManager.GetConstCurrentEvent()->GetEventID();
         Get<"TrkID">(*vertex) = track.GetTrackID();
+        Get<"PrmID">(*vertex) = PrimaryIndex::Of(track);
         Get<"PDGID">(*vertex) = track.GetParticleDefinition()->GetPDGEncoding();
         Get<"SecPDGID">(*vertex) = std::move(secondaryPDGID);
         Get<"t">(*vertex) = track.GetGlobalTime();
@@ -3,6 +3,7 @@
 #include "MACE/SimECAL/Analysis.h++"
 #include "MACE/SimECAL/RunManager.h++"
 #include "MACE/Simulation/Physics/StandardPhysicsList.h++"
+#include "MACE/Simulation/Run/DesignScan.h++"
 
 #include "Mustard/Env/BasicEnv.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
@@ -15,7 +16,8 @@ using namespace Mustard::LiteralUnit::Energy;
 
 RunManager::RunManager() :
     MPIRunManager{},
-    fAnalysis{std::make_unique_for_overwrite<Analysis>()} {
+    fAnalysis{std::make_unique_for_overwrite<Analysis>()},
+    fDesignScan{std::make_unique<DesignScan>([] { DetectorConstruction::Instance().DestroyGeometry(); })} {
 
     SetUserInitialization(new StandardPhysicsList);
 
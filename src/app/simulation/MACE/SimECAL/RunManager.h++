@@ -4,6 +4,10 @@
 
 #include <memory>
 
+namespace MACE::inline Simulation::inline Run {
+class DesignScan;
+} // namespace MACE::inline Simulation::inline Run
+
 namespace MACE::SimECAL {
 
 class Analysis;
@@ -17,6 +21,7 @@ public:
 
 private:
     std::unique_ptr<Analysis> fAnalysis;
+    std::unique_ptr<DesignScan> fDesignScan;
 };
 
 } // namespace MACE::SimECAL
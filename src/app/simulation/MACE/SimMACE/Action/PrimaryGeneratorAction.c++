@@ -1,29 +1,78 @@
 #include "MACE/SimMACE/Action/PrimaryGeneratorAction.h++"
 #include "MACE/SimMACE/Action/TrackingAction.h++"
 #include "MACE/SimMACE/Analysis.h++"
+#include "MACE/Simulation/Generator/PrimaryIndex.h++"
+
+#include "Mustard/Utility/LiteralUnit.h++"
 
 #include "G4Event.hh"
+#include "G4Poisson.hh"
 #include "G4PrimaryVertex.hh"
+#include "Randomize.hh"
+
+#include <cmath>
 
 namespace MACE::SimMACE::inline Action {
 
+using namespace Mustard::LiteralUnit::Time;
+
 PrimaryGeneratorAction::PrimaryGeneratorAction() :
     PassiveSingleton{this},
     G4VUserPrimaryGeneratorAction{},
     fAvailableGenerator{},
     fGenerator{&fAvailableGenerator.gpsx},
+    fPileUp{false},
+    fBeamRate{1e8 / 1_s},
+    fPileUpTimeWindow{-1_us, 1_us},
+    fBunchPeriod{0},
+    fBunchWidth{0},
     fSavePrimaryVertexData{true},
     fPrimaryVertexData{},
     fAnalysisMessengerRegister{this},
     fPrimaryGeneratorActionMessengerRegister{this} {}
 
+auto PrimaryGeneratorAction::DecayVertexProductFromMatrixElement(bool val) -> void {
+    fAvailableGenerator.decayVertexPrimaryGenerator.DecayProductGenerator(val ? &fAvailableGenerator.matrixElementPrimaryGenerator : nullptr);
+}
+
 auto PrimaryGeneratorAction::GeneratePrimaries(G4Event* event) -> void {
-    fGenerator->GeneratePrimaryVertex(event);
+    if (fPileUp) {
+        GeneratePileUpPrimaries(*event);
+    } else {
+        fGenerator->GeneratePrimaryVertex(event);
+    }
     if (fSavePrimaryVertexData) {
         UpdatePrimaryVertexData(*event);
     }
 }
 
+auto PrimaryGeneratorAction::GeneratePileUpPrimaries(G4Event& event) const -> void {
+    // a Poisson number of beam particles arrive in the time window,
+    // each of them is one call to the selected generator, shifted to its arrival time
+    const auto [tBegin, tEnd]{fPileUpTimeWindow};
+    const auto nPrimary{static_cast<int>(G4Poisson(fBeamRate * (tEnd - tBegin)))};
+    for (int primaryIndex{}; primaryIndex < nPrimary; ++primaryIndex) {
+        const auto nVertexBefore{event.GetNumberOfPrimaryVertex()};
+        fGenerator->GeneratePrimaryVertex(&event);
+        const auto tArrival{BeamArrivalTime()};
+        for (auto i{nVertexBefore}; i < event.GetNumberOfPrimaryVertex(); ++i) {
+            auto& vertex{*event.GetPrimaryVertex(i)};
+            vertex.SetT0(vertex.GetT0() + tArrival);
+            PrimaryIndex::Assign(vertex, primaryIndex);
+        }
+    }
+}
+
+auto PrimaryGeneratorAction::BeamArrivalTime() const -> double {
+    const auto [tBegin, tEnd]{fPileUpTimeWindow};
+    const auto t{G4RandFlat::shoot(tBegin, tEnd)};
+    if (fBunchPeriod <= 0) {
+        return t; // continuous (DC) beam
+    }
+    // bunched beam: the nearest bunch, smeared by the bunch width
+    return std::round(t / fBunchPeriod) * fBunchPeriod + G4RandGauss::shoot(0, fBunchWidth);
+}
+
 auto PrimaryGeneratorAction::UpdatePrimaryVertexData(const G4Event& event) -> void {
     fPrimaryVertexData.clear();
     fPrimaryVertexData.reserve(event.GetNumberOfPrimaryVertex());
@@ -31,11 +80,13 @@ auto PrimaryGeneratorAction::UpdatePrimaryVertexData(const G4Event& event) -> vo
         for (const auto* pp{pv->GetPrimary()}; pp; pp = pp->GetNext()) {
             const auto& v{fPrimaryVertexData.emplace_back(std::make_unique_for_overwrite<Mustard::Data::Tuple<Data::SimPrimaryVertex>>())};
             Get<"EvtID">(*v) = event.GetEventID();
+            Get<"PrmID">(*v) = PrimaryIndex::Of(*pp);
             Get<"PDGID">(*v) = pp->GetPDGcode();
             Get<"t0">(*v) = pv->GetT0();
             Get<"x0">(*v) = pv->GetPosition();
             Get<"Ek0">(*v) = pp->GetKineticEnergy();
             Get<"p0">(*v) = pp->GetMomentum();
+            Get<"w">(*v) = pv->GetWeight();
         }
     }
     Analysis::Instance().SubmitPrimaryVertexData(fPrimaryVertexData);
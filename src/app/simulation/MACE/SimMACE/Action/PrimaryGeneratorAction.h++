@@ -3,6 +3,8 @@
 #include "MACE/Data/SimVertex.h++"
 #include "MACE/SimMACE/Messenger/AnalysisMessenger.h++"
 #include "MACE/SimMACE/Messenger/PrimaryGeneratorActionMessenger.h++"
+#include "MACE/Simulation/Generator/DecayVertexPrimaryGenerator.h++"
+#include "MACE/Simulation/Generator/MatrixElementPrimaryGenerator.h++"
 
 #include "Mustard/Data/Tuple.h++"
 #include "Mustard/Env/Memory/PassiveSingleton.h++"
@@ -13,6 +15,8 @@
 
 #include "muc/ptrvec"
 
+#include <utility>
+
 namespace MACE::SimMACE::inline Action {
 
 class PrimaryGeneratorAction final : public Mustard::Env::Memory::PassiveSingleton<PrimaryGeneratorAction>,
@@ -22,6 +26,20 @@ public:
 
     auto SwitchToGPSX() -> void { fGenerator = &fAvailableGenerator.gpsx; }
     auto SwitchToFromDataPrimaryGenerator() -> void { fGenerator = &fAvailableGenerator.dataReaderPrimaryGenerator; }
+    auto SwitchToMatrixElementPrimaryGenerator() -> void { fGenerator = &fAvailableGenerator.matrixElementPrimaryGenerator; }
+    auto SwitchToDecayVertexPrimaryGenerator() -> void { fGenerator = &fAvailableGenerator.decayVertexPrimaryGenerator; }
+    auto DecayVertexProductFromMatrixElement(bool val) -> void;
+
+    auto PileUp() const -> auto { return fPileUp; }
+    auto PileUp(bool val) -> void { fPileUp = val; }
+    auto BeamRate() const -> auto { return fBeamRate; }
+    auto BeamRate(double val) -> void { fBeamRate = val; }
+    auto PileUpTimeWindow() const -> const auto& { return fPileUpTimeWindow; }
+    auto PileUpTimeWindow(std::pair<double, double> val) -> void { fPileUpTimeWindow = val; }
+    auto BunchPeriod() const -> auto { return fBunchPeriod; }
+    auto BunchPeriod(double val) -> void { fBunchPeriod = val; }
+    auto BunchWidth() const -> auto { return fBunchWidth; }
+    auto BunchWidth(double val) -> void { fBunchWidth = val; }
 
     auto SavePrimaryVertexData() const -> auto { return fSavePrimaryVertexData; }
     auto SavePrimaryVertexData(bool val) -> void { fSavePrimaryVertexData = val; }
@@ -29,15 +47,25 @@ public:
     auto GeneratePrimaries(G4Event* event) -> void override;
 
 private:
+    auto GeneratePileUpPrimaries(G4Event& event) const -> void;
+    auto BeamArrivalTime() const -> double;
     auto UpdatePrimaryVertexData(const G4Event& event) -> void;
 
 private:
     struct {
         Mustard::Geant4X::GeneralParticleSourceX gpsx;
         Mustard::Geant4X::DataReaderPrimaryGenerator dataReaderPrimaryGenerator;
+        MatrixElementPrimaryGenerator matrixElementPrimaryGenerator;
+        DecayVertexPrimaryGenerator decayVertexPrimaryGenerator;
     } fAvailableGenerator;
     G4VPrimaryGenerator* fGenerator;
 
+    bool fPileUp;
+    double fBeamRate;
+    std::pair<double, double> fPileUpTimeWindow;
+    double fBunchPeriod;
+    double fBunchWidth;
+
     bool fSavePrimaryVertexData;
     muc::unique_ptrvec<Mustard::Data::Tuple<Data::SimPrimaryVertex>> fPrimaryVertexData;
 
@@ -2,6 +2,7 @@
 #include "MACE/SimMACE/Action/PrimaryGeneratorAction.h++"
 #include "MACE/SimMACE/Action/TrackingAction.h++"
 #include "MACE/SimMACE/Analysis.h++"
+#include "MACE/Simulation/Generator/PrimaryIndex.h++"
 
 #include "G4Event.hh"
 #include "G4EventManager.hh"
@@ -26,6 +27,7 @@ TrackingAction::TrackingAction() :
     fMessengerRegister{this} {}
 
 auto TrackingAction::PostUserTrackingAction(const G4Track* track) -> void {
+    PrimaryIndex::PropagateToSecondary(*track, *fpTrackingManager->GimmeSecondaries());
     if (fSaveDecayVertexData) {
         UpdateDecayVertexData(*track);
     }
@@ -45,6 +47,7 @@ auto TrackingAction::UpdateDecayVertexData(const G4Track& track) -> void {
         auto& vertex{fDecayVertexData.emplace_back(std::make_unique_for_overwrite<Mustard::Data::Tuple<Data::SimDecayVertex>>())};
         Get<"EvtID">(*vertex) = eventManager.GetConstCurrentEvent()->GetEventID();
         Get<"TrkID">(*vertex) = track.GetTrackID();
+        Get<"PrmID">(*vertex) = PrimaryIndex::Of(track);
         Get<"PDGID">(*vertex) = track.GetParticleDefinition()->GetPDGEncoding();
         Get<"SecPDGID">(*vertex) = std::move(secondaryPDGID);
         Get<"t">(*vertex) = track.GetGlobalTime();
@@ -1,14 +1,32 @@
 #include "MACE/SimMACE/Action/PrimaryGeneratorAction.h++"
 #include "MACE/SimMACE/Messenger/PrimaryGeneratorActionMessenger.h++"
 
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAString.hh"
 #include "G4UIcmdWithoutParameter.hh"
+#include "G4UIcommand.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIparameter.hh"
+
+#include <sstream>
+#include <string>
 
 namespace MACE::SimMACE::inline Messenger {
 
 PrimaryGeneratorActionMessenger::PrimaryGeneratorActionMessenger() :
     SingletonMessenger{},
     fSwitchToGPSX{},
-    fSwitchToFromDataPrimaryGenerator{} {
+    fSwitchToFromDataPrimaryGenerator{},
+    fSwitchToMatrixElementPrimaryGenerator{},
+    fSwitchToDecayVertexPrimaryGenerator{},
+    fDecayVertexProduct{},
+    fPileUpDirectory{},
+    fPileUp{},
+    fBeamRate{},
+    fPileUpTimeWindow{},
+    fBunchPeriod{},
+    fBunchWidth{} {
 
     fSwitchToGPSX = std::make_unique<G4UIcmdWithoutParameter>("/MACE/Generator/SwitchToGPSX", this);
     fSwitchToGPSX->SetGuidance("If set then the G4GeneralParticleSource will be used.");
@@ -17,11 +35,67 @@ PrimaryGeneratorActionMessenger::PrimaryGeneratorActionMessenger() :
     fSwitchToFromDataPrimaryGenerator = std::make_unique<G4UIcmdWithoutParameter>("/MACE/Generator/SwitchToFromDataPrimaryGenerator", this);
     fSwitchToFromDataPrimaryGenerator->SetGuidance("If set then the EcoMug generator will be used.");
     fSwitchToFromDataPrimaryGenerator->AvailableForStates(G4State_Idle);
+
+    fSwitchToMatrixElementPrimaryGenerator = std::make_unique<G4UIcmdWithoutParameter>("/MACE/Generator/SwitchToMatrixElementPrimaryGenerator", this);
+    fSwitchToMatrixElementPrimaryGenerator->SetGuidance("If set then decays will be sampled in-process by the matrix-element-based generator "
+                                                        "(see /MACE/Generator/MatrixElement/).");
+    fSwitchToMatrixElementPrimaryGenerator->AvailableForStates(G4State_Idle);
+
+    fSwitchToDecayVertexPrimaryGenerator = std::make_unique<G4UIcmdWithoutParameter>("/MACE/Generator/SwitchToDecayVertexPrimaryGenerator", this);
+    fSwitchToDecayVertexPrimaryGenerator->SetGuidance("If set then decay vertices of a previous simulation (e.g. SimTarget) will be resampled "
+                                                      "(see /MACE/Generator/DecayVertex/).");
+    fSwitchToDecayVertexPrimaryGenerator->AvailableForStates(G4State_Idle);
+
+    fDecayVertexProduct = std::make_unique<G4UIcmdWithAString>("/MACE/Generator/DecayVertex/DecayProduct", this);
+    fDecayVertexProduct->SetGuidance("Decay products of the resampled vertices: from the Geant4 decay table of the parent, "
+                                     "or from the matrix-element generator (see /MACE/Generator/MatrixElement/).");
+    fDecayVertexProduct->SetParameterName("source", false);
+    fDecayVertexProduct->SetCandidates("Geant4 MatrixElement");
+    fDecayVertexProduct->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fPileUpDirectory = std::make_unique<G4UIdirectory>("/MACE/Generator/PileUp/");
+    fPileUpDirectory->SetGuidance("Beam-rate pile-up: several primaries (e.g. beam muons) per event.");
+
+    fPileUp = std::make_unique<G4UIcmdWithABool>("/MACE/Generator/PileUp/Enable", this);
+    fPileUp->SetGuidance("If true, each event contains a Poisson number (mean = beam rate x time window) of primaries "
+                         "from the selected generator, each shifted to its arrival time and labeled by PrmID in the MC truth.");
+    fPileUp->SetParameterName("b", false);
+    fPileUp->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fBeamRate = std::make_unique<G4UIcmdWithADoubleAndUnit>("/MACE/Generator/PileUp/BeamRate", this);
+    fBeamRate->SetGuidance("Mean beam rate.");
+    fBeamRate->SetParameterName("rate", false);
+    fBeamRate->SetUnitCategory("Frequency");
+    fBeamRate->SetRange("rate >= 0");
+    fBeamRate->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fPileUpTimeWindow = std::make_unique<G4UIcommand>("/MACE/Generator/PileUp/TimeWindow", this);
+    fPileUpTimeWindow->SetGuidance("Time window in which the beam particles arrive, e.g. the readout window plus some lookback.");
+    fPileUpTimeWindow->SetParameter(new G4UIparameter{"begin", 'd', false});
+    fPileUpTimeWindow->SetParameter(new G4UIparameter{"end", 'd', false});
+    const auto unit{new G4UIparameter{"unit", 's', true}};
+    unit->SetDefaultUnit("ns");
+    fPileUpTimeWindow->SetParameter(unit);
+    fPileUpTimeWindow->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fBunchPeriod = std::make_unique<G4UIcmdWithADoubleAndUnit>("/MACE/Generator/PileUp/BunchPeriod", this);
+    fBunchPeriod->SetGuidance("Beam time structure: bunch spacing (e.g. accelerator RF period), or 0 for a continuous (DC) beam.");
+    fBunchPeriod->SetParameterName("T", false);
+    fBunchPeriod->SetUnitCategory("Time");
+    fBunchPeriod->SetRange("T >= 0");
+    fBunchPeriod->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fBunchWidth = std::make_unique<G4UIcmdWithADoubleAndUnit>("/MACE/Generator/PileUp/BunchWidth", this);
+    fBunchWidth->SetGuidance("Beam time structure: RMS of the arrival time in a bunch (ignored for continuous beam).");
+    fBunchWidth->SetParameterName("sigma", false);
+    fBunchWidth->SetUnitCategory("Time");
+    fBunchWidth->SetRange("sigma >= 0");
+    fBunchWidth->AvailableForStates(G4State_PreInit, G4State_Idle);
 }
 
 PrimaryGeneratorActionMessenger::~PrimaryGeneratorActionMessenger() = default;
 
-void PrimaryGeneratorActionMessenger::SetNewValue(G4UIcommand* command, G4String) {
+void PrimaryGeneratorActionMessenger::SetNewValue(G4UIcommand* command, G4String value) {
     if (command == fSwitchToGPSX.get()) {
         Deliver<PrimaryGeneratorAction>([&](auto&& r) {
             r.SwitchToGPSX();
@@ -30,6 +104,44 @@ void PrimaryGeneratorActionMessenger::SetNewValue(G4UIcommand* command, G4String
         Deliver<PrimaryGeneratorAction>([&](auto&& r) {
             r.SwitchToFromDataPrimaryGenerator();
         });
+    } else if (command == fSwitchToMatrixElementPrimaryGenerator.get()) {
+        Deliver<PrimaryGeneratorAction>([&](auto&& r) {
+            r.SwitchToMatrixElementPrimaryGenerator();
+        });
+    } else if (command == fSwitchToDecayVertexPrimaryGenerator.get()) {
+        Deliver<PrimaryGeneratorAction>([&](auto&& r) {
+            r.SwitchToDecayVertexPrimaryGenerator();
+        });
+    } else if (command == fDecayVertexProduct.get()) {
+        Deliver<PrimaryGeneratorAction>([&](auto&& r) {
+            r.DecayVertexProductFromMatrixElement(value == "MatrixElement");
+        });
+    } else if (command == fPileUp.get()) {
+        Deliver<PrimaryGeneratorAction>([&](auto&& r) {
+            r.PileUp(fPileUp->GetNewBoolValue(value));
+        });
+    } else if (command == fBeamRate.get()) {
+        Deliver<PrimaryGeneratorAction>([&](auto&& r) {
+            r.BeamRate(fBeamRate->GetNewDoubleValue(value));
+        });
+    } else if (command == fPileUpTimeWindow.get()) {
+        Deliver<PrimaryGeneratorAction>([&](auto&& r) {
+            std::istringstream is{value};
+            double begin;
+            double end;
+            std::string unit;
+            is >> begin >> end >> unit;
+            const auto unitValue{G4UIcommand::ValueOf(unit.c_str())};
+            r.PileUpTimeWindow({begin * unitValue, end * unitValue});
+        });
+    } else if (command == fBunchPeriod.get()) {
+        Deliver<PrimaryGeneratorAction>([&](auto&& r) {
+            r.BunchPeriod(fBunchPeriod->GetNewDoubleValue(value));
+        });
+    } else if (command == fBunchWidth.get()) {
+        Deliver<PrimaryGeneratorAction>([&](auto&& r) {
+            r.BunchWidth(fBunchWidth->GetNewDoubleValue(value));
+        });
     }
 }
 
@@ -4,7 +4,12 @@
 
 #include <memory>
 
+class G4UIcmdWithABool;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAString;
 class G4UIcmdWithoutParameter;
+class G4UIcommand;
+class G4UIdirectory;
 
 namespace MACE::SimMACE {
 
@@ -28,6 +33,16 @@ public:
 private:
     std::unique_ptr<G4UIcmdWithoutParameter> fSwitchToGPSX;
     std::unique_ptr<G4UIcmdWithoutParameter> fSwitchToFromDataPrimaryGenerator;
+    std::unique_ptr<G4UIcmdWithoutParameter> fSwitchToMatrixElementPrimaryGenerator;
+    std::unique_ptr<G4UIcmdWithoutParameter> fSwitchToDecayVertexPrimaryGenerator;
+    std::unique_ptr<G4UIcmdWithAString> fDecayVertexProduct;
+
+    std::unique_ptr<G4UIdirectory> fPileUpDirectory;
+    std::unique_ptr<G4UIcmdWithABool> fPileUp;
+    std::unique_ptr<G4UIcmdWithADoubleAndUnit> fBeamRate;
+    std::unique_ptr<G4UIcommand> fPileUpTimeWindow;
+    std::unique_ptr<G4UIcmdWithADoubleAndUnit> fBunchPeriod;
+    std::unique_ptr<G4UIcmdWithADoubleAndUnit> fBunchWidth;
 };
 
 } // namespace Messenger
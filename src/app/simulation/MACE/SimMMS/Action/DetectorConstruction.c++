@@ -10,6 +10,7 @@
 #include "MACE/Detector/Definition/MMSShield.h++"
 #include "MACE/Detector/Definition/TTC.h++"
 #include "MACE/Detector/Definition/World.h++"
+#include "MACE/Detector/Field/AsConcreteG4Field.h++"
 #include "MACE/Detector/Field/MMSField.h++"
 #include "MACE/SimMMS/Action/DetectorConstruction.h++"
 #include "MACE/SimMMS/Messenger/DetectorMessenger.h++"
@@ -18,7 +19,6 @@
 #include "MACE/SimMMS/SD/TTCSiPMSD.h++"
 
 #include "Mustard/Detector/Definition/DefinitionBase.h++"
-#include "Mustard/Detector/Field/AsG4Field.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
 
 #include "G4ChordFinder.hh"
@@ -91,17 +91,17 @@ auto DetectorConstruction::Construct() -> G4VPhysicalVolume* {
     // Register background fields
     ////////////////////////////////////////////////////////////////
     {
-        using Field = Mustard::Detector::Field::AsG4Field<Detector::Field::MMSField>;
-        using Equation = G4TMagFieldEquation<Field>;
-        using Stepper = G4TDormandPrince45<Equation, 6>;
-        using Driver = G4InterpolationDriver<Stepper>;
-        const auto field{new Field};
-        const auto equation{new Equation{field}}; // clang-format off
-        const auto stepper{new Stepper{equation, 6}};
-        const auto driver{new Driver{fMinDriverStep, stepper, 6}}; // clang-format on
-        const auto chordFinder{new G4ChordFinder{driver}};
-        chordFinder->SetDeltaChord(fDeltaChord);
-        mms.Get<Detector::Definition::MMSField>().RegisterField(std::make_unique<G4FieldManager>(field, chordFinder), false);
+        Detector::Field::VisitAsG4Field<Detector::Field::MMSField>([&]<typename AField>(AField* field) {
+            using Equation = G4TMagFieldEquation<AField>;
+            using Stepper = G4TDormandPrince45<Equation, 6>;
+            using Driver = G4InterpolationDriver<Stepper>;
+            const auto equation{new Equation{field}}; // clang-format off
+            const auto stepper{new Stepper{equation, 6}};
+            const auto driver{new Driver{fMinDriverStep, stepper, 6}}; // clang-format on
+            const auto chordFinder{new G4ChordFinder{driver}};
+            chordFinder->SetDeltaChord(fDeltaChord);
+            mms.Get<Detector::Definition::MMSField>().RegisterField(std::make_unique<G4FieldManager>(field, chordFinder), false);
+        });
     }
 
     return fWorld->PhysicalVolume();
@@ -1,6 +1,7 @@
 #include "MACE/SimMMS/Action/PrimaryGeneratorAction.h++"
 #include "MACE/SimMMS/Action/TrackingAction.h++"
 #include "MACE/SimMMS/Analysis.h++"
+#include "MACE/Simulation/Generator/PrimaryIndex.h++"
 
 #include "G4Event.hh"
 #include "G4PrimaryVertex.hh"
@@ -30,11 +31,13 @@ auto PrimaryGeneratorAction::UpdatePrimaryVertexData(const G4Event& event) -> vo
         for (const auto* pp{pv->GetPrimary()}; pp; pp = pp->GetNext()) {
             const auto& v{fPrimaryVertexData.emplace_back(std::make_unique_for_overwrite<Mustard::Data::Tuple<Data::SimPrimaryVertex>>())};
             Get<"EvtID">(*v) = event.GetEventID();
+            Get<"PrmID">(*v) = PrimaryIndex::Of(*pp);
             Get<"PDGID">(*v) = pp->GetPDGcode();
             Get<"t0">(*v) = pv->GetT0();
             Get<"x0">(*v) = pv->GetPosition();
             Get<"Ek0">(*v) = pp->GetKineticEnergy();
             Get<"p0">(*v) = pp->GetMomentum();
+            Get<"w">(*v) = pv->GetWeight();
         }
     }
     Analysis::Instance().SubmitPrimaryVertexData(fPrimaryVertexData);
@@ -3,6 +3,7 @@
 #include "MACE/Detector/Definition/MMSField.h++"
 #include "MACE/Detector/Definition/TTC.h++"
 #include "MACE/Detector/Definition/World.h++"
+#include "MACE/Detector/Field/AsConcreteG4Field.h++"
 #include "MACE/Detector/Field/MMSField.h++"
 #include "MACE/SimTTC/Action/DetectorConstruction.h++"
 #include "MACE/SimTTC/Messenger/DetectorMessenger.h++"
@@ -10,7 +11,6 @@
 #include "MACE/SimTTC/SD/TTCSiPMSD.h++"
 
 #include "Mustard/Detector/Definition/DefinitionBase.h++"
-#include "Mustard/Detector/Field/AsG4Field.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
 
 #include "G4ChordFinder.hh"
@@ -56,17 +56,17 @@ auto DetectorConstruction::Construct() -> G4VPhysicalVolume* {
     // Register background fields
     ////////////////////////////////////////////////////////////////
 
-    using Field = Mustard::Detector::Field::AsG4Field<Detector::Field::MMSField>;
-    using Equation = G4TMagFieldEquation<Field>;
-    using Stepper = G4TDormandPrince45<Equation, 6>;
-    using Driver = G4InterpolationDriver<Stepper>;
-    const auto field{new Field};
-    const auto equation{new Equation{field}}; // clang-format off
-    const auto stepper{new Stepper{equation, 6}};
-    const auto driver{new Driver{fMinDriverStep, stepper, 6}}; // clang-format on
-    const auto chordFinder{new G4ChordFinder{driver}};
-    chordFinder->SetDeltaChord(fDeltaChord);
-    mmsField.RegisterField(std::make_unique<G4FieldManager>(field, chordFinder), false);
+    Detector::Field::VisitAsG4Field<Detector::Field::MMSField>([&]<typename AField>(AField* field) {
+        using Equation = G4TMagFieldEquation<AField>;
+        using Stepper = G4TDormandPrince45<Equation, 6>;
+        using Driver = G4InterpolationDriver<Stepper>;
+        const auto equation{new Equation{field}}; // clang-format off
+        const auto stepper{new Stepper{equation, 6}};
+        const auto driver{new Driver{fMinDriverStep, stepper, 6}}; // clang-format on
+        const auto chordFinder{new G4ChordFinder{driver}};
+        chordFinder->SetDeltaChord(fDeltaChord);
+        mmsField.RegisterField(std::make_unique<G4FieldManager>(field, chordFinder), false);
+    });
 
     return fWorld->PhysicalVolume();
 }
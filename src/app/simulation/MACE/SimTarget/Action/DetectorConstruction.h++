@@ -26,6 +26,7 @@ public:
     DetectorConstruction();
 
     auto Construct() -> G4VPhysicalVolume* override;
+    auto DestroyGeometry() -> void { fWorld.reset(); }
 
     auto SetCheckOverlaps(G4bool checkOverlaps) -> void { fCheckOverlap = checkOverlaps; }
 
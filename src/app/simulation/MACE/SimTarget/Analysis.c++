@@ -31,6 +31,7 @@ Analysis::Analysis() :
     fFilePath{"SimTarget_untitled"},
     fFileMode{"NEW"},
     fEnableYieldAnalysis{true},
+    fOpenedFilePath{},
     fThisRun{},
     fResultFile{},
     fMuoniumTrack{},
@@ -44,7 +45,9 @@ Analysis::~Analysis() {
 auto Analysis::RunBegin(gsl::not_null<const G4Run*> run) -> void {
     fThisRun = run;
     const auto runID{fThisRun->GetRunID()};
-    if (runID == 0) {
+    // reopen if the file path was changed between runs (e.g. per point of a design scan)
+    if (fResultFile == nullptr or fFilePath != fOpenedFilePath) {
+        Close();
         Open();
     }
     const auto runDirectory{fmt::format("G4Run{}", runID)};
@@ -57,6 +60,7 @@ auto Analysis::RunEnd() -> void {
 }
 
 auto Analysis::Open() -> void {
+    fOpenedFilePath = fFilePath;
     OpenResultFile();
     if (fEnableYieldAnalysis) {
         OpenYieldFile();
@@ -103,6 +107,7 @@ auto Analysis::CloseResultFile() -> void {
     }
     fResultFile->Close();
     delete fResultFile;
+    fResultFile = nullptr;
 }
 
 auto Analysis::OpenYieldFile() -> void {
@@ -161,6 +166,7 @@ auto Analysis::CloseYieldFile() -> void {
         return;
     }
     std::fclose(fYieldFile);
+    fYieldFile = nullptr;
 }
 
 } // namespace MACE::SimTarget
@@ -62,6 +62,7 @@ private:
     std::filesystem::path fFilePath;
     std::string fFileMode;
     bool fEnableYieldAnalysis;
+    std::filesystem::path fOpenedFilePath;
 
     const G4Run* fThisRun;
 
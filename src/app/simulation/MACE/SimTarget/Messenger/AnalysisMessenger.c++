@@ -20,14 +20,14 @@ AnalysisMessenger::AnalysisMessenger() :
     fDirectory->SetGuidance("MACE::SimTarget::Analysis controller.");
 
     fFilePath = std::make_unique<G4UIcmdWithAString>("/MACE/Analysis/FilePath", this),
-    fFilePath->SetGuidance("Set file path.");
+    fFilePath->SetGuidance("Set file path. A new path takes effect (i.e. the file is reopened) at the next run.");
     fFilePath->SetParameterName("path", false);
-    fFilePath->AvailableForStates(G4State_PreInit);
+    fFilePath->AvailableForStates(G4State_PreInit, G4State_Idle);
 
     fFileMode = std::make_unique<G4UIcmdWithAString>("/MACE/Analysis/FileMode", this);
     fFileMode->SetGuidance("Set mode (NEW, RECREATE, or UPDATE) for opening ROOT file(s).");
     fFileMode->SetParameterName("mode", false);
-    fFileMode->AvailableForStates(G4State_PreInit);
+    fFileMode->AvailableForStates(G4State_PreInit, G4State_Idle);
 
     fEnableYieldAnalysis = std::make_unique<G4UIcmdWithABool>("/MACE/Analysis/EnableYieldAnalysis", this),
     fEnableYieldAnalysis->SetGuidance("Enable auto analysis of yield.");
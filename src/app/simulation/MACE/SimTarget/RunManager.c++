@@ -3,6 +3,7 @@
 #include "MACE/SimTarget/Analysis.h++"
 #include "MACE/SimTarget/RunManager.h++"
 #include "MACE/Simulation/Physics/StandardPhysicsList.h++"
+#include "MACE/Simulation/Run/DesignScan.h++"
 
 #include "Mustard/Env/BasicEnv.h++"
 
@@ -12,7 +13,8 @@ namespace MACE::SimTarget {
 
 RunManager::RunManager() :
     MPIRunManager{},
-    fAnalysis{std::make_unique_for_overwrite<Analysis>()} {
+    fAnalysis{std::make_unique_for_overwrite<Analysis>()},
+    fDesignScan{std::make_unique<DesignScan>([] { DetectorConstruction::Instance().DestroyGeometry(); })} {
 
     SetUserInitialization(new StandardPhysicsList);
 
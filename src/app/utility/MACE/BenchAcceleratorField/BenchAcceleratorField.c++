@@ -0,0 +1,99 @@
+#include "MACE/BenchAcceleratorField/BenchAcceleratorField.h++"
+#include "MACE/Detector/Description/FieldOption.h++"
+#include "MACE/Detector/Field/NodeSharedFieldMap.h++"
+#include "MACE/Detector/Field/PrecomputedFieldMap.h++"
+
+#include "Mustard/CLI/BasicCLI.h++"
+#include "Mustard/Detector/Description/DescriptionIO.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldMap.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "CLHEP/Vector/ThreeVector.h"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace MACE::BenchAcceleratorField {
+
+namespace {
+
+/// Field evaluations per Dormand-Prince 4(5) step (7 stages, first same as last). Steps are not
+/// run here, the step rate is estimated as the evaluation rate over this.
+constexpr auto gNEvaluationPerStep{6};
+
+auto Report(const std::string& name, double second, long long nEvaluation, double checksum) -> void {
+    const auto rate{nEvaluation / second};
+    Mustard::MasterPrintLn("  {:<28} {:>10.3f} s  {:>10.3f} M eval/s  {:>10.3f} M step/s (est.)  (checksum {:.6e})",
+                           name, second, rate / 1e6, rate / gNEvaluationPerStep / 1e6, checksum);
+}
+
+template<typename AField>
+auto BenchSingle(const std::string& name, const AField& field, const std::vector<CLHEP::Hep3Vector>& point, int nRepeat) -> void {
+    double checksum{};
+    const auto begin{std::chrono::steady_clock::now()};
+    for (auto r{0}; r < nRepeat; ++r) {
+        for (auto&& x : point) {
+            const auto [b, e]{field.BE(x)};
+            checksum += b.z() + e.z();
+        }
+    }
+    const std::chrono::duration<double> time{std::chrono::steady_clock::now() - begin};
+    Report(name, time.count(), static_cast<long long>(nRepeat) * ssize(point), checksum);
+}
+
+} // namespace
+
+BenchAcceleratorField::BenchAcceleratorField() :
+    Subprogram{"BenchAcceleratorField", "Benchmark accelerator electromagnetic field map evaluation."} {}
+
+auto BenchAcceleratorField::Main(int argc, char* argv[]) const -> int {
+    Mustard::CLI::BasicCLI<> cli;
+    cli->add_argument("-c", "--description").help("Description YAML file path (for FieldOption).").nargs(1);
+    cli->add_argument("-n", "--n-point").help("Number of random points in the field map region.").default_value(1'000'000).required().nargs(1).scan<'i', int>();
+    cli->add_argument("-r", "--repeat").help("Number of passes over the points.").default_value(5).required().nargs(1).scan<'i', int>();
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+
+    if (const auto descriptionPath{cli->present("--description")}) {
+        Mustard::Detector::Description::DescriptionIO::Import<Detector::Description::FieldOption>(*descriptionPath);
+    }
+    const auto fileName{Detector::Description::FieldOption::Instance().ParsedFieldDataFilePath().generic_string()};
+    const auto nRepeat{cli->get<int>("--repeat")};
+
+    const Mustard::Detector::Field::ElectromagneticFieldMapSymmetryY<"NoCache"> noCache{fileName, "AcceleratorField"};
+    const Detector::Field::PrecomputedElectromagneticFieldMapSymmetryY precomputed{fileName, "AcceleratorField"};
+    const Detector::Field::NodeSharedElectromagneticFieldMapSymmetryY nodeShared{fileName, "AcceleratorField"};
+
+    // sample points uniformly inside the (mirrored) grid
+    const auto& grid{precomputed.Grid()};
+    std::array<std::uniform_real_distribution<double>, 3> uniform;
+    for (gsl::index k{}; k < 3; ++k) {
+        const auto upper{grid.X0()[k] + (grid.NGrid()[k] - 1) * grid.DX()[k]};
+        uniform[k] = std::uniform_real_distribution<double>{k == 1 ? -upper : grid.X0()[k], upper};
+    }
+    std::mt19937_64 rng{};
+    std::vector<CLHEP::Hep3Vector> point(cli->get<int>("--n-point"));
+    std::ranges::generate(point, [&] { return CLHEP::Hep3Vector{uniform[0](rng), uniform[1](rng), uniform[2](rng)}; });
+
+    double maxDeviation{};
+    for (auto&& x : point) {
+        maxDeviation = std::max(maxDeviation, (noCache.E(x) - precomputed.E(x)).mag());
+    }
+
+    Mustard::MasterPrintLn("AcceleratorField: {} points x {} passes ({}x{}x{} grid, max |dE| precomputed vs. NoCache: {:.3e})",
+                           ssize(point), nRepeat, grid.NGrid()[0], grid.NGrid()[1], grid.NGrid()[2], maxDeviation);
+    BenchSingle("NoCache", noCache, point, nRepeat);
+    BenchSingle("Precomputed", precomputed, point, nRepeat);
+    BenchSingle("NodeShared", nodeShared, point, nRepeat);
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::BenchAcceleratorField
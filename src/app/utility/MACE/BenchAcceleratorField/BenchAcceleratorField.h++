@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::BenchAcceleratorField {
+
+class BenchAcceleratorField : public Mustard::Application::Subprogram {
+public:
+    BenchAcceleratorField();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::BenchAcceleratorField
@@ -0,0 +1,163 @@
+#include "MACE/CompareGenerator/CompareGenerator.h++"
+
+#include "Mustard/CLI/BasicCLI.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "ROOT/RDataFrame.hxx"
+#include "TFile.h"
+#include "TGraph.h"
+#include "TH1.h"
+
+#include "mplr/mplr.hpp"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MACE::CompareGenerator {
+
+namespace {
+
+constexpr std::array<const char*, 3> gVariable{"E", "cosTheta", "pT"};
+
+/// Per-event weight sums and the integrated autocorrelation time read from ACF_u* graphs (1 if absent).
+struct Efficiency {
+    unsigned long long n;
+    double sumW;
+    double sumW2;
+    double autocorrelationTime;
+};
+
+auto Define(ROOT::RDataFrame& dataFrame, int nParticle) {
+    ROOT::RDF::RNode node{dataFrame.Define("weight", "static_cast<double>(w)")
+                              .Define("cosTheta", "pz / sqrt(px * px + py * py + pz * pz)")
+                              .Define("pT", "sqrt(px * px + py * py)")};
+    for (int i{}; i < nParticle; ++i) {
+        for (auto&& variable : gVariable) {
+            node = node.Define(fmt::format("{}_{}", variable, i), fmt::format("{}[{}]", variable, i));
+        }
+    }
+    return node;
+}
+
+/// Integrated autocorrelation time 2 int_0^L rho(l) dl, cut at the first non-positive rho, maximized over dimensions.
+auto AutocorrelationTime(const std::string& fileName) -> double {
+    const std::unique_ptr<TFile> file{TFile::Open(fileName.c_str(), "READ")};
+    if (file == nullptr or file->IsZombie()) {
+        return 1;
+    }
+    double tau{1};
+    for (int i{};; ++i) {
+        const auto graph{file->Get<TGraph>(fmt::format("ACF_u{}", i).c_str())};
+        if (graph == nullptr) {
+            break;
+        }
+        graph->Sort();
+        double integral{};
+        double lastLag{};
+        double lastRho{1};
+        for (int k{}; k < graph->GetN(); ++k) {
+            const auto lag{graph->GetPointX(k)};
+            const auto rho{graph->GetPointY(k)};
+            if (rho <= 0) {
+                break;
+            }
+            integral += (lag - lastLag) * (rho + lastRho) / 2;
+            lastLag = lag;
+            lastRho = rho;
+        }
+        tau = std::max(tau, 2 * integral);
+    }
+    return tau;
+}
+
+} // namespace
+
+CompareGenerator::CompareGenerator() :
+    Subprogram{"CompareGenerator", "Compare kinematic distributions and sampling efficiency of two generated samples (e.g. MCMC vs. VEGAS)."} {}
+
+auto CompareGenerator::Main(int argc, char* argv[]) const -> int {
+    Mustard::CLI::BasicCLI<> cli;
+    cli->add_argument("reference").help("Reference sample (e.g. MCMC output) ROOT file.").nargs(1);
+    cli->add_argument("test").help("Test sample (e.g. VEGAS output) ROOT file.").nargs(1);
+    cli->add_argument("-t", "--tree").help("Generated event tree name in both files.").required().nargs(1);
+    cli->add_argument("-b", "--n-bin").help("Number of histogram bins.").default_value(100).required().nargs(1).scan<'i', int>();
+    cli->add_argument("-o", "--output").help("Output ROOT file of the histograms.").default_value(std::string{"generator_comparison.root"}).required().nargs(1);
+    Mustard::Env::MPIEnv env{argc, argv, cli};
+    if (mplr::comm_world().rank() != 0) {
+        return EXIT_SUCCESS;
+    }
+
+    const std::array<std::string, 2> fileName{cli->get("reference"), cli->get("test")};
+    const std::array<std::string, 2> label{"reference", "test"};
+    const auto treeName{cli->get("--tree")};
+    const auto nBin{cli->get<int>("--n-bin")};
+
+    std::array<ROOT::RDataFrame, 2> dataFrame{ROOT::RDataFrame{treeName, fileName[0]}, ROOT::RDataFrame{treeName, fileName[1]}};
+    const auto nParticle{static_cast<int>(dataFrame[0].Range(1).Take<ROOT::RVecF>("E").GetValue().front().size())};
+    std::array<ROOT::RDF::RNode, 2> node{Define(dataFrame[0], nParticle), Define(dataFrame[1], nParticle)};
+
+    // common histogram range
+    std::array<double, 2> eMax{};
+    std::array<double, 2> pTMax{};
+    for (int s{}; s < 2; ++s) {
+        eMax[s] = node[s].Max<ROOT::RVecF>("E").GetValue();
+        pTMax[s] = node[s].Max<ROOT::RVecF>("pT").GetValue();
+    }
+    const std::array<std::array<double, 2>, 3> range{{{0, std::ranges::max(eMax)}, {-1, 1}, {0, std::ranges::max(pTMax)}}};
+
+    // book and fill
+    std::array<std::vector<ROOT::RDF::RResultPtr<TH1D>>, 2> histogram;
+    std::array<Efficiency, 2> efficiency{};
+    for (int s{}; s < 2; ++s) {
+        for (int i{}; i < nParticle; ++i) {
+            for (int v{}; v < ssize(gVariable); ++v) {
+                const auto name{fmt::format("{}_{}_{}", label[s], gVariable[v], i)};
+                histogram[s].emplace_back(node[s].Histo1D({name.c_str(), fmt::format("{} of particle {} ({})", gVariable[v], i, label[s]).c_str(),
+                                                           nBin, range[v][0], range[v][1]},
+                                                          fmt::format("{}_{}", gVariable[v], i), "weight"));
+            }
+        }
+        const auto n{node[s].Count()};
+        const auto sumW{node[s].Sum<double>("weight")};
+        const auto sumW2{node[s].Define("weight2", "weight * weight").Sum<double>("weight2")};
+        efficiency[s] = {*n, *sumW, *sumW2, AutocorrelationTime(fileName[s])};
+    }
+
+    // distributions
+    Mustard::MasterPrintLn("{:<16} {:>12} {:>12} {:>12}", "Distribution", "chi2 p", "KS p", "test/ref");
+    TFile output{cli->get("--output").c_str(), "RECREATE"};
+    for (gsl::index h{}; h < ssize(histogram[0]); ++h) {
+        auto& reference{*histogram[0][h]};
+        auto& test{*histogram[1][h]};
+        const auto name{fmt::format("{}_{}", gVariable[h % ssize(gVariable)], h / ssize(gVariable))};
+        Mustard::MasterPrintLn("{:<16} {:>12.4g} {:>12.4g} {:>12.4f}",
+                               name, reference.Chi2Test(&test, "WW"), reference.KolmogorovTest(&test), test.Integral() / reference.Integral());
+        reference.Write();
+        test.Write();
+        const auto ratio{static_cast<TH1D*>(test.Clone(fmt::format("ratio_{}", name).c_str()))};
+        ratio->Divide(&reference);
+        ratio->Write();
+    }
+
+    // efficiency
+    Mustard::MasterPrintLn("");
+    Mustard::MasterPrintLn("{:<10} {:>12} {:>14} {:>12} {:>14} {:>12}", "Sample", "Events", "Sum of w", "Kish ESS", "Autocorr. time", "ESS/event");
+    for (int s{}; s < 2; ++s) {
+        const auto& [n, sumW, sumW2, tau]{efficiency[s]};
+        const auto ess{sumW * sumW / sumW2 / tau};
+        Mustard::MasterPrintLn("{:<10} {:>12} {:>14.6g} {:>12.1f} {:>14.2f} {:>12.4f}", label[s], n, sumW, ess * tau, tau, ess / n);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::CompareGenerator
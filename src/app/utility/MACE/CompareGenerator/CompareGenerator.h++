@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Mustard/Application/Subprogram.h++"
+
+namespace MACE::CompareGenerator {
+
+class CompareGenerator : public Mustard::Application::Subprogram {
+public:
+    CompareGenerator();
+    auto Main(int argc, char* argv[]) const -> int override;
+};
+
+} // namespace MACE::CompareGenerator
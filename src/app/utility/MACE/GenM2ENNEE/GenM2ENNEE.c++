@@ -2,16 +2,12 @@
 #include "MACE/Detector/Description/MMSField.h++"
 #include "MACE/Detector/Description/TTC.h++"
 #include "MACE/GenM2ENNEE/GenM2ENNEE.h++"
+#include "MACE/Utility/GenerateMatrixElementEvent.h++"
 #include "MACE/Utility/InitialStateCLIModule.h++"
 #include "MACE/Utility/MCMCGeneratorCLI.h++"
-#include "MACE/Utility/WriteAutocorrelationFunction.h++"
 
 #include "Mustard/CLHEPX/Random/Xoshiro.h++"
-#include "Mustard/Data/GeneratedEvent.h++"
-#include "Mustard/Data/Output.h++"
 #include "Mustard/Env/MPIEnv.h++"
-#include "Mustard/Execution/Executor.h++"
-#include "Mustard/IO/File.h++"
 #include "Mustard/IO/Print.h++"
 #include "Mustard/Physics/Generator/M2ENNEEGenerator.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
@@ -19,11 +15,11 @@
 #include "Mustard/Utility/PhysicalConstant.h++"
 #include "Mustard/Utility/UseXoshiro.h++"
 
-#include "CLHEP/Random/Random.h"
-
 #include "muc/numeric"
 #include "muc/utility"
 
+#include "fmt/format.h"
+
 #include <cmath>
 #include <string>
 #include <type_traits>
@@ -94,50 +90,26 @@ auto GenM2ENNEE::Main(int argc, char* argv[]) const -> int {
         });
     }
 
-    // Integrate matrix element
-    Mustard::Executor<unsigned long long> executor{"Generation", "Sample"};
-    const auto [phaseSpaceIntegral, nEff, integrationState]{cli.PhaseSpaceIntegral(executor, generator)};
-    const auto width{muc::pow(2 * pi, 4) / (2 * muon_mass_c2) * phaseSpaceIntegral};
-    const auto branchingRatio{width * (muon_lifetime / hbar_Planck)};
-    Mustard::MasterPrint("Branching ratio:\n"
-                         "  {} +/- {}  (rel. unc.: {:.3}%, N_eff: {:.2f})\n"
-                         "\n",
-                         branchingRatio.value, branchingRatio.uncertainty,
-                         branchingRatio.uncertainty / branchingRatio.value * 100, nEff);
-
-    // Return if nothing to be generated
-    const auto nEvent{cli.GenerateOrExit()};
-    if (not nEvent.has_value()) {
-        return EXIT_SUCCESS;
-    }
-
-    // Initialize generator and write ACF
-    Mustard::ProcessSpecificFile<TFile> file{cli->get("--output"), cli->get("--output-mode")};
-    auto& rng{*CLHEP::HepRandom::getTheEngine()};
-    const auto autocorrelationFunction{generator.MCMCInitialize(rng)};
-    WriteAutocorrelationFunction(autocorrelationFunction);
-
-    // Generate events
-    if (*nEvent == 0) {
-        return EXIT_SUCCESS;
-    }
-    Mustard::Data::Output<Mustard::Data::GeneratedKinematics> writer{cli->get("--output-tree")};
-    executor(*nEvent, [&](auto) {
-        const auto [weight, pdgID, p]{generator(rng)};
-        Mustard::Data::Tuple<Mustard::Data::GeneratedKinematics> event;
-        // 0: e+, 3: e-, 4: e+
-        Get<"pdgID">(event) = {pdgID[0], pdgID[3], pdgID[4]};
-        Get<"E">(event) = {float(p[0].e()), float(p[3].e()), float(p[4].e())};
-        Get<"px">(event) = {float(p[0].x()), float(p[3].x()), float(p[4].x())};
-        Get<"py">(event) = {float(p[0].y()), float(p[3].y()), float(p[4].y())};
-        Get<"pz">(event) = {float(p[0].z()), float(p[3].z()), float(p[4].z())};
-        Get<"w">(event) = branchingRatio.value * weight;
-        writer.Fill(event);
-    });
-    executor.PrintExecutionSummary();
-    writer.Write();
-
-    return EXIT_SUCCESS;
+    // Integrate matrix element and generate events
+    const auto maceBiasKey{[&] {
+        const auto& cdc{Detector::Description::CDC::Instance()};
+        const auto& ttc{Detector::Description::TTC::Instance()};
+        return fmt::format("mace-bias:{},{},{},{},{},{},{}", cdc.GasInnerRadius(), cdc.GasOuterRadius(), cdc.GasOuterLength(), ttc.Radius(),
+                           Detector::Description::MMSField::Instance().FastField(),
+                           cli->get<double>("--pxy-softening-factor"), cli->get<double>("--cos-theta-softening-factor"));
+    }};
+    const auto physicsKey{fmt::format("M2ENNEE|p:{},{},{};P:{},{},{};{};{};{}",
+                                      cli.Momentum().x(), cli.Momentum().y(), cli.Momentum().z(),
+                                      cli.Polarization().x(), cli.Polarization().y(), cli.Polarization().z(),
+                                      cli["--mace-bias"] == true ? maceBiasKey() : "",
+                                      cli["--mace-bias"] == true or cli["--ep-ek-bias"] == true ?
+                                          fmt::format("ep-ek-bias:{},{}", cli->get<double>("--ep-ek-soft-upper-bound"), cli->get<double>("--ep-ek-softening-factor")) :
+                                          "",
+                                      cli["--emiss-bias"] == true ?
+                                          fmt::format("emiss-bias:{},{}", cli->get<double>("--emiss-soft-upper-bound"), cli->get<double>("--emiss-softening-factor")) :
+                                          "")};
+    // 0: e+, 3: e-, 4: e+
+    return GenerateMatrixElementEvent(cli, generator, physicsKey, muon_mass_c2, muon_lifetime, {0, 3, 4});
 }
 
 } // namespace MACE::GenM2ENNEE
@@ -1,14 +1,10 @@
 #include "MACE/GenM2ENNGG/GenM2ENNGG.h++"
+#include "MACE/Utility/GenerateMatrixElementEvent.h++"
 #include "MACE/Utility/InitialStateCLIModule.h++"
 #include "MACE/Utility/MCMCGeneratorCLI.h++"
-#include "MACE/Utility/WriteAutocorrelationFunction.h++"
 
 #include "Mustard/CLHEPX/Random/Xoshiro.h++"
-#include "Mustard/Data/GeneratedEvent.h++"
-#include "Mustard/Data/Output.h++"
 #include "Mustard/Env/MPIEnv.h++"
-#include "Mustard/Execution/Executor.h++"
-#include "Mustard/IO/File.h++"
 #include "Mustard/IO/Print.h++"
 #include "Mustard/Physics/Generator/M2ENNGGGenerator.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
@@ -16,11 +12,11 @@
 #include "Mustard/Utility/PhysicalConstant.h++"
 #include "Mustard/Utility/UseXoshiro.h++"
 
-#include "CLHEP/Random/Random.h"
-
 #include "muc/numeric"
 #include "muc/utility"
 
+#include "fmt/format.h"
+
 #include <cmath>
 #include <string>
 #include <type_traits>
@@ -60,50 +56,16 @@ auto GenM2ENNGG::Main(int argc, char* argv[]) const -> int {
         });
     }
 
-    // Integrate matrix element
-    Mustard::Executor<unsigned long long> executor{"Generation", "Sample"};
-    const auto [phaseSpaceIntegral, nEff, integrationState]{cli.PhaseSpaceIntegral(executor, generator)};
-    const auto width{muc::pow(2 * pi, 4) / (2 * muon_mass_c2) * phaseSpaceIntegral};
-    const auto branchingRatio{width * (muon_lifetime / hbar_Planck)};
-    Mustard::MasterPrint("Branching ratio:\n"
-                         "  {} +/- {}  (rel. unc.: {:.3}%, N_eff: {:.2f})\n"
-                         "\n",
-                         branchingRatio.value, branchingRatio.uncertainty,
-                         branchingRatio.uncertainty / branchingRatio.value * 100, nEff);
-
-    // Return if nothing to be generated
-    const auto nEvent{cli.GenerateOrExit()};
-    if (not nEvent.has_value()) {
-        return EXIT_SUCCESS;
-    }
-
-    // Initialize generator and write ACF
-    Mustard::ProcessSpecificFile<TFile> file{cli->get("--output"), cli->get("--output-mode")};
-    auto& rng{*CLHEP::HepRandom::getTheEngine()};
-    const auto autocorrelationFunction{generator.MCMCInitialize(rng)};
-    WriteAutocorrelationFunction(autocorrelationFunction);
-
-    // Generate events
-    if (*nEvent == 0) {
-        return EXIT_SUCCESS;
-    }
-    Mustard::Data::Output<Mustard::Data::GeneratedKinematics> writer{cli->get("--output-tree")};
-    executor(*nEvent, [&](auto) {
-        const auto [weight, pdgID, p]{generator(rng)};
-        Mustard::Data::Tuple<Mustard::Data::GeneratedKinematics> event;
-        // 0: e+, 3: g, 4: g
-        Get<"pdgID">(event) = {pdgID[0], pdgID[3], pdgID[4]};
-        Get<"E">(event) = {float(p[0].e()), float(p[3].e()), float(p[4].e())};
-        Get<"px">(event) = {float(p[0].x()), float(p[3].x()), float(p[4].x())};
-        Get<"py">(event) = {float(p[0].y()), float(p[3].y()), float(p[4].y())};
-        Get<"pz">(event) = {float(p[0].z()), float(p[3].z()), float(p[4].z())};
-        Get<"w">(event) = branchingRatio.value * weight;
-        writer.Fill(event);
-    });
-    executor.PrintExecutionSummary();
-    writer.Write();
-
-    return EXIT_SUCCESS;
+    // Integrate matrix element and generate events
+    const auto physicsKey{fmt::format("M2ENNGG|p:{},{},{};P:{},{},{};ir-cut:{};{}",
+                                      cli.Momentum().x(), cli.Momentum().y(), cli.Momentum().z(),
+                                      cli.Polarization().x(), cli.Polarization().y(), cli.Polarization().z(),
+                                      cli->get<double>("--ir-cut"),
+                                      cli["--emiss-bias"] == true ?
+                                          fmt::format("emiss-bias:{},{}", cli->get<double>("--emiss-soft-upper-bound"), cli->get<double>("--emiss-softening-factor")) :
+                                          "")};
+    // 0: e+, 3: g, 4: g
+    return GenerateMatrixElementEvent(cli, generator, physicsKey, muon_mass_c2, muon_lifetime, {0, 3, 4});
 }
 
 } // namespace MACE::GenM2ENNGG
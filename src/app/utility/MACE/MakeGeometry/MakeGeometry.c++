@@ -45,15 +45,19 @@
 #include "MACE/Detector/Definition/Target.h++"
 #include "MACE/Detector/Definition/World.h++"
 #include "MACE/MakeGeometry/MakeGeometry.h++"
+#include "MACE/MakeGeometry/OverlapValidator.h++"
 
 #include "Mustard/CLI/BasicCLI.h++"
 #include "Mustard/Detector/Description/DescriptionIO.h++"
-#include "Mustard/Env/BasicEnv.h++"
+#include "Mustard/Env/MPIEnv.h++"
 #include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
 
 #include "TGeoManager.h"
 
+#include "mplr/mplr.hpp"
+
 #include "fmt/std.h"
 
 #include <filesystem>
@@ -63,22 +67,36 @@
 
 namespace MACE::MakeGeometry {
 
+using namespace Mustard::LiteralUnit::Length;
 using namespace std::string_literals;
 
 MakeGeometry::MakeGeometry() :
-    Subprogram{"MakeGeometry", "Construct detector geometry and create geometry files."} {}
+    Subprogram{"MakeGeometry", "Construct detector geometry, check overlaps and create geometry files."} {}
 
 auto MakeGeometry::Main(int argc, char* argv[]) const -> int {
     Mustard::CLI::BasicCLI<> cli;
     cli->add_argument("-o", "--output").help("Set output directory path.").default_value("mace_geometry"s).required().nargs(1);
     cli->add_argument("-c", "--opaque").help("Set geometry opacity.").default_value(false).required().nargs(1);
-    Mustard::Env::BasicEnv env(argc, argv, cli);
+    cli->add_argument("--overlap-only").help("Only check overlaps and write the report, do not create geometry files.").flag();
+    cli->add_argument("--skip-overlap-check").help("Do not check overlaps.").flag();
+    cli->add_argument("--overlap-resolution").help("Number of surface points sampled per volume in overlap check.").default_value(1000).required().nargs(1).scan<'i', int>();
+    cli->add_argument("--overlap-tolerance").help("Tolerance (in mm) of overlap check.").default_value(0.).required().nargs(1).scan<'g', double>();
+    cli->add_argument("--overlap-cache").help("Set overlap check cache file path, or 'none' to disable it.").default_value("mace_overlap_cache.txt"s).required().nargs(1);
+    Mustard::Env::MPIEnv env(argc, argv, cli);
+
+    const auto overlapOnly{cli->get<bool>("--overlap-only")};
+    if (overlapOnly and cli->get<bool>("--skip-overlap-check")) {
+        Mustard::Throw<std::invalid_argument>("--overlap-only and --skip-overlap-check are mutually exclusive");
+    }
 
+    const auto& worldComm{mplr::comm_world()};
     const std::filesystem::path outputPath{cli->get("--output")};
-    if (std::filesystem::exists(outputPath)) {
-        Mustard::Throw<std::runtime_error>(fmt::format("{} already exists", outputPath));
+    if (worldComm.rank() == 0) {
+        if (std::filesystem::exists(outputPath)) {
+            Mustard::Throw<std::runtime_error>(fmt::format("{} already exists", outputPath));
+        }
+        std::filesystem::create_directories(outputPath);
     }
-    std::filesystem::create_directories(outputPath);
 
     ////////////////////////////////////////////////////////////////
     // Construct volumes
@@ -86,7 +104,8 @@ auto MakeGeometry::Main(int argc, char* argv[]) const -> int {
 
     using namespace Detector::Definition;
 
-    constexpr auto fCheckOverlap{true};
+    // overlaps are checked after construction, in parallel and cached (see OverlapValidator)
+    constexpr auto fCheckOverlap{false};
 
     // 0
 
@@ -147,6 +166,31 @@ auto MakeGeometry::Main(int argc, char* argv[]) const -> int {
     [[maybe_unused]] auto& beamMonitor{acceleratorField.NewDaughter<BeamMonitor>(fCheckOverlap)};
     [[maybe_unused]] auto& target{acceleratorField.NewDaughter<Target>(fCheckOverlap)};
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // Check overlaps
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+
+    if (not cli->get<bool>("--skip-overlap-check")) {
+        const auto overlapCache{cli->get("--overlap-cache")};
+        OverlapValidator validator{cli->get<int>("--overlap-resolution"),
+                                   cli->get<double>("--overlap-tolerance") * 1_mm,
+                                   overlapCache == "none" ? std::filesystem::path{} : std::filesystem::path{overlapCache}};
+        validator.Validate(*fWorld->PhysicalVolume());
+        validator.SaveCache();
+        validator.WriteReport(outputPath / "overlap.yaml");
+        if (const auto nOverlap{validator.NOverlap()}; nOverlap > 0) {
+            Mustard::MasterPrintWarning(fmt::format("{} volume(s) overlap, see {}", nOverlap, outputPath / "overlap.yaml"));
+            if (overlapOnly) {
+                return EXIT_FAILURE;
+            }
+        } else {
+            Mustard::MasterPrintLn("No overlap found");
+        }
+    }
+    if (overlapOnly or worldComm.rank() != 0) {
+        return EXIT_SUCCESS;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,229 @@
+#include "MACE/MakeGeometry/OverlapValidator.h++"
+#include "MACE/Utility/FNV1a.h++"
+
+#include "Mustard/Env/BasicEnv.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "G4LogicalVolume.hh"
+#include "G4RotationMatrix.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VSolid.hh"
+
+#include "mplr/mplr.hpp"
+
+#include "mpi.h"
+
+#include "muc/hash_map"
+#include "muc/hash_set"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/format.h"
+#include "fmt/std.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <ios>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace MACE::MakeGeometry {
+
+namespace {
+
+// persistent key, must not depend on the standard library implementation
+auto Hash(std::string_view info) -> std::uint64_t {
+    return FNV1a::Of(info);
+}
+
+auto HashCombine(std::uint64_t seed, std::uint64_t hash) -> std::uint64_t {
+    return seed ^ (hash + 0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+}
+
+auto SolidInfo(const G4VSolid& solid) -> std::string {
+    std::ostringstream info;
+    solid.StreamInfo(info);
+    return info.str();
+}
+
+auto PlacementInfo(const G4VPhysicalVolume& volume) -> std::string {
+    std::ostringstream info;
+    volume.GetLogicalVolume()->GetSolid()->StreamInfo(info);
+    info << std::hexfloat
+         << volume.GetName() << ' ' << volume.GetCopyNo() << ' ' << volume.GetMultiplicity() << '\n';
+    const auto translation{volume.GetTranslation()};
+    info << translation.x() << ' ' << translation.y() << ' ' << translation.z() << '\n';
+    if (const auto rotation{volume.GetRotation()}) {
+        info << rotation->xx() << ' ' << rotation->xy() << ' ' << rotation->xz() << ' '
+             << rotation->yx() << ' ' << rotation->yy() << ' ' << rotation->yz() << ' '
+             << rotation->zx() << ' ' << rotation->zy() << ' ' << rotation->zz() << '\n';
+    }
+    if (volume.IsReplicated()) {
+        EAxis axis;
+        G4int nReplica;
+        G4double width;
+        G4double offset;
+        G4bool consuming;
+        volume.GetReplicationData(axis, nReplica, width, offset, consuming);
+        info << axis << ' ' << nReplica << ' ' << width << ' ' << offset << ' ' << consuming << '\n';
+    }
+    return info.str();
+}
+
+auto LoadCache(const std::filesystem::path& path) -> muc::flat_hash_map<std::uint64_t, bool> {
+    muc::flat_hash_map<std::uint64_t, bool> cache;
+    if (path.empty()) {
+        return cache;
+    }
+    std::ifstream file{path};
+    std::uint64_t key;
+    int overlap;
+    while (file >> std::hex >> key >> std::dec >> overlap) {
+        cache[key] = overlap;
+    }
+    return cache;
+}
+
+} // namespace
+
+OverlapValidator::OverlapValidator(int resolution, double tolerance, std::filesystem::path cachePath) :
+    fResolution{resolution},
+    fTolerance{tolerance},
+    fCachePath{std::move(cachePath)},
+    fVerdict{} {}
+
+auto OverlapValidator::Validate(G4VPhysicalVolume& world) -> void {
+    // daughters of every distinct logical volume, in a deterministic order (the same on all processes)
+    fVerdict.clear();
+    const auto settingHash{Hash(fmt::format("{} {:a}", fResolution, fTolerance))};
+    muc::flat_hash_set<const G4LogicalVolume*> visited;
+    std::vector<const G4LogicalVolume*> motherStack{world.GetLogicalVolume()};
+    while (not motherStack.empty()) {
+        const auto mother{motherStack.back()};
+        motherStack.pop_back();
+        if (not visited.emplace(mother).second) {
+            continue;
+        }
+        // a daughter is checked against the mother and all siblings, any of them changing invalidates the verdict
+        std::vector<std::uint64_t> daughterHash(mother->GetNoDaughters());
+        auto siblingHash{HashCombine(settingHash, Hash(SolidInfo(*mother->GetSolid())))};
+        for (gsl::index i{}; i < std::ssize(daughterHash); ++i) {
+            daughterHash[i] = Hash(PlacementInfo(*mother->GetDaughter(i)));
+            siblingHash = HashCombine(siblingHash, daughterHash[i]);
+        }
+        for (gsl::index i{}; i < std::ssize(daughterHash); ++i) {
+            const auto daughter{mother->GetDaughter(i)};
+            fVerdict.push_back({daughter, HashCombine(siblingHash, daughterHash[i]), false, false, 0});
+            motherStack.emplace_back(daughter->GetLogicalVolume());
+        }
+    }
+
+    std::vector<gsl::index> toBeChecked;
+    const auto cache{LoadCache(fCachePath)};
+    for (gsl::index i{}; i < std::ssize(fVerdict); ++i) {
+        auto& verdict{fVerdict[i]};
+        if (const auto cached{cache.find(verdict.key)}; cached != cache.cend()) {
+            verdict.overlap = cached->second;
+            verdict.cached = true;
+        } else {
+            toBeChecked.emplace_back(i);
+        }
+    }
+
+    const auto& worldComm{mplr::comm_world()};
+    Mustard::MasterPrintLn("{} volumes to be checked for overlaps, {} cached, {} to be checked on {} processes",
+                           fVerdict.size(), fVerdict.size() - toBeChecked.size(), toBeChecked.size(), worldComm.size());
+
+    // checks are independent, distribute them over processes
+    std::vector<int> overlap(toBeChecked.size());
+    std::vector<double> time(toBeChecked.size());
+    for (gsl::index j{worldComm.rank()}; j < std::ssize(toBeChecked); j += worldComm.size()) {
+        const auto t0{std::chrono::steady_clock::now()};
+        overlap[j] = fVerdict[toBeChecked[j]].volume->CheckOverlaps(fResolution, fTolerance, Mustard::Env::VerboseLevelReach<'V'>());
+        time[j] = std::chrono::duration<double>{std::chrono::steady_clock::now() - t0}.count();
+    }
+    MPI_Allreduce(MPI_IN_PLACE, overlap.data(), overlap.size(), MPI_INT, MPI_SUM, worldComm.native_handle());
+    MPI_Allreduce(MPI_IN_PLACE, time.data(), time.size(), MPI_DOUBLE, MPI_SUM, worldComm.native_handle());
+    for (gsl::index j{}; j < std::ssize(toBeChecked); ++j) {
+        auto& verdict{fVerdict[toBeChecked[j]]};
+        verdict.overlap = overlap[j];
+        verdict.time = time[j];
+    }
+}
+
+auto OverlapValidator::NOverlap() const -> gsl::index {
+    return std::ranges::count_if(fVerdict, [](auto&& verdict) { return verdict.overlap; });
+}
+
+auto OverlapValidator::SaveCache() const -> void {
+    if (fCachePath.empty() or mplr::comm_world().rank() != 0) {
+        return;
+    }
+    std::error_code ec;
+    if (fCachePath.has_parent_path()) {
+        std::filesystem::create_directories(fCachePath.parent_path(), ec);
+    }
+    // merge into the existing entries, so that caches of other geometries (e.g. other configurations) are kept
+    auto cache{LoadCache(fCachePath)};
+    for (auto&& verdict : fVerdict) {
+        cache[verdict.key] = verdict.overlap;
+    }
+    const auto temporary{fmt::format("{}.{:08x}.tmp", fCachePath.string(), std::random_device{}())};
+    {
+        std::ofstream file{temporary};
+        for (auto&& [key, overlap] : cache) {
+            file << fmt::format("{:016x} {:d}\n", key, overlap);
+        }
+        if (not file) {
+            Mustard::PrintWarning(fmt::format("Cannot write overlap cache {}", temporary));
+            file.close();
+            std::filesystem::remove(temporary, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(temporary, fCachePath, ec);
+    if (ec) {
+        Mustard::PrintWarning(fmt::format("Cannot write overlap cache {} ({})", fCachePath, ec.message()));
+        std::filesystem::remove(temporary, ec);
+    }
+}
+
+auto OverlapValidator::WriteReport(const std::filesystem::path& path) const -> void {
+    if (mplr::comm_world().rank() != 0) {
+        return;
+    }
+    YAML::Node report{YAML::NodeType::Map};
+    report["Resolution"] = fResolution;
+    report["Tolerance"] = fTolerance;
+    report["NVolume"] = fVerdict.size();
+    report["NCached"] = std::ranges::count_if(fVerdict, [](auto&& verdict) { return verdict.cached; });
+    report["NOverlap"] = NOverlap();
+    YAML::Node overlapped{YAML::NodeType::Sequence};
+    YAML::Node volume{YAML::NodeType::Sequence};
+    for (auto&& [pv, key, overlap, cached, time] : fVerdict) {
+        const auto mother{pv->GetMotherLogical()};
+        YAML::Node entry{YAML::NodeType::Map};
+        entry["Name"] = std::string{pv->GetName()};
+        entry["CopyNo"] = pv->GetCopyNo();
+        entry["Mother"] = mother ? std::string{mother->GetName()} : std::string{};
+        entry["Overlap"] = overlap;
+        entry["Cached"] = cached;
+        entry["Time"] = time;
+        entry["Key"] = fmt::format("{:016x}", key);
+        if (overlap) {
+            overlapped.push_back(entry["Name"]);
+        }
+        volume.push_back(entry);
+    }
+    report["OverlappedVolume"] = overlapped;
+    report["Volume"] = volume;
+    std::ofstream{path} << YAML::Dump(report) << '\n';
+}
+
+} // namespace MACE::MakeGeometry
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "gsl/gsl"
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+class G4VPhysicalVolume;
+
+namespace MACE::MakeGeometry {
+
+/// @brief Checks all placed volumes for overlaps, distributed over MPI processes,
+/// with verdicts cached on disk.
+///
+/// Each logical volume is visited once, and each of its daughters is checked against the
+/// mother and its siblings (G4VPhysicalVolume::CheckOverlaps). A verdict is keyed by a hash
+/// of the check settings and the placement and solid parameters of the volume, its mother and
+/// all its siblings, so after a geometry change only the affected volumes are rechecked.
+/// SaveCache() merges the verdicts into the cache file, keeping entries of other geometries.
+/// Validate() is collective over MPI_COMM_WORLD.
+class OverlapValidator {
+public:
+    struct Verdict {
+        G4VPhysicalVolume* volume;
+        std::uint64_t key;
+        bool overlap;
+        bool cached;
+        double time;
+    };
+
+public:
+    OverlapValidator(int resolution, double tolerance, std::filesystem::path cachePath);
+
+    auto Validate(G4VPhysicalVolume& world) -> void;
+
+    auto VerdictList() const -> const auto& { return fVerdict; }
+    auto NOverlap() const -> gsl::index;
+
+    auto SaveCache() const -> void;
+    auto WriteReport(const std::filesystem::path& path) const -> void;
+
+private:
+    int fResolution;
+    double fTolerance;
+    std::filesystem::path fCachePath;
+
+    std::vector<Verdict> fVerdict;
+};
+
+} // namespace MACE::MakeGeometry
@@ -0,0 +1,70 @@
+#include "MACE/Analysis/CutFlow.h++"
+
+#include "Mustard/IO/Print.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "mpi.h"
+
+#include "yaml-cpp/yaml.h"
+
+#include <cmath>
+
+namespace MACE::inline Analysis {
+
+CutFlow::CutFlow(const std::vector<std::string>& cutName) :
+    fEntry{} {
+    fEntry.reserve(cutName.size());
+    for (auto&& name : cutName) {
+        fEntry.push_back({name, 0, 0, 0});
+    }
+}
+
+auto CutFlow::Pass(gsl::index cut, double weight) -> void {
+    auto& entry{fEntry[cut]};
+    ++entry.n;
+    entry.sumW += weight;
+    entry.sumW2 += weight * weight;
+}
+
+auto CutFlow::Merge() -> void {
+    std::vector<unsigned long long> n;
+    std::vector<double> sumW;
+    n.reserve(fEntry.size());
+    sumW.reserve(2 * fEntry.size());
+    for (auto&& entry : fEntry) {
+        n.emplace_back(entry.n);
+        sumW.emplace_back(entry.sumW);
+        sumW.emplace_back(entry.sumW2);
+    }
+    const auto& worldComm{mplr::comm_world()};
+    MPI_Allreduce(MPI_IN_PLACE, n.data(), n.size(), MPI_UNSIGNED_LONG_LONG, MPI_SUM, worldComm.native_handle());
+    MPI_Allreduce(MPI_IN_PLACE, sumW.data(), sumW.size(), MPI_DOUBLE, MPI_SUM, worldComm.native_handle());
+    for (gsl::index i{}; i < ssize(fEntry); ++i) {
+        fEntry[i].n = n[i];
+        fEntry[i].sumW = sumW[2 * i];
+        fEntry[i].sumW2 = sumW[2 * i + 1];
+    }
+}
+
+auto CutFlow::Print() const -> void {
+    Mustard::MasterPrintLn("{:>16} {:>12} {:>14} {:>12} {:>10}", "Cut", "N", "Yield", "Error", "Eff.");
+    for (gsl::index i{}; i < ssize(fEntry); ++i) {
+        const auto& [name, n, sumW, sumW2]{fEntry[i]};
+        const auto previous{i == 0 ? sumW : fEntry[i - 1].sumW};
+        Mustard::MasterPrintLn("{:>16} {:>12} {:>14.6g} {:>12.4g} {:>10.4f}", name, n, sumW, std::sqrt(sumW2), previous > 0 ? sumW / previous : 0.);
+    }
+}
+
+auto CutFlow::Export(YAML::Node& node) const -> void {
+    for (auto&& [name, n, sumW, sumW2] : fEntry) {
+        YAML::Node entry;
+        entry["Name"] = name;
+        entry["N"] = n;
+        entry["Yield"] = sumW;
+        entry["Error"] = std::sqrt(sumW2);
+        node.push_back(entry);
+    }
+}
+
+} // namespace MACE::inline Analysis
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "gsl/gsl"
+
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+} // namespace YAML
+
+namespace MACE::inline Analysis {
+
+/// @brief Per-cut counters and weighted yields of a sequential selection.
+///
+/// Pass(i, w) records an event passing the i-th cut (and all cuts before). Merge() sums the
+/// counters over all processes; it is collective over MPI_COMM_WORLD.
+class CutFlow {
+public:
+    struct Entry {
+        std::string name;
+        unsigned long long n;
+        double sumW;
+        double sumW2;
+    };
+
+public:
+    explicit CutFlow(const std::vector<std::string>& cutName = {});
+
+    auto Pass(gsl::index cut, double weight) -> void;
+
+    auto EntryList() const -> const auto& { return fEntry; }
+    auto Merge() -> void;
+
+    auto Print() const -> void;
+    auto Export(YAML::Node& node) const -> void;
+
+private:
+    std::vector<Entry> fEntry;
+};
+
+} // namespace MACE::inline Analysis
@@ -0,0 +1,62 @@
+#include "MACE/Analysis/DCACalculator.h++"
+#include "MACE/Detector/Description/Target.h++"
+
+#include "muc/math"
+#include "muc/utility"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace MACE::inline Analysis {
+
+DCACalculator::DCACalculator() :
+    fExtrapolator{MMSTracking::TrackExtrapolator::FieldModel::Uniform},
+    fTargetPlane{MMSTracking::TrackExtrapolator::TargetPlane()} {}
+
+auto DCACalculator::operator()(const Mustard::Data::Tuple<Data::MMSTrack>& track,
+                               const Mustard::Data::Tuple<Data::MMSTrackState>* targetState) const -> std::optional<Vertex> {
+    Vertex vertex;
+    if (targetState) {
+        vertex.x = Get<"x">(*targetState).As<muc::array3d>();
+        vertex.p = Get<"p">(*targetState).As<muc::array3d>();
+        vertex.t = *Get<"t">(*targetState);
+    } else {
+        const auto state{fExtrapolator.Extrapolate(track, fTargetPlane)};
+        if (not state) {
+            return std::nullopt;
+        }
+        vertex.x = state->x;
+        vertex.p = state->p;
+        vertex.t = state->t;
+    }
+    vertex.dca = DistanceToTarget(vertex.x);
+    return vertex;
+}
+
+auto DCACalculator::DistanceToTarget(muc::array3d x) -> double {
+    // x is on the target plane (see TrackExtrapolator::TargetPlane), the target is at the origin
+    const auto& target{Detector::Description::Target::Instance()};
+    const auto Outside{[](double u, double halfExtent) { return std::max(std::abs(u) - halfExtent, 0.); }};
+    switch (target.ShapeType()) {
+    case Detector::Description::Target::TargetShapeType::Cuboid: {
+        const auto& cuboid{target.Cuboid()};
+        const auto u{x[0] * cuboid.CosTiltAngle() + x[2] * cuboid.SinTiltAngle()};
+        return muc::hypot(Outside(u, cuboid.Width() / 2), Outside(x[1], cuboid.Height() / 2));
+    }
+    case Detector::Description::Target::TargetShapeType::MultiLayer: {
+        const auto& multiLayer{target.MultiLayer()};
+        const auto pitch{multiLayer.Spacing() + multiLayer.Thickness()};
+        auto dx{std::numeric_limits<double>::max()};
+        for (int k{}; k < multiLayer.Count(); ++k) {
+            dx = std::min(dx, Outside(x[0] - (k * pitch - pitch * (multiLayer.Count() - 1) / 2), multiLayer.Thickness() / 2));
+        }
+        return muc::hypot(dx, Outside(x[1], multiLayer.Height() / 2));
+    }
+    case Detector::Description::Target::TargetShapeType::Cylinder:
+        return std::max(muc::hypot(x[0], x[1]) - target.Cylinder().Radius(), 0.);
+    }
+    muc::unreachable();
+}
+
+} // namespace MACE::inline Analysis
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "MACE/Data/MMSTrack.h++"
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/TrackExtrapolator.h++"
+
+#include "Mustard/Data/Tuple.h++"
+
+#include "muc/array"
+
+#include <optional>
+
+namespace MACE::inline Analysis {
+
+/// @brief Decay vertex of a track on the target surface, and its distance of closest approach
+/// (DCA) to the target.
+///
+/// The vertex is the track state on the target plane (SurfID 0 in MMSTrackState) if available,
+/// otherwise the track is extrapolated there in the uniform field. The vertex time is the
+/// track time at that point. DCA is the distance from the vertex to the target region on the
+/// plane, i.e. 0 for a vertex right on the target.
+class DCACalculator {
+public:
+    struct Vertex {
+        muc::array3d x;
+        muc::array3d p;
+        double t;
+        double dca;
+    };
+
+public:
+    DCACalculator();
+
+    auto operator()(const Mustard::Data::Tuple<Data::MMSTrack>& track,
+                    const Mustard::Data::Tuple<Data::MMSTrackState>* targetState = nullptr) const -> std::optional<Vertex>;
+
+    static auto DistanceToTarget(muc::array3d x) -> double;
+
+private:
+    MMSTracking::TrackExtrapolator fExtrapolator;
+    MMSTracking::TrackExtrapolator::Plane fTargetPlane;
+};
+
+} // namespace MACE::inline Analysis
@@ -0,0 +1,32 @@
+#include "MACE/Analysis/EventJoiner.h++"
+#include "MACE/Data/MergeJoiner.h++"
+
+#include <utility>
+
+namespace MACE::inline Analysis {
+
+EventJoiner::EventJoiner(std::vector<std::string> inputFile, DatasetName datasetName) :
+    fInputFile{std::move(inputFile)},
+    fDatasetName{std::move(datasetName)} {}
+
+auto EventJoiner::Join(const std::function<void(const JoinedEvent&)>& Analyze) const -> void {
+    const Data::MergeJoiner<Data::MMSTrack, Data::MMSTrackState, Data::MCPHit, Data::ECALCluster, PrimaryWeight> joiner{
+        {{{fInputFile, fDatasetName.track},
+          {fInputFile, fDatasetName.trackState},
+          {fInputFile, fDatasetName.mcpHit},
+          {fInputFile, fDatasetName.ecalCluster},
+          {fInputFile, fDatasetName.weight}}}};
+    JoinedEvent event;
+    joiner.Join([&](int evtID, const auto& joined) {
+        const auto& [track, trackState, mcpHit, ecalCluster, primary]{joined};
+        event.evtID = evtID;
+        event.weight = EventWeight(primary);
+        event.track = track;
+        event.trackState = trackState;
+        event.mcpHit = mcpHit;
+        event.ecalCluster = ecalCluster;
+        Analyze(event);
+    });
+}
+
+} // namespace MACE::inline Analysis
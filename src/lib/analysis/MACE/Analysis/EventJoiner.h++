@@ -0,0 +1,68 @@
+#pragma once
+
+#include "MACE/Data/Cluster.h++"
+#include "MACE/Data/Hit.h++"
+#include "MACE/Data/MMSTrack.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/Value.h++"
+
+#include "muc/hash_set"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MACE::inline Analysis {
+
+/// @brief Reconstructed objects of one event, joined over several outputs by EvtID.
+struct JoinedEvent {
+    int evtID;
+    double weight;
+    std::vector<std::shared_ptr<Mustard::Data::Tuple<Data::MMSTrack>>> track;
+    std::vector<std::shared_ptr<Mustard::Data::Tuple<Data::MMSTrackState>>> trackState;
+    std::vector<std::shared_ptr<Mustard::Data::Tuple<Data::MCPHit>>> mcpHit;
+    std::vector<std::shared_ptr<Mustard::Data::Tuple<Data::ECALCluster>>> ecalCluster;
+};
+
+/// @brief Joins ReconMMSTrack, MCP and ReconECAL outputs event by event.
+///
+/// All datasets are merge-joined by Data::MergeJoiner, in EvtID blocks over processes and in batches,
+/// and every event with an entry in any of them is visited, with or without tracks. The event weight
+/// is the product of the primary vertex weights ("w" in SimPrimaryVertex, once per vertex), 1 if no
+/// weight dataset is given. An empty dataset name skips that output.
+class EventJoiner {
+public:
+    /// @brief The columns of SimPrimaryVertex the event weight is taken from.
+    using PrimaryWeight = Mustard::Data::TupleModel<Mustard::Data::Value<int, "EvtID", "MC Event ID">,
+                                                    Mustard::Data::Value<int, "PrmID", "Primary index">,
+                                                    Mustard::Data::Value<float, "w", "Primary vertex weight">>;
+
+    struct DatasetName {
+        std::string track;
+        std::string trackState;
+        std::string mcpHit;
+        std::string ecalCluster;
+        std::string weight;
+    };
+
+public:
+    EventJoiner(std::vector<std::string> inputFile, DatasetName datasetName);
+
+    auto Join(const std::function<void(const JoinedEvent&)>& Analyze) const -> void;
+
+    /// @brief Product of the vertex weights of an event. SimPrimaryVertex has a row per primary
+    /// particle, each carrying the weight of its vertex, so the weight is taken once per primary (PrmID).
+    template<Mustard::Data::SuperTupleModel<PrimaryWeight> AModel>
+    static auto EventWeight(const std::vector<std::shared_ptr<Mustard::Data::Tuple<AModel>>>& primary) -> double;
+
+private:
+    std::vector<std::string> fInputFile;
+    DatasetName fDatasetName;
+};
+
+} // namespace MACE::inline Analysis
+
+#include "MACE/Analysis/EventJoiner.inl"
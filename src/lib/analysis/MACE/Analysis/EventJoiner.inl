@@ -0,0 +1,15 @@
+namespace MACE::inline Analysis {
+
+template<Mustard::Data::SuperTupleModel<EventJoiner::PrimaryWeight> AModel>
+auto EventJoiner::EventWeight(const std::vector<std::shared_ptr<Mustard::Data::Tuple<AModel>>>& primary) -> double {
+    muc::flat_hash_set<int> weighted;
+    double weight{1};
+    for (auto&& p : primary) {
+        if (weighted.emplace(*Get<"PrmID">(*p)).second) {
+            weight *= *Get<"w">(*p);
+        }
+    }
+    return weight;
+}
+
+} // namespace MACE::inline Analysis
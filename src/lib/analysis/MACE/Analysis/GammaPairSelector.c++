@@ -0,0 +1,92 @@
+#include "MACE/Analysis/GammaPairSelector.h++"
+#include "MACE/Detector/Description/ECALField.h++"
+
+#include "Mustard/Math/Norm.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+#include "Mustard/Utility/PhysicalConstant.h++"
+#include "Mustard/Utility/VectorArithmeticOperator.h++"
+
+#include "yaml-cpp/yaml.h"
+
+#include <cmath>
+
+namespace MACE::inline Analysis {
+
+using namespace Mustard::LiteralUnit::Energy;
+using namespace Mustard::LiteralUnit::Time;
+
+GammaPairSelector::GammaPairSelector() :
+    fEnergyWindow{400_keV, 600_keV},
+    fMaxCosAngle{-0.5},
+    fMaxTimeDifference{5_ns},
+    fMCPTimeWindow{-20_ns, 20_ns},
+    fAnnihilationPoint{Detector::Description::ECALField::Instance().Center()} {}
+
+auto GammaPairSelector::operator()(const std::vector<std::shared_ptr<Mustard::Data::Tuple<Data::ECALCluster>>>& cluster,
+                                   std::optional<double> mcpTime) const -> std::optional<Pair> {
+    using namespace Mustard::VectorArithmeticOperator;
+    using Mustard::PhysicalConstant::electron_mass_c2;
+
+    const auto InEnergyWindow{[this](double e) { return fEnergyWindow.first <= e and e <= fEnergyWindow.second; }};
+    std::optional<Pair> best;
+    for (gsl::index i{}; i < ssize(cluster); ++i) {
+        const auto e1{*Get<"Edep">(*cluster[i])};
+        if (not InEnergyWindow(e1)) {
+            continue;
+        }
+        for (auto j{i + 1}; j < ssize(cluster); ++j) {
+            const auto e2{*Get<"Edep">(*cluster[j])};
+            if (not InEnergyWindow(e2)) {
+                continue;
+            }
+            const auto t1{*Get<"t">(*cluster[i])};
+            const auto t2{*Get<"t">(*cluster[j])};
+            const auto dt{t2 - t1};
+            if (std::abs(dt) > fMaxTimeDifference) {
+                continue;
+            }
+            if (mcpTime) {
+                const auto dtMCP{(t1 + t2) / 2 - *mcpTime};
+                if (dtMCP < fMCPTimeWindow.first or dtMCP > fMCPTimeWindow.second) {
+                    continue;
+                }
+            }
+            const auto d1{Get<"x">(*cluster[i]).As<muc::array3d>() - fAnnihilationPoint};
+            const auto d2{Get<"x">(*cluster[j]).As<muc::array3d>() - fAnnihilationPoint};
+            const auto cosAngle{(d1 * d2) / std::sqrt(Mustard::Math::NormSq(d1) * Mustard::Math::NormSq(d2))};
+            if (cosAngle > fMaxCosAngle) {
+                continue;
+            }
+            const auto energySum{e1 + e2};
+            if (best and std::abs(energySum - 2 * electron_mass_c2) >= std::abs(best->energySum - 2 * electron_mass_c2)) {
+                continue;
+            }
+            best = {i, j, energySum, cosAngle, dt};
+        }
+    }
+    return best;
+}
+
+auto GammaPairSelector::Import(const YAML::Node& node) -> void {
+    if (const auto v{node["EnergyWindow"]}) {
+        fEnergyWindow = v.as<std::pair<double, double>>();
+    }
+    if (const auto v{node["MaxCosAngle"]}) {
+        fMaxCosAngle = v.as<double>();
+    }
+    if (const auto v{node["MaxTimeDifference"]}) {
+        fMaxTimeDifference = v.as<double>();
+    }
+    if (const auto v{node["MCPTimeWindow"]}) {
+        fMCPTimeWindow = v.as<std::pair<double, double>>();
+    }
+}
+
+auto GammaPairSelector::Export(YAML::Node& node) const -> void {
+    node["EnergyWindow"] = fEnergyWindow;
+    node["MaxCosAngle"] = fMaxCosAngle;
+    node["MaxTimeDifference"] = fMaxTimeDifference;
+    node["MCPTimeWindow"] = fMCPTimeWindow;
+}
+
+} // namespace MACE::inline Analysis
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "MACE/Data/Cluster.h++"
+
+#include "Mustard/Data/Tuple.h++"
+
+#include "muc/array"
+
+#include "gsl/gsl"
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace YAML {
+class Node;
+} // namespace YAML
+
+namespace MACE::inline Analysis {
+
+/// @brief Selects the ECAL cluster pair from the annihilation of the positron at the MCP.
+///
+/// Both clusters must be in the energy window around 511 keV, close in time, and back-to-back
+/// as seen from the MCP (cosine of the opening angle below MaxCosAngle). If a reference time
+/// (the MCP hit time) is given, the mean cluster time must also be in MCPTimeWindow relative to it.
+/// Of all such pairs, the one with the total energy closest to 1022 keV is taken.
+class GammaPairSelector {
+public:
+    struct Pair {
+        gsl::index first;
+        gsl::index second;
+        double energySum;
+        double cosAngle;
+        double dt;
+    };
+
+public:
+    GammaPairSelector();
+
+    auto EnergyWindow() const -> auto { return fEnergyWindow; }
+    auto MaxCosAngle() const -> auto { return fMaxCosAngle; }
+    auto MaxTimeDifference() const -> auto { return fMaxTimeDifference; }
+    auto MCPTimeWindow() const -> auto { return fMCPTimeWindow; }
+
+    auto EnergyWindow(std::pair<double, double> val) -> void { fEnergyWindow = val; }
+    auto MaxCosAngle(double val) -> void { fMaxCosAngle = val; }
+    auto MaxTimeDifference(double val) -> void { fMaxTimeDifference = val; }
+    auto MCPTimeWindow(std::pair<double, double> val) -> void { fMCPTimeWindow = val; }
+
+    auto operator()(const std::vector<std::shared_ptr<Mustard::Data::Tuple<Data::ECALCluster>>>& cluster,
+                    std::optional<double> mcpTime = std::nullopt) const -> std::optional<Pair>;
+
+    auto Import(const YAML::Node& node) -> void;
+    auto Export(YAML::Node& node) const -> void;
+
+private:
+    std::pair<double, double> fEnergyWindow;
+    double fMaxCosAngle;
+    double fMaxTimeDifference;
+    std::pair<double, double> fMCPTimeWindow;
+
+    muc::array3d fAnnihilationPoint;
+};
+
+} // namespace MACE::inline Analysis
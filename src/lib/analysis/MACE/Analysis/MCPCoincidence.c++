@@ -0,0 +1,56 @@
+#include "MACE/Analysis/MCPCoincidence.h++"
+
+#include "Mustard/Utility/LiteralUnit.h++"
+
+#include "muc/array"
+#include "muc/math"
+
+#include "yaml-cpp/yaml.h"
+
+namespace MACE::inline Analysis {
+
+using namespace Mustard::LiteralUnit::Length;
+using namespace Mustard::LiteralUnit::Time;
+
+MCPCoincidence::MCPCoincidence() :
+    fTimeWindow{0, 1_us},
+    fMaxDistance{5_mm},
+    fPositionScale{1} {}
+
+auto MCPCoincidence::operator()(const DCACalculator::Vertex& vertex,
+                                const std::vector<std::shared_ptr<Mustard::Data::Tuple<Data::MCPHit>>>& hit) const -> std::optional<Match> {
+    std::optional<Match> best;
+    for (gsl::index i{}; i < ssize(hit); ++i) {
+        const auto dt{*Get<"t">(*hit[i]) - vertex.t};
+        if (dt < fTimeWindow.first or dt > fTimeWindow.second) {
+            continue;
+        }
+        const auto x{Get<"x">(*hit[i]).As<muc::array2d>()};
+        const auto dr{muc::hypot(x[0] - fPositionScale * vertex.x[0], x[1] - fPositionScale * vertex.x[1])};
+        if (dr > fMaxDistance or (best and dr >= best->dr)) {
+            continue;
+        }
+        best = {i, dt, dr};
+    }
+    return best;
+}
+
+auto MCPCoincidence::Import(const YAML::Node& node) -> void {
+    if (const auto v{node["TimeWindow"]}) {
+        fTimeWindow = v.as<std::pair<double, double>>();
+    }
+    if (const auto v{node["MaxDistance"]}) {
+        fMaxDistance = v.as<double>();
+    }
+    if (const auto v{node["PositionScale"]}) {
+        fPositionScale = v.as<double>();
+    }
+}
+
+auto MCPCoincidence::Export(YAML::Node& node) const -> void {
+    node["TimeWindow"] = fTimeWindow;
+    node["MaxDistance"] = fMaxDistance;
+    node["PositionScale"] = fPositionScale;
+}
+
+} // namespace MACE::inline Analysis
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "MACE/Analysis/DCACalculator.h++"
+#include "MACE/Data/Hit.h++"
+
+#include "Mustard/Data/Tuple.h++"
+
+#include "gsl/gsl"
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace YAML {
+class Node;
+} // namespace YAML
+
+namespace MACE::inline Analysis {
+
+/// @brief Coincidence between a track vertex and an MCP hit (the transported atomic positron).
+///
+/// A hit coincides if its time after the vertex time (the transport time) is in the time window,
+/// and its position is within MaxDistance of the expected position, i.e. the vertex transverse
+/// position times the transport magnification (PositionScale). The closest one in position is
+/// taken.
+class MCPCoincidence {
+public:
+    struct Match {
+        gsl::index hit;
+        double dt;
+        double dr;
+    };
+
+public:
+    MCPCoincidence();
+
+    auto TimeWindow() const -> auto { return fTimeWindow; }
+    auto MaxDistance() const -> auto { return fMaxDistance; }
+    auto PositionScale() const -> auto { return fPositionScale; }
+
+    auto TimeWindow(std::pair<double, double> val) -> void { fTimeWindow = val; }
+    auto MaxDistance(double val) -> void { fMaxDistance = val; }
+    auto PositionScale(double val) -> void { fPositionScale = val; }
+
+    auto operator()(const DCACalculator::Vertex& vertex,
+                    const std::vector<std::shared_ptr<Mustard::Data::Tuple<Data::MCPHit>>>& hit) const -> std::optional<Match>;
+
+    auto Import(const YAML::Node& node) -> void;
+    auto Export(YAML::Node& node) const -> void;
+
+private:
+    std::pair<double, double> fTimeWindow;
+    double fMaxDistance;
+    double fPositionScale;
+};
+
+} // namespace MACE::inline Analysis
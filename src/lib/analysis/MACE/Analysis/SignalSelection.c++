@@ -0,0 +1,156 @@
+#include "MACE/Analysis/SignalSelection.h++"
+
+#include "Mustard/Math/Norm.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+
+#include "yaml-cpp/yaml.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace MACE::inline Analysis {
+
+using namespace Mustard::LiteralUnit::Energy;
+using namespace Mustard::LiteralUnit::Length;
+
+SignalSelection::SignalSelection() :
+    fTrackPDGID{11},
+    fMaxChi2{5},
+    fMomentumRange{0, 55_MeV},
+    fMaxDCA{5_mm},
+    fMCPEnabled{true},
+    fECALEnabled{true},
+    fDCACalculator{},
+    fMCPCoincidence{},
+    fGammaPairSelector{},
+    fCutFlow{} {
+    ResetCutFlow();
+}
+
+auto SignalSelection::Import(const YAML::Node& node) -> void {
+    if (const auto track{node["Track"]}) {
+        if (const auto v{track["PDGID"]}) {
+            fTrackPDGID = v.as<int>();
+        }
+        if (const auto v{track["MaxChi2"]}) {
+            fMaxChi2 = v.as<double>();
+        }
+        if (const auto v{track["MomentumRange"]}) {
+            fMomentumRange = v.as<std::pair<double, double>>();
+        }
+    }
+    if (const auto vertex{node["Vertex"]}) {
+        if (const auto v{vertex["MaxDCA"]}) {
+            fMaxDCA = v.as<double>();
+        }
+    }
+    if (const auto mcp{node["MCP"]}) {
+        if (const auto v{mcp["Enabled"]}) {
+            fMCPEnabled = v.as<bool>();
+        }
+        fMCPCoincidence.Import(mcp);
+    }
+    if (const auto ecal{node["ECAL"]}) {
+        if (const auto v{ecal["Enabled"]}) {
+            fECALEnabled = v.as<bool>();
+        }
+        fGammaPairSelector.Import(ecal);
+    }
+    ResetCutFlow();
+}
+
+auto SignalSelection::Export(YAML::Node& node) const -> void {
+    auto track{node["Track"]};
+    track["PDGID"] = fTrackPDGID;
+    track["MaxChi2"] = fMaxChi2;
+    track["MomentumRange"] = fMomentumRange;
+    auto vertex{node["Vertex"]};
+    vertex["MaxDCA"] = fMaxDCA;
+    auto mcp{node["MCP"]};
+    mcp["Enabled"] = fMCPEnabled;
+    fMCPCoincidence.Export(mcp);
+    auto ecal{node["ECAL"]};
+    ecal["Enabled"] = fECALEnabled;
+    fGammaPairSelector.Export(ecal);
+}
+
+auto SignalSelection::operator()(const JoinedEvent& event) -> std::optional<Candidate> {
+    fCutFlow.Pass(0, event.weight);
+    if (event.track.empty()) {
+        return std::nullopt;
+    }
+    std::optional<Candidate> best;
+    for (auto&& track : event.track) {
+        auto candidate{Select(event, *track)};
+        if (not best or candidate.nPassed > best->nPassed) {
+            best = std::move(candidate);
+        }
+        if (best->nPassed == NCut() - 1) {
+            break;
+        }
+    }
+    if (best) {
+        for (gsl::index i{1}; i <= best->nPassed; ++i) {
+            fCutFlow.Pass(i, event.weight);
+        }
+    }
+    return best;
+}
+
+auto SignalSelection::Select(const JoinedEvent& event, const Mustard::Data::Tuple<Data::MMSTrack>& track) const -> Candidate {
+    Candidate candidate{*Get<"EvtID">(track), *Get<"TrkID">(track), event.weight, 1, {}, {}, {}}; // has a track
+
+    const auto p{std::sqrt(Mustard::Math::NormSq(*Get<"p0">(track)))};
+    if (*Get<"PDGID">(track) != fTrackPDGID or *Get<"chi2">(track) > fMaxChi2 or
+        p < fMomentumRange.first or p > fMomentumRange.second) {
+        return candidate;
+    }
+    ++candidate.nPassed;
+
+    const Mustard::Data::Tuple<Data::MMSTrackState>* targetState{};
+    for (auto&& state : event.trackState) {
+        if (*Get<"TrkID">(*state) == candidate.trkID and *Get<"SurfID">(*state) == 0) {
+            targetState = state.get();
+            break;
+        }
+    }
+    candidate.vertex = fDCACalculator(track, targetState);
+    if (not candidate.vertex or candidate.vertex->dca > fMaxDCA) {
+        return candidate;
+    }
+    ++candidate.nPassed;
+
+    std::optional<double> mcpTime;
+    if (fMCPEnabled) {
+        candidate.mcp = fMCPCoincidence(*candidate.vertex, event.mcpHit);
+        if (not candidate.mcp) {
+            return candidate;
+        }
+        ++candidate.nPassed;
+        mcpTime = *Get<"t">(*event.mcpHit[candidate.mcp->hit]);
+    }
+
+    if (fECALEnabled) {
+        candidate.gammaPair = fGammaPairSelector(event.ecalCluster, mcpTime);
+        if (not candidate.gammaPair) {
+            return candidate;
+        }
+        ++candidate.nPassed;
+    }
+
+    return candidate;
+}
+
+auto SignalSelection::ResetCutFlow() -> void {
+    std::vector<std::string> cutName{"All", "HasTrack", "Track", "Vertex"};
+    if (fMCPEnabled) {
+        cutName.emplace_back("MCP");
+    }
+    if (fECALEnabled) {
+        cutName.emplace_back("ECAL");
+    }
+    fCutFlow = CutFlow{cutName};
+}
+
+} // namespace MACE::inline Analysis
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "MACE/Analysis/CutFlow.h++"
+#include "MACE/Analysis/DCACalculator.h++"
+#include "MACE/Analysis/EventJoiner.h++"
+#include "MACE/Analysis/GammaPairSelector.h++"
+#include "MACE/Analysis/MCPCoincidence.h++"
+
+#include <optional>
+#include <utility>
+
+namespace YAML {
+class Node;
+} // namespace YAML
+
+namespace MACE::inline Analysis {
+
+/// @brief Antimuonium signal selection on joined events, with its cut flow.
+///
+/// Cuts in order, after 'All' (every joined event, see EventJoiner); MCP and ECAL can be disabled:
+///  - HasTrack: at least one reconstructed track (tracking efficiency);
+///  - Track: a track of the signal particle (TrackPDGID, the electron from antimuonium decay by
+///    default) with reduced chi2 and momentum in range;
+///  - Vertex: a vertex on the target plane with DCA to the target below MaxDCA;
+///  - MCP: an MCP hit in coincidence with the vertex (see MCPCoincidence);
+///  - ECAL: a 511 keV gamma pair in coincidence with the MCP hit (see GammaPairSelector).
+/// Each track is tried in turn and the first candidate passing the most cuts counts.
+class SignalSelection {
+public:
+    struct Candidate {
+        int evtID;
+        int trkID;
+        double weight;
+        gsl::index nPassed; // number of cuts passed after 'All', at least 1 (HasTrack)
+        std::optional<DCACalculator::Vertex> vertex;
+        std::optional<MCPCoincidence::Match> mcp;
+        std::optional<GammaPairSelector::Pair> gammaPair;
+    };
+
+public:
+    SignalSelection();
+
+    auto Import(const YAML::Node& node) -> void;
+    auto Export(YAML::Node& node) const -> void;
+
+    /// @brief Select on an event and record it in the cut flow.
+    /// @return The candidate passing the most cuts, or nullopt if the event has no track.
+    auto operator()(const JoinedEvent& event) -> std::optional<Candidate>;
+
+    auto NCut() const -> auto { return ssize(fCutFlow.EntryList()); }
+    auto TheCutFlow() const -> const auto& { return fCutFlow; }
+    auto TheCutFlow() -> auto& { return fCutFlow; }
+
+private:
+    auto Select(const JoinedEvent& event, const Mustard::Data::Tuple<Data::MMSTrack>& track) const -> Candidate;
+    auto ResetCutFlow() -> void;
+
+private:
+    int fTrackPDGID;
+    double fMaxChi2;
+    std::pair<double, double> fMomentumRange;
+    double fMaxDCA;
+    bool fMCPEnabled;
+    bool fECALEnabled;
+
+    DCACalculator fDCACalculator;
+    MCPCoincidence fMCPCoincidence;
+    GammaPairSelector fGammaPairSelector;
+    CutFlow fCutFlow;
+};
+
+} // namespace MACE::inline Analysis
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/Value.h++"
+
+#include "muc/array"
+
+#include <vector>
+
+namespace MACE::Data {
+
+using ECALCluster = Mustard::Data::TupleModel<
+    Mustard::Data::Value<int, "EvtID", "Event ID">,
+    Mustard::Data::Value<int, "ClsID", "Cluster ID">,
+    Mustard::Data::Value<short, "SeedID", "Seed module ID">,
+    Mustard::Data::Value<std::vector<short>, "ModID", "Module IDs in this cluster">,
+    Mustard::Data::Value<double, "t", "Cluster time (seed hit time)">,
+    Mustard::Data::Value<float, "Edep", "Cluster energy">,
+    Mustard::Data::Value<muc::array3f, "x", "Energy-weighted centroid">>;
+
+} // namespace MACE::Data
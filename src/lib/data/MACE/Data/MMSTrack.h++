@@ -31,12 +31,24 @@ using MMSTrack = Mustard::Data::TupleModel<
     Mustard::Data::Value<float, "r0", "Transverse radius">,
     Mustard::Data::Value<float, "phi0", "Vertex azimuth angle">,
     Mustard::Data::Value<float, "z0", "Vertex z coordinate">,
-    Mustard::Data::Value<float, "theta0", "Reference zenith angle">>;
+    Mustard::Data::Value<float, "theta0", "Reference zenith angle">,
+    Mustard::Data::Value<std::vector<float>, "cov", "Helix covariance (packed lower triangle of (c0x, c0y, r0, z0, theta0) at fixed phi0, empty if unknown)">>;
 
 using MMSSimTrack = Mustard::Data::TupleModel<
     MMSTrack,
     Mustard::Data::Value<std::string, "CreatProc", "Track creator process (MC truth)">>;
 
+/// @brief A track state (position, momentum and their covariance) extrapolated to a surface.
+using MMSTrackState = Mustard::Data::TupleModel<
+    Mustard::Data::Value<int, "EvtID", "Event ID">,
+    Mustard::Data::Value<int, "TrkID", "Track ID">,
+    Mustard::Data::Value<int, "SurfID", "Surface ID (0: target, 1: MCP)">,
+    Mustard::Data::Value<double, "t", "Time at surface">,
+    Mustard::Data::Value<float, "s", "Path length from vertex (negative if upstream)">,
+    Mustard::Data::Value<muc::array3f, "x", "Position at surface">,
+    Mustard::Data::Value<muc::array3f, "p", "Momentum at surface">,
+    Mustard::Data::Value<std::vector<float>, "cov", "State covariance (packed lower triangle of (x, y, z, px, py, pz))">>;
+
 /// @brief Calculate helix information from known vertex information in-place.
 /// @param track The track
 /// @param magneticFluxDensity Magnetic field B0
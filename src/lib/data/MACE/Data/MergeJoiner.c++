@@ -0,0 +1,161 @@
+#include "MACE/Data/MergeJoiner.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "fmt/format.h"
+#include "fmt/ranges.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
+namespace MACE::Data {
+
+MergeJoinerBase::MergeJoinerBase(std::vector<Stream> stream) :
+    fStream{std::move(stream)},
+    fBatchSize{10000},
+    fEvent{},
+    fIndex(fStream.size()) {
+    const auto& worldComm{mplr::comm_world()};
+    const auto comm{worldComm.native_handle()};
+    const auto rank{worldComm.rank()};
+    const auto nProcess{worldComm.size()};
+    const auto nStream{static_cast<int>(fStream.size())};
+    const auto ReadEvtID{[this](gsl::index i, long long begin, long long end) -> std::vector<int> {
+        const auto& [file, tree]{fStream[i]};
+        if (tree.empty() or begin == end) {
+            return {};
+        }
+        return *ROOT::RDataFrame{tree, file}.Range(begin, end).Take<int>("EvtID");
+    }};
+    const auto MergeEvent{[](std::vector<int>& event, const std::vector<int>& evtID) {
+        std::vector<int> merged;
+        merged.reserve(event.size() + evtID.size());
+        std::ranges::set_union(event, evtID, std::back_inserter(merged));
+        const auto [last, _]{std::ranges::unique(merged)};
+        merged.erase(last, merged.end());
+        event = std::move(merged);
+    }};
+
+    // number of entries of each stream, counted on master
+    std::vector<long long> nEntry(nStream);
+    if (rank == 0) {
+        for (int i{}; i < nStream; ++i) {
+            if (const auto& [file, tree]{fStream[i]}; not tree.empty()) {
+                nEntry[i] = *ROOT::RDataFrame{tree, file}.Count();
+            }
+        }
+    }
+    MPI_Bcast(nEntry.data(), nStream, MPI_LONG_LONG, 0, comm);
+
+    // each process reads EvtID of an equal share of the entries of each stream
+    std::vector<long long> shareBegin(nStream);
+    std::vector<std::vector<int>> shareEvtID(nStream);
+    std::vector<int> shareEvent;
+    std::vector<int> shareBound(2 * nStream); // first and last EvtID of the share of each stream
+    int unsorted{-1};
+    for (int i{}; i < nStream; ++i) {
+        shareBegin[i] = nEntry[i] * rank / nProcess;
+        shareEvtID[i] = ReadEvtID(i, shareBegin[i], nEntry[i] * (rank + 1) / nProcess);
+        if (not std::ranges::is_sorted(shareEvtID[i])) {
+            unsorted = i;
+        }
+        shareBound[2 * i] = shareEvtID[i].empty() ? std::numeric_limits<int>::max() : shareEvtID[i].front();
+        shareBound[2 * i + 1] = shareEvtID[i].empty() ? std::numeric_limits<int>::min() : shareEvtID[i].back();
+        MergeEvent(shareEvent, shareEvtID[i]);
+    }
+    // shares must also be in order across processes
+    std::vector<int> allShareBound(2 * nStream * nProcess);
+    MPI_Allgather(shareBound.data(), 2 * nStream, MPI_INT, allShareBound.data(), 2 * nStream, MPI_INT, comm);
+    for (int i{}; i < nStream; ++i) {
+        auto previousLast{std::numeric_limits<int>::min()};
+        for (int r{}; r < nProcess; ++r) {
+            const auto first{allShareBound[2 * nStream * r + 2 * i]};
+            const auto last{allShareBound[2 * nStream * r + 2 * i + 1]};
+            if (first > last) {
+                continue;
+            }
+            if (first < previousLast) {
+                unsorted = std::max(unsorted, i);
+            }
+            previousLast = last;
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &unsorted, 1, MPI_INT, MPI_MAX, comm);
+    if (unsorted >= 0) {
+        const auto& [file, tree]{fStream[unsorted]};
+        Mustard::Throw<std::runtime_error>(fmt::format("Dataset '{}' in {} is not sorted by EvtID", tree, fmt::join(file, ",")));
+    }
+
+    // union of events over streams, split into contiguous blocks over processes on master;
+    // block k holds EvtID in [blockBegin[k], blockBegin[k + 1])
+    const auto count{static_cast<int>(shareEvent.size())};
+    std::vector<int> countOfRank(rank == 0 ? nProcess : 0);
+    MPI_Gather(&count, 1, MPI_INT, countOfRank.data(), 1, MPI_INT, 0, comm);
+    std::vector<int> displacement(countOfRank.size());
+    std::exclusive_scan(countOfRank.cbegin(), countOfRank.cend(), displacement.begin(), 0);
+    std::vector<int> allShareEvent(std::reduce(countOfRank.cbegin(), countOfRank.cend()));
+    MPI_Gatherv(shareEvent.data(), count, MPI_INT, allShareEvent.data(), countOfRank.data(), displacement.data(), MPI_INT, 0, comm);
+    std::vector<int> blockBegin(nProcess + 1, std::numeric_limits<int>::max());
+    if (rank == 0) {
+        std::ranges::sort(allShareEvent);
+        const auto [last, _]{std::ranges::unique(allShareEvent)};
+        allShareEvent.erase(last, allShareEvent.end());
+        const auto nEvent{std::ssize(allShareEvent)};
+        for (int k{}; k < nProcess; ++k) {
+            if (const auto first{nEvent * k / nProcess}; first < nEvent) {
+                blockBegin[k] = allShareEvent[first];
+            }
+        }
+    }
+    MPI_Bcast(blockBegin.data(), nProcess + 1, MPI_INT, 0, comm);
+
+    // first entry of each block in each stream: the smallest over shares of the first entry with EvtID >= blockBegin
+    std::vector<long long> blockEntry(nStream * (nProcess + 1));
+    for (int i{}; i < nStream; ++i) {
+        for (int k{}; k <= nProcess; ++k) {
+            const auto found{std::ranges::lower_bound(shareEvtID[i], blockBegin[k])};
+            blockEntry[i * (nProcess + 1) + k] = found == shareEvtID[i].end() ? nEntry[i] : shareBegin[i] + (found - shareEvtID[i].begin());
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, blockEntry.data(), blockEntry.size(), MPI_LONG_LONG, MPI_MIN, comm);
+    shareEvtID.clear();
+
+    // each process indexes its own block, ended by a sentinel at the first entry after it
+    for (int i{}; i < nStream; ++i) {
+        const auto entryBegin{blockEntry[i * (nProcess + 1) + rank]};
+        const auto entryEnd{blockEntry[i * (nProcess + 1) + rank + 1]};
+        const auto evtID{ReadEvtID(i, entryBegin, entryEnd)};
+        for (gsl::index k{}; k < std::ssize(evtID); ++k) {
+            if (fIndex[i].empty() or evtID[k] != fIndex[i].back().evtID) {
+                fIndex[i].push_back({evtID[k], entryBegin + k});
+            }
+        }
+        fIndex[i].push_back({std::numeric_limits<int>::max(), entryEnd});
+        MergeEvent(fEvent, evtID);
+    }
+}
+
+auto MergeJoinerBase::EvtIDRange() const -> std::pair<int, int> {
+    if (fEvent.empty()) {
+        return {0, -1};
+    }
+    return {fEvent.front(), fEvent.back()};
+}
+
+auto MergeJoinerBase::EntryRange(gsl::index stream, int evtIDBegin, int evtIDEnd) const -> std::pair<long long, long long> {
+    const auto& index{fIndex[stream]};
+    if (index.empty()) {
+        return {0, 0};
+    }
+    return {std::ranges::lower_bound(index, evtIDBegin, {}, &EventEntry::evtID)->firstEntry,
+            std::ranges::lower_bound(index, evtIDEnd, {}, &EventEntry::evtID)->firstEntry};
+}
+
+} // namespace MACE::Data
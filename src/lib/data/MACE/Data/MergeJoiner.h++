@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Mustard/Data/Take.h++"
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include "ROOT/RDataFrame.hxx"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace MACE::Data {
+
+/// @brief Non-template part of MergeJoiner: the event index of each stream and the split over processes.
+class MergeJoinerBase {
+public:
+    struct Stream {
+        std::vector<std::string> file;
+        std::string tree; ///< an empty name makes the stream always empty
+    };
+
+protected:
+    explicit MergeJoinerBase(std::vector<Stream> stream);
+    ~MergeJoinerBase() = default;
+
+public:
+    auto BatchSize() const -> auto { return fBatchSize; }
+    auto BatchSize(gsl::index val) -> void { fBatchSize = val; }
+
+    /// @brief Number of events of this process (with at least one entry in any stream).
+    auto NEvent() const -> gsl::index { return std::ssize(fEvent); }
+    /// @brief First and last EvtID of this process (both inclusive), {0, -1} if there is none.
+    auto EvtIDRange() const -> std::pair<int, int>;
+
+protected:
+    /// @brief Entries [begin, end) of a stream holding EvtID in [evtIDBegin, evtIDEnd).
+    auto EntryRange(gsl::index stream, int evtIDBegin, int evtIDEnd) const -> std::pair<long long, long long>;
+
+private:
+    struct EventEntry {
+        int evtID;
+        long long firstEntry;
+    };
+
+protected:
+    std::vector<Stream> fStream;
+    gsl::index fBatchSize;
+    std::vector<int> fEvent;
+
+private:
+    std::vector<std::vector<EventEntry>> fIndex;
+};
+
+/// @brief Joins several EvtID-sorted datasets event by event in one streaming pass.
+///
+/// Each stream is a tree (e.g. CDC, TTC, MCP and ECAL hits) in one or several files, sorted by EvtID as written by
+/// the simulation and reconstruction programs; an unsorted stream is rejected. The union of EvtIDs over all streams
+/// is split into contiguous blocks over processes: each process reads EvtID of an equal share of the entries, the
+/// master splits the union and broadcasts the first EvtID of each block, and the entry boundaries of the blocks are
+/// reduced from the shares, so that each process then reads EvtID again only within its own block to index it.
+/// Each process reads its block batch by batch (BatchSize events at a time), reading only the entry ranges of that
+/// batch, and merge-joins the streams: the callback receives the EvtID and one vector of tuples per stream, empty if
+/// the stream has no entry in that event. Memory is bounded by one batch of tuples, plus an event index (EvtID and
+/// first entry) per stream. Entries are read with RDataFrame::Range, which keeps them in order but requires ROOT
+/// implicit multithreading to be disabled. The constructor is collective over MPI_COMM_WORLD.
+template<Mustard::Data::TupleModelizable... AModels>
+class MergeJoiner : public MergeJoinerBase {
+public:
+    using Event = std::tuple<std::vector<std::shared_ptr<Mustard::Data::Tuple<AModels>>>...>;
+
+public:
+    explicit MergeJoiner(std::array<Stream, sizeof...(AModels)> stream);
+
+    /// @return Number of events visited.
+    template<std::invocable<int, const Event&> F>
+    auto Join(F&& Analyze) const -> gsl::index;
+
+private:
+    template<std::size_t I>
+    auto Read(int evtIDBegin, int evtIDEnd) const -> std::tuple_element_t<I, Event>;
+};
+
+} // namespace MACE::Data
+
+#include "MACE/Data/MergeJoiner.inl"
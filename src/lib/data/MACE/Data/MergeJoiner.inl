@@ -0,0 +1,53 @@
+namespace MACE::Data {
+
+template<Mustard::Data::TupleModelizable... AModels>
+MergeJoiner<AModels...>::MergeJoiner(std::array<Stream, sizeof...(AModels)> stream) :
+    MergeJoinerBase{{std::make_move_iterator(stream.begin()), std::make_move_iterator(stream.end())}} {}
+
+template<Mustard::Data::TupleModelizable... AModels>
+template<std::invocable<int, const typename MergeJoiner<AModels...>::Event&> F>
+auto MergeJoiner<AModels...>::Join(F&& Analyze) const -> gsl::index {
+    Event batch;
+    Event event;
+    for (gsl::index batchBegin{}; batchBegin < NEvent(); batchBegin += fBatchSize) {
+        const auto batchEnd{std::min(batchBegin + fBatchSize, NEvent())};
+        const auto evtIDBegin{fEvent[batchBegin]};
+        const auto evtIDEnd{fEvent[batchEnd - 1] + 1};
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            ((std::get<Is>(batch) = Read<Is>(evtIDBegin, evtIDEnd)), ...);
+        }(std::index_sequence_for<AModels...>{});
+
+        std::array<gsl::index, sizeof...(AModels)> cursor{};
+        const auto Collect{[&](const auto& stream, gsl::index& i, int evtID, auto& eventStream) {
+            eventStream.clear();
+            for (; i < std::ssize(stream) and Get<"EvtID">(*stream[i]) == evtID; ++i) {
+                eventStream.emplace_back(stream[i]);
+            }
+        }};
+        for (auto i{batchBegin}; i < batchEnd; ++i) {
+            const auto evtID{fEvent[i]};
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                (Collect(std::get<Is>(batch), cursor[Is], evtID, std::get<Is>(event)), ...);
+            }(std::index_sequence_for<AModels...>{});
+            Analyze(evtID, std::as_const(event));
+        }
+    }
+    return NEvent();
+}
+
+template<Mustard::Data::TupleModelizable... AModels>
+template<std::size_t I>
+auto MergeJoiner<AModels...>::Read(int evtIDBegin, int evtIDEnd) const -> std::tuple_element_t<I, Event> {
+    const auto& [file, tree]{fStream[I]};
+    if (tree.empty()) {
+        return {};
+    }
+    const auto [entryBegin, entryEnd]{EntryRange(I, evtIDBegin, evtIDEnd)};
+    if (entryBegin == entryEnd) {
+        return {};
+    }
+    using Model = std::tuple_element_t<I, std::tuple<AModels...>>;
+    return Mustard::Data::Take<Model>::From(ROOT::RDataFrame{tree, file}.Range(entryBegin, entryEnd));
+}
+
+} // namespace MACE::Data
@@ -31,4 +31,25 @@ using MRPCRawHit = Mustard::Data::TupleModel<
     Mustard::Data::Value<double, "t", "Hit time">,
     Mustard::Data::Value<muc::array3f, "x", "Hit position">>;
 
+namespace internal {
+
+using RawHitEventID = Mustard::Data::TupleModel<
+    Mustard::Data::Value<int, "EvtID", "Event ID">>;
+
+} // namespace internal
+
+// raw hits as written by the readout (e.g. DigiMACE), no MC truth
+
+using CDCReadout = Mustard::Data::TupleModel<
+    internal::RawHitEventID,
+    CDCRawHit>;
+
+using TTCReadout = Mustard::Data::TupleModel<
+    internal::RawHitEventID,
+    TTCRawHit>;
+
+using ECALReadout = Mustard::Data::TupleModel<
+    internal::RawHitEventID,
+    ECALRawHit>;
+
 } // namespace MACE::Data
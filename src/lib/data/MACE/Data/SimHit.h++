@@ -15,6 +15,7 @@ namespace internal {
 
 using SimHitVertexTruth = Mustard::Data::TupleModel<
     Mustard::Data::Value<int, "TrkID", "MC Track ID">,
+    Mustard::Data::Value<int, "PrmID", "Index of the primary the track descends from (MC truth)">,
     Mustard::Data::Value<int, "PDGID", "Particle PDG ID (MC truth)">,
     Mustard::Data::Value<double, "t0", "Vertex time (MC truth)">,
     Mustard::Data::Value<muc::array3f, "x0", "Vertex position (MC truth)">,
@@ -11,15 +11,18 @@ namespace MACE::Data {
 
 using SimPrimaryVertex = Mustard::Data::TupleModel<
     Mustard::Data::Value<int, "EvtID", "MC Event ID">,
+    Mustard::Data::Value<int, "PrmID", "Primary index (e.g. beam muon index in pile-up events)">,
     Mustard::Data::Value<int, "PDGID", "PDG ID">,
     Mustard::Data::Value<double, "t0", "Primary time">,
     Mustard::Data::Value<muc::array3f, "x0", "Primary position">,
     Mustard::Data::Value<float, "Ek0", "Primary kinetic energy">,
-    Mustard::Data::Value<muc::array3f, "p0", "Primary momentum">>;
+    Mustard::Data::Value<muc::array3f, "p0", "Primary momentum">,
+    Mustard::Data::Value<float, "w", "Primary vertex weight">>;
 
 using SimDecayVertex = Mustard::Data::TupleModel<
     DecayVertex,
     Mustard::Data::Value<int, "TrkID", "Parent MC Track ID">,
+    Mustard::Data::Value<int, "PrmID", "Index of the primary the parent descends from">,
     Mustard::Data::Value<float, "Ek", "Parent kinetic energy at decay">,
     Mustard::Data::Value<muc::array3f, "p", "Parent momentum at decay">>;
 
@@ -1,5 +1,6 @@
 #include "MACE/Detector/Description/CDC.h++"
 
+#include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
 #include "Mustard/Utility/PhysicalConstant.h++"
 
@@ -11,11 +12,16 @@
 #include "muc/math"
 #include "muc/numeric"
 
+#include "fmt/format.h"
+
 #include <algorithm>
 #include <cmath>
 #include <functional>
 #include <iostream>
+#include <iterator>
+#include <numbers>
 #include <numeric>
+#include <stdexcept>
 #include <tuple>
 #include <utility>
 
@@ -45,6 +51,8 @@ CDC::CDC() :
     fInnerShellAlThickness{this, 25_um},
     fInnerShellMylarThickness{this, 25_um},
     fOuterShellThickness{this, 10_mm},
+    fSenseLayerAlignment{this, {}},
+    fCellAlignment{this, {}},
     fLayerConfiguration{this, [this] { return CalculateLayerConfiguration(); }},
     fCellMap{this, [this] { return CalculateCellMap(); }},
     fCellMapFromSenseLayerIDAndLocalCellID{this, [this] { return CalculateCellMapFromSenseLayerIDAndLocalCellID(); }},
@@ -54,7 +62,12 @@ CDC::CDC() :
     fOuterShellCFRPDensity{this, 1.95_g_cm3},
     // Detection
     fMeanDriftVelocity{this, 3.5_cm_us},
-    fTimeResolutionFWHM{this, 30_ns} {}
+    fMeanClusterDensity{this, 16 / 1_cm},
+    fDriftTimeTableMaxDistance{this, 10_mm},
+    fDriftTimeTable{this, {}},
+    fTimeResolutionFWHM{this, 30_ns},
+    fDriftVelocityScale{this, {}},
+    fXTRelation{this, [this] { return CalculateXTRelation(); }} {}
 
 auto CDC::GasMaterial() const -> G4Material* {
     constexpr auto materialName{"CDCGas"};
@@ -208,6 +221,19 @@ auto CDC::CalculateCellMap() const -> std::vector<CellInformation> {
     const auto rFieldWire{fFieldWireDiameter / 2};
 
     const auto& layerConfig{LayerConfiguration()};
+    const auto nSenseLayer{fNSuperLayer * fNSenseLayerPerSuper};
+    const auto& layerAlignment{*fSenseLayerAlignment};
+    if (not layerAlignment.empty() and std::ssize(layerAlignment) != nSenseLayer) {
+        Mustard::Throw<std::runtime_error>(fmt::format("CDC sense layer alignment has {} layers, expects {}", layerAlignment.size(), nSenseLayer));
+    }
+    // per cell: shift (dx, dy) at z = 0 and wire tilt (dx/dz, dy/dz) around that point
+    muc::flat_hash_map<int, std::pair<Eigen::Vector2d, Eigen::Vector2d>> cellAlignment;
+    for (auto&& row : *fCellAlignment) {
+        if (row.size() != 3 and row.size() != 5) {
+            Mustard::Throw<std::runtime_error>(fmt::format("CDC cell alignment row has {} values, expects 3 (cell ID, dx, dy) or 5 (cell ID, dx, dy, tx, ty)", row.size()));
+        }
+        cellAlignment[std::lround(row[0])] = {{row[1], row[2]}, row.size() == 5 ? Eigen::Vector2d{row[3], row[4]} : Eigen::Vector2d{0, 0}};
+    }
     cellMap.reserve(muc::ranges::transform_reduce(layerConfig, 0ull, std::plus{},
                                                   [this](const auto& super) {
                                                       return super.nCellPerSenseLayer * fNSenseLayerPerSuper;
@@ -220,17 +246,33 @@ auto CDC::CalculateCellMap() const -> std::vector<CellInformation> {
             const auto wireRadialPosition{muc::midpoint(sense.innerRadius, sense.outerRadius) + rFieldWire}; // clang-format off
             const Eigen::AngleAxisd stereoRotation{-sense.StereoZenithAngle(wireRadialPosition), Eigen::Vector3d{1, 0, 0}};
             const auto senseWireHalfLength{sense.halfLength * sense.SecStereoZenithAngle(sense.innerRadius + fFieldWireDiameter / 2 + sense.cellWidth / 2)};
+            // alignment: the whole layer rotates by dphi around z and shifts by (dx, dy), then each cell shifts and tilts
+            const auto [layerShift, layerRotation]{[&] {
+                if (layerAlignment.empty()) {
+                    return std::pair{Eigen::Vector2d{0, 0}, 0.};
+                }
+                const auto& a{layerAlignment[sense.senseLayerID]};
+                if (a.size() != 3) {
+                    Mustard::Throw<std::runtime_error>(fmt::format("CDC sense layer {} alignment has {} values, expects 3 (dx, dy, dphi)", sense.senseLayerID, a.size()));
+                }
+                return std::pair{Eigen::Vector2d{a[0], a[1]}, a[2]};
+            }()};
             for (int cellLocalID{};
                  auto&& cell : sense.cell) {
+                const auto [cellShift, cellTilt]{cellAlignment.contains(cell.cellID) ?
+                                                     cellAlignment.at(cell.cellID) :
+                                                     std::pair{Eigen::Vector2d{0, 0}, Eigen::Vector2d{0, 0}}};
+                const Eigen::Vector3d direction{Eigen::AngleAxisd{cell.centerAzimuth + layerRotation, Eigen::Vector3d{0, 0, 1}} *
+                                                (stereoRotation * Eigen::Vector3d{0, 0, 1})};
                 cellMap.push_back({cell.cellID,
                                    cellLocalID,
                                    sense.senseLayerID,
                                    senseLayerLocalID,
                                    superLayerID,
-                                   Eigen::Rotation2Dd{cell.centerAzimuth} *
-                                       Eigen::Vector2d{wireRadialPosition, 0},
-                                   Eigen::AngleAxisd{cell.centerAzimuth, Eigen::Vector3d{0, 0, 1}} *
-                                       (stereoRotation * Eigen::Vector3d{0, 0, 1}),
+                                   Eigen::Rotation2Dd{cell.centerAzimuth + layerRotation} *
+                                           Eigen::Vector2d{wireRadialPosition, 0} +
+                                       layerShift + cellShift,
+                                   (direction / direction.z() + Eigen::Vector3d{cellTilt.x(), cellTilt.y(), 0}).normalized(),
                                    senseWireHalfLength,
                                    cell.centerAzimuth}); // clang-format on
                 /* const auto& x0{cellMap.back().position};
@@ -261,6 +303,76 @@ auto CDC::CalculateCellMapFromSenseLayerIDAndLocalCellID() const -> CellMapFromS
     return cellMapFromSenseLayerIDAndLocalCellID;
 }
 
+auto CDC::CalculateXTRelation() const -> std::vector<XTRelationTable> {
+    const auto nSenseLayer{fNSuperLayer * fNSenseLayerPerSuper};
+    const auto& table{*fDriftTimeTable};
+    const auto& velocityScale{*fDriftVelocityScale};
+    if (not velocityScale.empty() and std::ssize(velocityScale) != nSenseLayer) {
+        Mustard::Throw<std::runtime_error>(fmt::format("CDC drift velocity scale has {} layers, expects {}", velocityScale.size(), nSenseLayer));
+    }
+    // drift velocity scaled by s: t(d) -> t(d) / s
+    const auto TimeScale{[&](int senseLayerID) { return velocityScale.empty() ? 1 : 1 / velocityScale[senseLayerID]; }};
+
+    if (table.empty()) {
+        // isochronous, t = d / v
+        const auto tMax{fDriftTimeTableMaxDistance / fMeanDriftVelocity};
+        std::vector<XTRelationTable> xtRelation;
+        xtRelation.reserve(nSenseLayer);
+        for (int senseLayerID{}; senseLayerID < nSenseLayer; ++senseLayerID) {
+            const auto tMaxOfLayer{tMax * TimeScale(senseLayerID)};
+            xtRelation.push_back({fDriftTimeTableMaxDistance, std::numbers::pi, 2, 2, {0, 0, tMaxOfLayer, tMaxOfLayer}});
+        }
+        return xtRelation;
+    }
+    if (std::ssize(table) != 1 and std::ssize(table) != nSenseLayer) {
+        Mustard::Throw<std::runtime_error>(fmt::format("CDC drift time table has {} layers, expects 1 (shared) or {} (one per sense layer)", table.size(), nSenseLayer));
+    }
+
+    std::vector<XTRelationTable> xtRelation;
+    xtRelation.reserve(nSenseLayer);
+    for (int senseLayerID{}; senseLayerID < nSenseLayer; ++senseLayerID) {
+        const auto& layerTable{table.size() == 1 ? table.front() : table[senseLayerID]};
+        const auto nDistance{static_cast<int>(layerTable.size())};
+        const auto nAngle{nDistance > 0 ? static_cast<int>(layerTable.front().size()) : 0};
+        if (nDistance < 2 or nAngle < 2) {
+            Mustard::Throw<std::runtime_error>(fmt::format("CDC drift time table of sense layer {} is {}x{}, expects at least 2x2", senseLayerID, nDistance, nAngle));
+        }
+        auto& xt{xtRelation.emplace_back(fDriftTimeTableMaxDistance / (nDistance - 1), std::numbers::pi / (nAngle - 1), nDistance, nAngle)};
+        xt.time.reserve(nDistance * nAngle);
+        for (auto&& row : layerTable) {
+            if (std::ssize(row) != nAngle) {
+                Mustard::Throw<std::runtime_error>(fmt::format("CDC drift time table of sense layer {} is not rectangular", senseLayerID));
+            }
+            std::ranges::transform(row, std::back_inserter(xt.time), [scale = TimeScale(senseLayerID)](auto t) { return t * scale; });
+        }
+    }
+
+    return xtRelation;
+}
+
+auto CDC::XTRelationTable::DriftDistance(double t, double alpha) const -> double {
+    const auto v{std::clamp((alpha + std::numbers::pi / 2) / angleStep, 0., nAngle - 1.)};
+    const auto j{std::min(static_cast<int>(v), nAngle - 2)};
+    const auto fv{v - j};
+    const auto TimeAt{[&](int i) {
+        const auto ti{&time[i * nAngle + j]};
+        return (1 - fv) * ti[0] + fv * ti[1];
+    }};
+    if (t <= TimeAt(0)) {
+        return 0;
+    }
+    // bisect over distance nodes, TimeAt(lo) <= t < TimeAt(hi) or t beyond the last node
+    int lo{};
+    int hi{nDistance - 1};
+    while (hi - lo > 1) {
+        const auto mid{(lo + hi) / 2};
+        (TimeAt(mid) <= t ? lo : hi) = mid;
+    }
+    const auto tLo{TimeAt(lo)};
+    const auto tHi{TimeAt(lo + 1)};
+    return (lo + (t - tLo) / (tHi - tLo)) * distanceStep;
+}
+
 auto CDC::ImportAllValue(const YAML::Node& node) -> void {
     // Geometry
     ImportValue(node, fEvenSuperLayerIsAxial, "EvenSuperLayerIsAxial");
@@ -281,13 +393,19 @@ auto CDC::ImportAllValue(const YAML::Node& node) -> void {
     ImportValue(node, fInnerShellAlThickness, "InnerShellAlThickness");
     ImportValue(node, fInnerShellMylarThickness, "InnerShellMylarThickness");
     ImportValue(node, fOuterShellThickness, "OuterShellThickness");
+    ImportValue(node, fSenseLayerAlignment, "SenseLayerAlignment");
+    ImportValue(node, fCellAlignment, "CellAlignment");
     // Material
     ImportValue(node, fGasButaneFraction, "GasButaneFraction");
     ImportValue(node, fEndCapMaterialName, "EndCapMaterialName");
     ImportValue(node, fOuterShellCFRPDensity, "OuterShellCFRPDensity");
     // Detection
     ImportValue(node, fMeanDriftVelocity, "MeanDriftVelocity");
+    ImportValue(node, fMeanClusterDensity, "MeanClusterDensity");
+    ImportValue(node, fDriftTimeTableMaxDistance, "DriftTimeTableMaxDistance");
+    ImportValue(node, fDriftTimeTable, "DriftTimeTable");
     ImportValue(node, fTimeResolutionFWHM, "TimeResolutionFWHM");
+    ImportValue(node, fDriftVelocityScale, "DriftVelocityScale");
 }
 
 auto CDC::ExportAllValue(YAML::Node& node) const -> void {
@@ -310,13 +428,19 @@ auto CDC::ExportAllValue(YAML::Node& node) const -> void {
     ExportValue(node, fInnerShellAlThickness, "InnerShellAlThickness");
     ExportValue(node, fInnerShellMylarThickness, "InnerShellMylarThickness");
     ExportValue(node, fOuterShellThickness, "OuterShellThickness");
+    ExportValue(node, fSenseLayerAlignment, "SenseLayerAlignment");
+    ExportValue(node, fCellAlignment, "CellAlignment");
     // Material
     ExportValue(node, fGasButaneFraction, "GasButaneFraction");
     ExportValue(node, fEndCapMaterialName, "EndCapMaterialName");
     ExportValue(node, fOuterShellCFRPDensity, "OuterShellCFRPDensity");
     // Detection
     ExportValue(node, fMeanDriftVelocity, "MeanDriftVelocity");
+    ExportValue(node, fMeanClusterDensity, "MeanClusterDensity");
+    ExportValue(node, fDriftTimeTableMaxDistance, "DriftTimeTableMaxDistance");
+    ExportValue(node, fDriftTimeTable, "DriftTimeTable");
     ExportValue(node, fTimeResolutionFWHM, "TimeResolutionFWHM");
+    ExportValue(node, fDriftVelocityScale, "DriftVelocityScale");
 }
 
 } // namespace MACE::Detector::Description
@@ -10,8 +10,10 @@
 
 #include "gsl/gsl"
 
+#include <algorithm>
 #include <bit>
 #include <cinttypes>
+#include <numbers>
 #include <vector>
 
 class G4Material;
@@ -51,6 +53,8 @@ public:
     auto LayerConfiguration() const -> const auto& { return *fLayerConfiguration; }
     auto GasOuterRadius() const -> auto { return LayerConfiguration().back().outerRadius + fMinWireAndRadialShellDistance; }
     auto GasOuterLength() const -> auto { return fGasInnerLength + 2 * fEndCapSlope * (GasOuterRadius() - fGasInnerRadius); }
+    auto SenseLayerAlignment() const -> const auto& { return *fSenseLayerAlignment; }
+    auto CellAlignment() const -> const auto& { return *fCellAlignment; }
     auto CellMap() const -> const auto& { return *fCellMap; }
     auto CellMapFromSenseLayerIDAndLocalCellID() const -> const auto& { return *fCellMapFromSenseLayerIDAndLocalCellID; }
 
@@ -72,6 +76,8 @@ public:
     auto InnerShellAlThickness(double val) -> void { fInnerShellAlThickness = val; }
     auto InnerShellMylarThickness(double val) -> void { fInnerShellMylarThickness = val; }
     auto OuterShellThickness(double val) -> void { fOuterShellThickness = val; }
+    auto SenseLayerAlignment(std::vector<std::vector<double>> val) -> void { fSenseLayerAlignment = std::move(val); }
+    auto CellAlignment(std::vector<std::vector<double>> val) -> void { fCellAlignment = std::move(val); }
 
     ///////////////////////////////////////////////////////////
     // Material
@@ -92,10 +98,19 @@ public:
     ///////////////////////////////////////////////////////////
 
     auto MeanDriftVelocity() const -> auto { return *fMeanDriftVelocity; }
+    auto MeanClusterDensity() const -> auto { return *fMeanClusterDensity; }
+    auto DriftTimeTableMaxDistance() const -> auto { return *fDriftTimeTableMaxDistance; }
+    auto DriftTimeTable() const -> const auto& { return *fDriftTimeTable; }
     auto TimeResolutionFWHM() const -> auto { return *fTimeResolutionFWHM; }
+    auto DriftVelocityScale() const -> const auto& { return *fDriftVelocityScale; }
+    auto XTRelation() const -> const auto& { return *fXTRelation; }
 
     auto MeanDriftVelocity(double val) -> void { fMeanDriftVelocity = val; }
+    auto MeanClusterDensity(double val) -> void { fMeanClusterDensity = val; }
+    auto DriftTimeTableMaxDistance(double val) -> void { fDriftTimeTableMaxDistance = val; }
+    auto DriftTimeTable(std::vector<std::vector<std::vector<double>>> val) -> void { fDriftTimeTable = std::move(val); }
     auto TimeResolutionFWHM(double val) -> void { fTimeResolutionFWHM = val; }
+    auto DriftVelocityScale(std::vector<double> val) -> void { fDriftVelocityScale = std::move(val); }
 
 public:
     struct SuperLayerConfiguration {
@@ -140,6 +155,32 @@ public:
         double centerAzimuth;
     };
 
+    /// @brief x-t relation of a sense layer. Drift time is tabulated on a regular grid of
+    /// drift distance [0, maxDistance] and entrance angle [-pi/2, pi/2] and bilinearly interpolated.
+    /// Drift distance beyond the table is linearly extrapolated, entrance angle is clamped.
+    /// DriftDistance is the inverse, assuming drift time increases with drift distance.
+    struct XTRelationTable {
+        double distanceStep;
+        double angleStep;
+        int nDistance;
+        int nAngle;
+        std::vector<double> time; // time[iDistance * nAngle + iAngle]
+
+        auto DriftTime(double d, double alpha) const -> double {
+            const auto u{d / distanceStep};
+            const auto i{std::min(static_cast<int>(u), nDistance - 2)};
+            const auto fu{u - i};
+            const auto v{std::clamp((alpha + std::numbers::pi / 2) / angleStep, 0., nAngle - 1.)};
+            const auto j{std::min(static_cast<int>(v), nAngle - 2)};
+            const auto fv{v - j};
+            const auto t0{&time[i * nAngle + j]};
+            const auto t1{t0 + nAngle};
+            return (1 - fu) * ((1 - fv) * t0[0] + fv * t0[1]) + fu * ((1 - fv) * t1[0] + fv * t1[1]);
+        }
+
+        auto DriftDistance(double t, double alpha) const -> double;
+    };
+
 private:
     struct HashArray2i32 {
         constexpr auto operator()(muc::array2i32 i) const -> std::size_t {
@@ -154,6 +195,7 @@ private:
     auto CalculateLayerConfiguration() const -> std::vector<SuperLayerConfiguration>;
     auto CalculateCellMap() const -> std::vector<CellInformation>;
     auto CalculateCellMapFromSenseLayerIDAndLocalCellID() const -> CellMapFromSenseLayerIDAndLocalCellIDType;
+    auto CalculateXTRelation() const -> std::vector<XTRelationTable>;
 
     auto ImportAllValue(const YAML::Node& node) -> void override;
     auto ExportAllValue(YAML::Node& node) const -> void override;
@@ -181,6 +223,10 @@ private:
     Simple<double> fInnerShellAlThickness;
     Simple<double> fInnerShellMylarThickness;
     Simple<double> fOuterShellThickness;
+    // Alignment moves the sense wires of the cell map (used by CDCSD and the fitter), not the G4 cell volumes:
+    // hits still go to the nominal cells, so an injected misalignment is valid for offsets small w.r.t. the cell size
+    Simple<std::vector<std::vector<double>>> fSenseLayerAlignment; // [sense layer][dx, dy, dphi], empty: nominal
+    Simple<std::vector<std::vector<double>>> fCellAlignment;       // [cell ID, dx, dy(, tx, ty)] of displaced cells, t: wire tilt d(x, y)/dz
 
     Cached<std::vector<SuperLayerConfiguration>> fLayerConfiguration;
     Cached<std::vector<CellInformation>> fCellMap;
@@ -199,7 +245,13 @@ private:
     ///////////////////////////////////////////////////////////
 
     Simple<double> fMeanDriftVelocity;
+    Simple<double> fMeanClusterDensity;
+    Simple<double> fDriftTimeTableMaxDistance;
+    Simple<std::vector<std::vector<std::vector<double>>>> fDriftTimeTable; // [sense layer][distance node][angle node], empty: isochronous
     Simple<double> fTimeResolutionFWHM;
+    Simple<std::vector<double>> fDriftVelocityScale; // [sense layer], empty: 1
+
+    Cached<std::vector<XTRelationTable>> fXTRelation;
 };
 
 } // namespace MACE::Detector::Description
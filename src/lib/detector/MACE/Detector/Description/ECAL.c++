@@ -1,4 +1,5 @@
 #include "MACE/Detector/Description/ECAL.h++"
+#include "MACE/Detector/Description/ECALMeshCache.h++"
 
 #include "Mustard/IO/Print.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
@@ -12,6 +13,8 @@
 #include "G4ThreeVector.hh"
 #include "G4Transform3D.hh"
 
+#include "envparse/parse.h++"
+
 #include "pmp/algorithms/differential_geometry.h"
 #include "pmp/algorithms/normals.h"
 #include "pmp/algorithms/subdivision.h"
@@ -23,6 +26,7 @@
 #include "fmt/std.h"
 
 #include <concepts>
+#include <filesystem>
 #include <queue>
 #include <ranges>
 
@@ -34,6 +38,9 @@ static_assert(std::same_as<pmp::Scalar, double>, "PMP should be compiled with PM
 
 using namespace Mustard::MathConstant;
 
+// Part of the mesh cache key: bump whenever ECALMesh or ECAL::GenerateMeshInformation changes the mesh
+constexpr auto gMeshAlgorithmVersion{1};
+
 class ECALMesh {
 public:
     ECALMesh(int n);
@@ -188,6 +195,7 @@ ECAL::ECAL() :
     // S14161
     fMPPCEnergyBin{this, {}},
     fMPPCEfficiency{this, {}},
+    fMeshCacheDirectory{this, {}},
     fMesh{this, [this] { return CalculateMeshInformation(); }},
     fModuleSelection{this, {}},
     fWaveformIntegralTime{this, 100_ns} {
@@ -270,6 +278,19 @@ ECAL::ECAL() :
 }
 
 auto ECAL::CalculateMeshInformation() const -> MeshInformation {
+    // everything the mesh depends on, in exact (hexadecimal) floating-point representation
+    const ECALMeshCache cache{fMeshCacheDirectory->empty() ? std::filesystem::path{} : envparse::parse(*fMeshCacheDirectory),
+                              fmt::format("MeshAlgorithm={} NSubdivision={} InnerRadius={:a} UpstreamWindowRadius={:a} DownstreamWindowRadius={:a}",
+                                          gMeshAlgorithmVersion, *fNSubdivision, *fInnerRadius, *fUpstreamWindowRadius, *fDownstreamWindowRadius)};
+    if (auto mesh{cache.Load()}) {
+        return *std::move(mesh);
+    }
+    auto mesh{GenerateMeshInformation()};
+    cache.Save(mesh);
+    return mesh;
+}
+
+auto ECAL::GenerateMeshInformation() const -> MeshInformation {
     auto pmpMesh{ECALMesh{fNSubdivision}.Generate()};
     MeshInformation outputMeshInfo;
     auto& [vertexList, faceList]{outputMeshInfo};
@@ -429,6 +450,7 @@ auto ECAL::ImportAllValue(const YAML::Node& node) -> void {
     ImportValue(node, fMPPCWindowThickness, "MPPCWindowThickness");
     ImportValue(node, fMPPCEnergyBin, "MPPCEnergyBin");
     ImportValue(node, fMPPCEfficiency, "MPPCEfficiency");
+    ImportValue(node, fMeshCacheDirectory, "MeshCacheDirectory");
     ImportValue(node, fModuleSelection, "ModuleSelection");
     ImportValue(node, fWaveformIntegralTime, "WaveformIntegralTime");
 }
@@ -460,6 +482,7 @@ auto ECAL::ExportAllValue(YAML::Node& node) const -> void {
     ExportValue(node, fMPPCWindowThickness, "MPPCWindowThickness");
     ExportValue(node, fMPPCEnergyBin, "MPPCEnergyBin");
     ExportValue(node, fMPPCEfficiency, "MPPCEfficiency");
+    ExportValue(node, fMeshCacheDirectory, "MeshCacheDirectory");
     ExportValue(node, fModuleSelection, "ModuleSelection");
     ExportValue(node, fWaveformIntegralTime, "WaveformIntegralTime");
 }
@@ -9,6 +9,7 @@
 #include "muc/array"
 #include "muc/hash_map"
 
+#include <string>
 #include <vector>
 #include <unordered_set>
 #include "gsl/gsl"
@@ -53,6 +54,9 @@ public:
     auto MPPCEnergyBin() const -> const auto& { return *fMPPCEnergyBin; }
     auto MPPCEfficiency() const -> const auto& { return *fMPPCEfficiency; }
 
+    /// @brief Directory of the on-disk mesh cache (see ECALMeshCache), environment variables are expanded.
+    /// Empty (default) disables the cache.
+    auto MeshCacheDirectory() const -> const auto& { return *fMeshCacheDirectory; }
     auto Mesh() const -> const auto& { return *fMesh; }
     auto NUnit() const -> auto { return Mesh().faceList.size(); }
     auto ComputeTransformToOuterSurfaceWithOffset(int cellID, double offsetInNormalDirection) const -> HepGeom::Transform3D;
@@ -92,6 +96,7 @@ public:
     auto MPPCEnergyBin(std::vector<double> val) -> void { fMPPCEnergyBin = std::move(val); }
     auto MPPCEfficiency(std::vector<double> val) -> void { fMPPCEfficiency = std::move(val); }
 
+    auto MeshCacheDirectory(std::string val) -> void { fMeshCacheDirectory = std::move(val); }
     auto ModuleSelection(std::vector<int> val) { fModuleSelection = std::move(val); }
     auto WaveformIntegralTime(double val) { fWaveformIntegralTime = val; }
 
@@ -109,6 +114,7 @@ public:
 
 private:
     auto CalculateMeshInformation() const -> MeshInformation;
+    auto GenerateMeshInformation() const -> MeshInformation;
 
     auto ImportAllValue(const YAML::Node& node) -> void override;
     auto ExportAllValue(YAML::Node& node) const -> void override;
@@ -144,6 +150,7 @@ private:
     Simple<std::vector<double>> fMPPCEnergyBin;
     Simple<std::vector<double>> fMPPCEfficiency;
     
+    Simple<std::string> fMeshCacheDirectory;
     Cached<MeshInformation> fMesh;
     Simple<std::vector<int>> fModuleSelection;
     Simple<double> fWaveformIntegralTime;
@@ -0,0 +1,194 @@
+#include "MACE/Detector/Description/ECALMeshCache.h++"
+#include "MACE/Utility/FNV1a.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "fmt/format.h"
+#include "fmt/std.h"
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace MACE::Detector::Description {
+
+namespace {
+
+constexpr std::string_view gMagic{"MACEECALMESH"};
+constexpr std::uint32_t gVersion{1};
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+auto Write(std::ostream& os, const T& value) -> void {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+auto Write(std::ostream& os, const CLHEP::Hep3Vector& value) -> void {
+    Write(os, value.x());
+    Write(os, value.y());
+    Write(os, value.z());
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+auto Read(std::istream& is, T& value) -> bool {
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+auto Read(std::istream& is, CLHEP::Hep3Vector& value) -> bool {
+    double x{};
+    double y{};
+    double z{};
+    if (not(Read(is, x) and Read(is, y) and Read(is, z))) {
+        return false;
+    }
+    value.set(x, y, z);
+    return true;
+}
+
+} // namespace
+
+ECALMeshCache::ECALMeshCache(const std::filesystem::path& directory, std::string key) :
+    fPath{},
+    fKey{std::move(key)} {
+    if (not directory.empty()) {
+        fPath = directory / fmt::format("{:016x}.ecalmesh", FNV1a::Of(fKey));
+    }
+}
+
+auto ECALMeshCache::Load() const -> std::optional<ECAL::MeshInformation> {
+    if (not Enabled()) {
+        return {};
+    }
+    std::ifstream file{fPath, std::ios::binary};
+    if (not file.is_open()) {
+        return {};
+    }
+
+    const auto Corrupted{[this] {
+        Mustard::PrintWarning(fmt::format("ECAL mesh cache {} is corrupted or outdated, regenerating", fPath));
+        return std::nullopt;
+    }};
+    std::string magic(gMagic.size(), '\0');
+    std::uint32_t version{};
+    std::uint64_t keySize{};
+    if (not(file.read(magic.data(), magic.size()) and magic == gMagic and
+            Read(file, version) and version == gVersion and Read(file, keySize))) {
+        return Corrupted();
+    }
+    std::string key(keySize, '\0');
+    if (not file.read(key.data(), key.size())) {
+        return Corrupted();
+    }
+    if (key != fKey) {
+        Mustard::PrintWarning(fmt::format("ECAL mesh cache {} belongs to another configuration (hash collision), ignoring it", fPath));
+        return {};
+    }
+
+    ECAL::MeshInformation mesh;
+    auto& [vertexList, faceList]{mesh};
+    std::uint64_t nVertex{};
+    if (not Read(file, nVertex)) {
+        return Corrupted();
+    }
+    vertexList.resize(nVertex);
+    for (auto&& vertex : vertexList) {
+        double x{};
+        double y{};
+        double z{};
+        if (not(Read(file, x) and Read(file, y) and Read(file, z))) {
+            return Corrupted();
+        }
+        vertex.set(x, y, z);
+    }
+    std::uint64_t nFace{};
+    if (not Read(file, nFace)) {
+        return Corrupted();
+    }
+    faceList.resize(nFace);
+    for (auto&& [centroid, normal, vertexIndex, typeID, neighborModuleID] : faceList) {
+        std::int32_t type{};
+        std::uint32_t nVertexIndex{};
+        if (not(Read(file, centroid) and Read(file, normal) and Read(file, type) and Read(file, nVertexIndex))) {
+            return Corrupted();
+        }
+        typeID = type;
+        vertexIndex.resize(nVertexIndex);
+        for (auto&& i : vertexIndex) {
+            std::int64_t index{};
+            if (not Read(file, index) or index < 0 or static_cast<std::uint64_t>(index) >= nVertex) {
+                return Corrupted();
+            }
+            i = index;
+        }
+        std::uint32_t nNeighbor{};
+        if (not Read(file, nNeighbor)) {
+            return Corrupted();
+        }
+        neighborModuleID.reserve(nNeighbor);
+        for (std::uint32_t i{}; i < nNeighbor; ++i) {
+            std::int32_t neighbor{};
+            if (not Read(file, neighbor)) {
+                return Corrupted();
+            }
+            neighborModuleID.insert(neighbor);
+        }
+    }
+    return mesh;
+}
+
+auto ECALMeshCache::Save(const ECAL::MeshInformation& mesh) const -> void {
+    if (not Enabled()) {
+        return;
+    }
+    std::error_code ec;
+    std::filesystem::create_directories(fPath.parent_path(), ec);
+
+    const auto temporary{fmt::format("{}.{:08x}.tmp", fPath.string(), std::random_device{}())};
+    {
+        std::ofstream file{temporary, std::ios::binary};
+        file.write(gMagic.data(), gMagic.size());
+        Write(file, gVersion);
+        Write(file, static_cast<std::uint64_t>(fKey.size()));
+        file.write(fKey.data(), fKey.size());
+
+        const auto& [vertexList, faceList]{mesh};
+        Write(file, static_cast<std::uint64_t>(vertexList.size()));
+        for (auto&& vertex : vertexList) {
+            Write(file, vertex.x());
+            Write(file, vertex.y());
+            Write(file, vertex.z());
+        }
+        Write(file, static_cast<std::uint64_t>(faceList.size()));
+        for (auto&& [centroid, normal, vertexIndex, typeID, neighborModuleID] : faceList) {
+            Write(file, centroid);
+            Write(file, normal);
+            Write(file, static_cast<std::int32_t>(typeID));
+            Write(file, static_cast<std::uint32_t>(vertexIndex.size()));
+            for (auto&& i : vertexIndex) {
+                Write(file, static_cast<std::int64_t>(i));
+            }
+            Write(file, static_cast<std::uint32_t>(neighborModuleID.size()));
+            for (auto&& neighbor : neighborModuleID) {
+                Write(file, static_cast<std::int32_t>(neighbor));
+            }
+        }
+        if (not file) {
+            // a cache that cannot be written is not an error, the mesh is simply regenerated next time
+            Mustard::PrintWarning(fmt::format("Cannot write ECAL mesh cache {}", temporary));
+            file.close();
+            std::filesystem::remove(temporary, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(temporary, fPath, ec);
+    if (ec) {
+        Mustard::PrintWarning(fmt::format("Cannot write ECAL mesh cache {} ({})", fPath, ec.message()));
+        std::filesystem::remove(temporary, ec);
+    }
+}
+
+} // namespace MACE::Detector::Description
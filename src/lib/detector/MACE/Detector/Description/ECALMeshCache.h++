@@ -0,0 +1,33 @@
+#pragma once
+
+#include "MACE/Detector/Description/ECAL.h++"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace MACE::Detector::Description {
+
+/// @brief On-disk binary store of ECAL::MeshInformation (vertices, module centroids, normals,
+/// vertex polygons, type IDs and adjacency), keyed by a text description of the mesh
+/// algorithm version and the mesh-relevant ECAL parameters.
+///
+/// Caching is opt-in: an empty directory (ECAL MeshCacheDirectory unset) disables it.
+/// Files are written atomically (temporary + rename), so concurrent writers of the same key
+/// are harmless. No MPI communication is involved.
+class ECALMeshCache {
+public:
+    ECALMeshCache(const std::filesystem::path& directory, std::string key);
+
+    auto Enabled() const -> auto { return not fPath.empty(); }
+    auto Path() const -> const auto& { return fPath; }
+
+    auto Load() const -> std::optional<ECAL::MeshInformation>;
+    auto Save(const ECAL::MeshInformation& mesh) const -> void;
+
+private:
+    std::filesystem::path fPath;
+    std::string fKey;
+};
+
+} // namespace MACE::Detector::Description
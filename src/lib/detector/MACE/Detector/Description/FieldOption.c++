@@ -1,5 +1,6 @@
 #include "MACE/Detector/Description/FieldOption.h++"
 
+#include "Mustard/IO/PrettyLog.h++"
 #include "Mustard/Utility/LiteralUnit.h++"
 
 namespace MACE::Detector::Description {
@@ -9,16 +10,36 @@ using namespace Mustard::LiteralUnit::Length;
 FieldOption::FieldOption() :
     DescriptionBase{"FieldOption"},
     fUseFast{false},
-    fFieldDataFilePath{"${MACE_DATA_DIR}/mace_field_data.root"} {}
+    fUseNodeSharedMap{false},
+    fUsePrecomputedMap{false},
+    fFieldDataFilePath{"${MACE_DATA_DIR}/mace_field_data.root"},
+    fFieldMapCacheDirectory{} {}
+
+auto FieldOption::ParsedFieldMapCacheDirectory() const -> std::filesystem::path {
+    if (fFieldMapCacheDirectory.empty()) {
+        return std::filesystem::temp_directory_path() / "mace_field_map_cache";
+    }
+    return envparse::parse(fFieldMapCacheDirectory);
+}
 
 auto FieldOption::ImportAllValue(const YAML::Node& node) -> void {
     ImportValue(node, fUseFast, "UseFast");
+    ImportValue(node, fUseNodeSharedMap, "UseNodeSharedMap");
+    ImportValue(node, fUsePrecomputedMap, "UsePrecomputedMap");
     ImportValue(node, fFieldDataFilePath, "FieldDataFilePath");
+    ImportValue(node, fFieldMapCacheDirectory, "FieldMapCacheDirectory");
+    if (fUseNodeSharedMap and fUsePrecomputedMap) {
+        Mustard::PrintWarning("FieldOption: both UseNodeSharedMap and UsePrecomputedMap are set, "
+                              "the node-shared map is used and UsePrecomputedMap is ignored");
+    }
 }
 
 auto FieldOption::ExportAllValue(YAML::Node& node) const -> void {
     ExportValue(node, fUseFast, "UseFast");
+    ExportValue(node, fUseNodeSharedMap, "UseNodeSharedMap");
+    ExportValue(node, fUsePrecomputedMap, "UsePrecomputedMap");
     ExportValue(node, fFieldDataFilePath, "FieldDataFilePath");
+    ExportValue(node, fFieldMapCacheDirectory, "FieldMapCacheDirectory");
 }
 
 } // namespace MACE::Detector::Description
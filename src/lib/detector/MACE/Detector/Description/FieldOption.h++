@@ -18,11 +18,19 @@ private:
 
 public:
     auto UseFast() const -> auto { return fUseFast; }
+    /// @brief Takes precedence over UsePrecomputedMap if both are set.
+    auto UseNodeSharedMap() const -> auto { return fUseNodeSharedMap; }
+    auto UsePrecomputedMap() const -> auto { return fUsePrecomputedMap; }
     auto FieldDataFilePath() const -> const auto& { return fFieldDataFilePath; }
     auto ParsedFieldDataFilePath() const -> std::filesystem::path { return envparse::parse(fFieldDataFilePath); }
+    auto FieldMapCacheDirectory() const -> const auto& { return fFieldMapCacheDirectory; }
+    auto ParsedFieldMapCacheDirectory() const -> std::filesystem::path;
 
     auto UseFast(bool val) -> void { fUseFast = val; }
+    auto UseNodeSharedMap(bool val) -> void { fUseNodeSharedMap = val; }
+    auto UsePrecomputedMap(bool val) -> void { fUsePrecomputedMap = val; }
     auto FieldDataFilePath(std::string val) -> void { fFieldDataFilePath = std::move(val); }
+    auto FieldMapCacheDirectory(std::string val) -> void { fFieldMapCacheDirectory = std::move(val); }
 
 private:
     auto ImportAllValue(const YAML::Node& node) -> void override;
@@ -30,7 +38,10 @@ private:
 
 private:
     bool fUseFast;
+    bool fUseNodeSharedMap;
+    bool fUsePrecomputedMap;
     std::string fFieldDataFilePath;
+    std::string fFieldMapCacheDirectory;
 };
 
 } // namespace MACE::Detector::Description
@@ -2,6 +2,8 @@
 
 #include "Mustard/Utility/LiteralUnit.h++"
 
+#include <cmath>
+
 namespace MACE::Detector::Description {
 
 using namespace Mustard::LiteralUnit::Time;
@@ -34,7 +36,20 @@ MCP::MCP() :
                      0.588965535363074, 0.5628216467042225, 0.5354017597085551, 0.5070104224441712,
                      0.4786734877754322, 0.4512368489519376, 0.42344580308379676, 0.3961653626140163,
                      0.3703620841055646, 0.3441496442080233, 0.3200344880821422, 0.29581284422432463,
-                     0.27301088914452576, 0.253825661135394} {}
+                     0.27301088914452576, 0.253825661135394},
+    // Anode readout
+    fAnodeStrip{false},
+    fAnodePitch{1_mm},
+    fChargeCloudSigma{0.4_mm},
+    fGainMean{1e6},
+    fGainResolution{0.6},
+    fChannelNoise{2e3},
+    fChannelThreshold{2e4},
+    fDeadChannel{} {}
+
+auto MCP::NAnodeChannelPerSide() const -> int {
+    return static_cast<int>(std::ceil(fDiameter / fAnodePitch));
+}
 
 auto MCP::ImportAllValue(const YAML::Node& node) -> void {
     // Geometry
@@ -46,6 +61,15 @@ auto MCP::ImportAllValue(const YAML::Node& node) -> void {
     ImportValue(node, fTimeResolutionFWHM, "TimeResolutionFWHM");
     ImportValue(node, fEfficiencyEnergy, "EfficiencyEnergy");
     ImportValue(node, fEfficiencyValue, "EfficiencyValue");
+    // Anode readout
+    ImportValue(node, fAnodeStrip, "AnodeStrip");
+    ImportValue(node, fAnodePitch, "AnodePitch");
+    ImportValue(node, fChargeCloudSigma, "ChargeCloudSigma");
+    ImportValue(node, fGainMean, "GainMean");
+    ImportValue(node, fGainResolution, "GainResolution");
+    ImportValue(node, fChannelNoise, "ChannelNoise");
+    ImportValue(node, fChannelThreshold, "ChannelThreshold");
+    ImportValue(node, fDeadChannel, "DeadChannel");
 }
 
 auto MCP::ExportAllValue(YAML::Node& node) const -> void {
@@ -58,6 +82,15 @@ auto MCP::ExportAllValue(YAML::Node& node) const -> void {
     ExportValue(node, fTimeResolutionFWHM, "TimeResolutionFWHM");
     ExportValue(node, fEfficiencyEnergy, "EfficiencyEnergy");
     ExportValue(node, fEfficiencyValue, "EfficiencyValue");
+    // Anode readout
+    ExportValue(node, fAnodeStrip, "AnodeStrip");
+    ExportValue(node, fAnodePitch, "AnodePitch");
+    ExportValue(node, fChargeCloudSigma, "ChargeCloudSigma");
+    ExportValue(node, fGainMean, "GainMean");
+    ExportValue(node, fGainResolution, "GainResolution");
+    ExportValue(node, fChannelNoise, "ChannelNoise");
+    ExportValue(node, fChannelThreshold, "ChannelThreshold");
+    ExportValue(node, fDeadChannel, "DeadChannel");
 }
 
 } // namespace MACE::Detector::Description
@@ -37,6 +37,30 @@ public:
     auto EfficiencyEnergy(std::vector<double> val) -> void { fEfficiencyEnergy = std::move(val); }
     auto EfficiencyValue(std::vector<double> val) -> void { fEfficiencyValue = std::move(val); }
 
+    // Anode readout
+
+    /// @brief Crossed x/y strips if true, square pixels otherwise. Channels tile the square
+    /// circumscribing the MCP: pixel ID is iy * NAnodeChannelPerSide + ix, x strips are
+    /// [0, n) and y strips are [n, 2n).
+    auto AnodeStrip() const -> auto { return fAnodeStrip; }
+    auto AnodePitch() const -> auto { return fAnodePitch; }
+    auto NAnodeChannelPerSide() const -> int;
+    auto ChargeCloudSigma() const -> auto { return fChargeCloudSigma; }
+    auto GainMean() const -> auto { return fGainMean; }
+    auto GainResolution() const -> auto { return fGainResolution; }
+    auto ChannelNoise() const -> auto { return fChannelNoise; }
+    auto ChannelThreshold() const -> auto { return fChannelThreshold; }
+    auto DeadChannel() const -> const auto& { return fDeadChannel; }
+
+    auto AnodeStrip(bool val) -> void { fAnodeStrip = val; }
+    auto AnodePitch(double val) -> void { fAnodePitch = val; }
+    auto ChargeCloudSigma(double val) -> void { fChargeCloudSigma = val; }
+    auto GainMean(double val) -> void { fGainMean = val; }
+    auto GainResolution(double val) -> void { fGainResolution = val; }
+    auto ChannelNoise(double val) -> void { fChannelNoise = val; }
+    auto ChannelThreshold(double val) -> void { fChannelThreshold = val; }
+    auto DeadChannel(std::vector<int> val) -> void { fDeadChannel = std::move(val); }
+
 private:
     auto ImportAllValue(const YAML::Node& node) -> void override;
     auto ExportAllValue(YAML::Node& node) const -> void override;
@@ -54,6 +78,17 @@ private:
     double fTimeResolutionFWHM;
     std::vector<double> fEfficiencyEnergy;
     std::vector<double> fEfficiencyValue;
+
+    // Anode readout
+
+    bool fAnodeStrip;
+    double fAnodePitch;
+    double fChargeCloudSigma;
+    double fGainMean;         ///< in number of electrons
+    double fGainResolution;   ///< relative RMS
+    double fChannelNoise;     ///< in number of electrons
+    double fChannelThreshold; ///< in number of electrons
+    std::vector<int> fDeadChannel;
 };
 
 } // namespace MACE::Detector::Description
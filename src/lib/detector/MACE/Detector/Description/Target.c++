@@ -137,6 +137,25 @@ Target::CylinderTarget::CylinderTarget() :
     fRadius{30_mm},
     fThickness{60_mm} {}
 
+auto Target::Contain(std::span<const double> x, std::span<const double> y, std::span<const double> z, std::span<bool> contain) const -> void {
+    Expects(x.size() == contain.size() and y.size() == contain.size() and z.size() == contain.size());
+    VisitShape([&](auto&& shape) {
+        for (gsl::index i{}; i < ssize(contain); ++i) {
+            const muc::array3d r{x[i], y[i], z[i]};
+            contain[i] = shape.Contain(r, shape.VolumeContain(r));
+        }
+    });
+}
+
+auto Target::DetectableAt(std::span<const double> x, std::span<const double> y, std::span<const double> z, std::span<bool> detectable) const -> void {
+    Expects(x.size() == detectable.size() and y.size() == detectable.size() and z.size() == detectable.size());
+    VisitShape([&](auto&& shape) {
+        for (gsl::index i{}; i < ssize(detectable); ++i) {
+            detectable[i] = shape.DetectableAt(muc::array3d{x[i], y[i], z[i]});
+        }
+    });
+}
+
 auto Target::ImportAllValue(const YAML::Node& node) -> void {
     ImportValue<std::string>(node, [this](auto&& value) { ShapeType(value); }, "ShapeType");
     {
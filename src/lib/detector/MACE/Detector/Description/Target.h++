@@ -14,6 +14,7 @@
 #include <cmath>
 #include <concepts>
 #include <numbers>
+#include <span>
 
 class G4Material;
 
@@ -255,7 +256,16 @@ public:
     /// @brief Return true if the decay position x is detectable (i.e. is not shadowed by target).
     auto DetectableAt(const Mustard::Concept::InputVector3D auto& x) const -> bool;
 
+    /// @brief Batched Contain for positions in SoA layout: contain[i] = Contain({x[i], y[i], z[i]}).
+    /// Shape dispatch is done once per batch.
+    auto Contain(std::span<const double> x, std::span<const double> y, std::span<const double> z, std::span<bool> contain) const -> void;
+    /// @brief Batched DetectableAt for positions in SoA layout: detectable[i] = DetectableAt({x[i], y[i], z[i]}).
+    auto DetectableAt(std::span<const double> x, std::span<const double> y, std::span<const double> z, std::span<bool> detectable) const -> void;
+
 private:
+    template<typename AFunctor>
+    auto VisitShape(AFunctor&& visitor) const -> void;
+
     auto ImportAllValue(const YAML::Node& node) -> void override;
     auto ExportAllValue(YAML::Node& node) const -> void override;
 
@@ -60,10 +60,13 @@ auto Target::CuboidTarget::DetectableAt(const Mustard::Concept::InputVector3D au
 }
 
 auto Target::CuboidTarget::PerforatedCuboid::DetailContain(const Mustard::Concept::InputVector3D auto& x) const -> bool {
+    // Nearest hole is found in O(1) by rounding in the oblique lattice basis, then the two neighbours that
+    // may be closer are tested analytically. There is no early return, and the comparisons are combined
+    // with non-short-circuit & and |, so that loops over many points (see Target::Contain for SoA input)
+    // need no data-dependent branch here.
     const auto [x1, y1, z1]{fCuboid->RotateBack(x)};
-    if (z1 < -fDepth or std::abs(x1) > fWidthExtent / 2 or std::abs(y1) > fHeightExtent / 2) {
-        return true;
-    }
+    const auto outside{(z1 < -fDepth) | (std::abs(x1) > fWidthExtent / 2) | (std::abs(y1) > fHeightExtent / 2)};
+
     using std::numbers::sqrt3;
     const auto p{fSpacing + fDiameter};
 
@@ -76,14 +79,13 @@ auto Target::CuboidTarget::PerforatedCuboid::DetailContain(const Mustard::Concep
     const auto deltaY{y1 - y0};
     const auto radius{fDiameter / 2};
     const auto deltaXY2MinusR2{muc::pow(deltaX, 2) + (deltaY + radius) * (deltaY - radius)};
-
-    if (deltaXY2MinusR2 <= 0) {
-        return false;
-    }
     const auto deltaXY2MinusR2PlusP2{deltaXY2MinusR2 + muc::pow(p, 2)};
     const auto pDeltaX{p * deltaX};
-    return deltaXY2MinusR2PlusP2 > std::abs(2 * pDeltaX) and
-           deltaXY2MinusR2PlusP2 > std::abs(pDeltaX + sqrt3 * p * deltaY);
+
+    return outside |
+           ((deltaXY2MinusR2 > 0) &
+            (deltaXY2MinusR2PlusP2 > std::abs(2 * pDeltaX)) &
+            (deltaXY2MinusR2PlusP2 > std::abs(pDeltaX + sqrt3 * p * deltaY)));
 }
 
 auto Target::CuboidTarget::RotateBack(const Mustard::Concept::InputVector3D auto& x) const -> muc::array3d {
@@ -132,9 +134,9 @@ auto Target::MultiLayerTarget::DetectableAt(const Mustard::Concept::InputVector3
 }
 
 auto Target::MultiLayerTarget::PerforatedMultiLayer::DetailContain(const Mustard::Concept::InputVector3D auto& x) const -> bool {
-    if (std::abs(x[2]) > fHalfExtentZ or std::abs(x[1]) > fHalfExtentY) {
-        return true;
-    }
+    // See PerforatedCuboid::DetailContain
+    const auto outside{(std::abs(x[2]) > fHalfExtentZ) | (std::abs(x[1]) > fHalfExtentY)};
+
     using std::numbers::sqrt3;
     const auto p{Pitch()};
 
@@ -146,14 +148,13 @@ auto Target::MultiLayerTarget::PerforatedMultiLayer::DetailContain(const Mustard
     const auto deltaZ{x[2] - z0};
     const auto deltaY{x[1] - y0};
     const auto deltaZY2MinusR2{muc::pow(deltaZ, 2) + (deltaY + fRadius) * (deltaY - fRadius)};
-
-    if (deltaZY2MinusR2 <= 0) {
-        return false;
-    }
     const auto deltaZY2MinusR2PlusP2{deltaZY2MinusR2 + muc::pow(p, 2)};
     const auto pDeltaZ{p * deltaZ};
-    return deltaZY2MinusR2PlusP2 > std::abs(2 * pDeltaZ) and
-           deltaZY2MinusR2PlusP2 > std::abs(pDeltaZ + sqrt3 * p * deltaY);
+
+    return outside |
+           ((deltaZY2MinusR2 > 0) &
+            (deltaZY2MinusR2PlusP2 > std::abs(2 * pDeltaZ)) &
+            (deltaZY2MinusR2PlusP2 > std::abs(pDeltaZ + sqrt3 * p * deltaY)));
 }
 
 auto Target::CylinderTarget::VolumeContain(const Mustard::Concept::InputVector3D auto& x) const -> bool {
@@ -190,6 +191,22 @@ auto Target::Contain(const Mustard::Concept::InputVector3D auto& x, bool insideV
     muc::unreachable();
 }
 
+template<typename AFunctor>
+auto Target::VisitShape(AFunctor&& visitor) const -> void {
+    switch (fShapeType) {
+    case TargetShapeType::Cuboid:
+        visitor(fCuboid);
+        return;
+    case TargetShapeType::MultiLayer:
+        visitor(fMultiLayer);
+        return;
+    case TargetShapeType::Cylinder:
+        visitor(fCylinder);
+        return;
+    }
+    muc::unreachable();
+}
+
 auto Target::DetectableAt(const Mustard::Concept::InputVector3D auto& x) const -> bool {
     switch (fShapeType) {
     case TargetShapeType::Cuboid:
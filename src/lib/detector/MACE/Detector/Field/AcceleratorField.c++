@@ -9,7 +9,14 @@ AcceleratorField::AcceleratorField() : // clang-format off
     ElectromagneticFieldBase<AcceleratorField>{}, // clang-format on
     fField{} {
     const auto& fieldOption{Detector::Description::FieldOption::Instance()};
-    if (not fieldOption.UseFast()) {
+    if (fieldOption.UseFast()) {
+        return;
+    }
+    if (fieldOption.UseNodeSharedMap()) {
+        fField = SharedFieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "AcceleratorField"};
+    } else if (fieldOption.UsePrecomputedMap()) {
+        fField = PrecomputedFieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "AcceleratorField"};
+    } else {
         fField = FieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "AcceleratorField"};
     }
 }
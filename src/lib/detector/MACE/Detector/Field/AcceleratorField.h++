@@ -1,10 +1,14 @@
 #pragma once
 
+#include "MACE/Detector/Field/NodeSharedFieldMap.h++"
+#include "MACE/Detector/Field/PrecomputedFieldMap.h++"
+
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
 #include "Mustard/Detector/Field/ElectromagneticFieldMap.h++"
 #include "Mustard/Detector/Field/UniformElectromagneticField.h++"
 
+#include <utility>
 #include <variant>
 
 namespace MACE::Detector::Field {
@@ -19,6 +23,10 @@ public:
     template<Mustard::Concept::NumericVector3D T>
     auto BE(T x) const -> F<T> { return std::visit([&x](auto&& f) { return f.BE(x); }, fField); } // clang-format on
 
+    /// @brief Visit the alternative (fast field or field map) chosen at construction.
+    template<typename V>
+    auto VisitField(V&& visitor) const -> decltype(auto) { return std::visit(std::forward<V>(visitor), fField); }
+
 private:
     class FastField : public Mustard::Detector::Field::ElectromagneticFieldBase<FastField> {
     public:
@@ -39,9 +47,11 @@ private:
     };
 
     using FieldMap = Mustard::Detector::Field::ElectromagneticFieldMapSymmetryY<"NoCache">;
+    using SharedFieldMap = NodeSharedElectromagneticFieldMapSymmetryY;
+    using PrecomputedFieldMap = PrecomputedElectromagneticFieldMapSymmetryY;
 
 private:
-    std::variant<FastField, FieldMap> fField;
+    std::variant<FastField, FieldMap, SharedFieldMap, PrecomputedFieldMap> fField;
 };
 
 } // namespace MACE::Detector::Field
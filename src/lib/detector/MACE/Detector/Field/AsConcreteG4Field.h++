@@ -0,0 +1,65 @@
+#pragma once
+
+#include "G4ElectroMagneticField.hh"
+#include "G4MagneticField.hh"
+#include "G4ThreeVector.hh"
+
+#include <concepts>
+#include <memory>
+#include <type_traits>
+
+namespace MACE::Detector::Field {
+
+/// @brief Geant4 field for one concrete alternative of a MACE field (e.g. the fast field or the
+/// field map of MMSField). The alternative is resolved once at construction, so GetFieldValue
+/// does no variant dispatch. Being final, the call can be devirtualized in templated equations
+/// (G4TMagFieldEquation, magnetic fields only); electromagnetic fields go through
+/// G4EqMagElectricField, which still calls GetFieldValue virtually. No step-time gain is
+/// claimed: none has been measured.
+template<typename AField, typename AAlternative>
+class AsConcreteG4Field final : public std::conditional_t<requires(const AAlternative& f, G4ThreeVector x) { f.E(x); },
+                                                          G4ElectroMagneticField, G4MagneticField> {
+public:
+    static constexpr auto fgElectromagnetic{requires(const AAlternative& f, G4ThreeVector x) { f.E(x); }};
+
+public:
+    AsConcreteG4Field(std::shared_ptr<const AField> owner, const AAlternative& field) :
+        fOwner{std::move(owner)},
+        fField{&field} {}
+
+    auto GetFieldValue(const G4double x[4], G4double* f) const -> void override {
+        if constexpr (fgElectromagnetic) {
+            const auto [b, e]{fField->BE(G4ThreeVector{x[0], x[1], x[2]})};
+            f[0] = b.x();
+            f[1] = b.y();
+            f[2] = b.z();
+            f[3] = e.x();
+            f[4] = e.y();
+            f[5] = e.z();
+        } else {
+            const auto b{fField->B(G4ThreeVector{x[0], x[1], x[2]})};
+            f[0] = b.x();
+            f[1] = b.y();
+            f[2] = b.z();
+        }
+    }
+
+    auto DoesFieldChangeEnergy() const -> G4bool override { return fgElectromagnetic; }
+
+private:
+    std::shared_ptr<const AField> fOwner;
+    const AAlternative* fField;
+};
+
+/// @brief Construct AField, then call registrar(new AsConcreteG4Field<AField, A>{...}) with the
+/// alternative A chosen by AField's constructor (see VisitField of MACE fields). The registrar
+/// is instantiated per alternative, so equations and steppers it builds are concretely typed.
+template<typename AField, typename ARegistrar>
+auto VisitAsG4Field(ARegistrar&& registrar) -> void {
+    const auto owner{std::make_shared<const AField>()};
+    owner->VisitField([&]<typename A>(const A& alternative) {
+        registrar(new AsConcreteG4Field<AField, A>{owner, alternative});
+    });
+}
+
+} // namespace MACE::Detector::Field
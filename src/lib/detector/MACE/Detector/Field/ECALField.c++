@@ -11,6 +11,8 @@ ECALField::ECALField() : // clang-format off
     const auto& ecalField{Detector::Description::ECALField::Instance()};
     if (fieldOption.UseFast()) {
         fField = FastField{0, 0, ecalField.FastField()};
+    } else if (fieldOption.UseNodeSharedMap()) {
+        fField = SharedFieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "EMCField"};
     } else {
         fField = FieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "EMCField"};
     }
@@ -0,0 +1,19 @@
+#include "MACE/Detector/Field/FieldGridView.h++"
+
+namespace MACE::Detector::Field {
+
+FieldGridView::FieldGridView() :
+    fNComponent{},
+    fN{},
+    fX0{},
+    fDX{},
+    fData{} {}
+
+FieldGridView::FieldGridView(const double* buffer, int nComponent) :
+    fNComponent{nComponent},
+    fN{std::lround(buffer[0]), std::lround(buffer[1]), std::lround(buffer[2])},
+    fX0{buffer[3], buffer[4], buffer[5]},
+    fDX{buffer[6], buffer[7], buffer[8]},
+    fData{buffer + NHeader()} {}
+
+} // namespace MACE::Detector::Field
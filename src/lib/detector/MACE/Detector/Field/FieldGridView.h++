@@ -0,0 +1,43 @@
+#pragma once
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace MACE::Detector::Field {
+
+/// @brief Non-owning view of a regular field grid with y-mirror symmetry (x, y >= 0, z).
+///
+/// The viewed buffer is laid out as [nx, ny, nz, x0, y0, z0, dx, dy, dz] followed by
+/// the field values ordered as [ix][iy][iz][component] (see LoadFieldGrid).
+class FieldGridView {
+public:
+    FieldGridView();
+    FieldGridView(const double* buffer, int nComponent);
+
+    auto NComponent() const -> auto { return fNComponent; }
+    auto NGrid() const -> const auto& { return fN; }
+    auto X0() const -> const auto& { return fX0; }
+    auto DX() const -> const auto& { return fDX; }
+    auto NPoint() const -> auto { return fN[0] * fN[1] * fN[2]; }
+
+    /// @brief Trilinear interpolation at (x, y, z). Components with index % 3 == 1 (i.e. By, Ey)
+    /// change sign under y -> -y, the others are even. Points outside the grid are clamped to the boundary.
+    template<int N>
+    auto Interpolate(double x, double y, double z) const -> std::array<double, N>;
+
+    static constexpr auto NHeader() -> gsl::index { return 9; }
+
+private:
+    int fNComponent;
+    std::array<gsl::index, 3> fN;
+    std::array<double, 3> fX0;
+    std::array<double, 3> fDX;
+    const double* fData;
+};
+
+} // namespace MACE::Detector::Field
+
+#include "MACE/Detector/Field/FieldGridView.inl"
@@ -0,0 +1,42 @@
+namespace MACE::Detector::Field {
+
+template<int N>
+auto FieldGridView::Interpolate(double x, double y, double z) const -> std::array<double, N> {
+    Expects(N == fNComponent);
+
+    const auto mirrored{y < 0};
+    const std::array<double, 3> point{x, std::abs(y), z};
+    std::array<gsl::index, 3> i;
+    std::array<double, 3> t;
+    for (gsl::index k{}; k < 3; ++k) {
+        const auto u{std::clamp((point[k] - fX0[k]) / fDX[k], 0., static_cast<double>(fN[k] - 1))};
+        i[k] = std::min(static_cast<gsl::index>(u), fN[k] - 2);
+        t[k] = u - i[k];
+    }
+
+    const auto Value{[this](gsl::index ix, gsl::index iy, gsl::index iz) {
+        return fData + ((ix * fN[1] + iy) * fN[2] + iz) * N;
+    }};
+    std::array<double, N> f{};
+    for (auto dx{0}; dx < 2; ++dx) {
+        const auto wx{dx ? t[0] : 1 - t[0]};
+        for (auto dy{0}; dy < 2; ++dy) {
+            const auto wxy{wx * (dy ? t[1] : 1 - t[1])};
+            for (auto dz{0}; dz < 2; ++dz) {
+                const auto w{wxy * (dz ? t[2] : 1 - t[2])};
+                const auto v{Value(i[0] + dx, i[1] + dy, i[2] + dz)};
+                for (gsl::index c{}; c < N; ++c) {
+                    f[c] += w * v[c];
+                }
+            }
+        }
+    }
+    if (mirrored) {
+        for (gsl::index c{1}; c < N; c += 3) {
+            f[c] = -f[c];
+        }
+    }
+    return f;
+}
+
+} // namespace MACE::Detector::Field
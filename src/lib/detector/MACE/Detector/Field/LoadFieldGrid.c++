@@ -0,0 +1,164 @@
+#include "MACE/Detector/Description/FieldOption.h++"
+#include "MACE/Detector/Field/FieldGridView.h++"
+#include "MACE/Detector/Field/LoadFieldGrid.h++"
+#include "MACE/Utility/FNV1a.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "ROOT/RDataFrame.hxx"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+#include "fmt/std.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace MACE::Detector::Field {
+
+namespace {
+
+constexpr std::uint64_t gCacheMagic{0x3176'4746'4543'414d}; // "MACEFGv1"
+
+// identifies the map file by its absolute path, size and modification time (a stat, not a read of the file)
+auto CacheKey(const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName) -> std::uint64_t {
+    std::error_code ec;
+    const auto path{std::filesystem::absolute(fileName, ec)};
+    const auto size{std::filesystem::file_size(path, ec)};
+    if (ec) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Cannot access field map file '{}' ({})", fileName, ec.message()));
+    }
+    const auto modified{std::filesystem::last_write_time(path, ec).time_since_epoch().count()};
+    FNV1a fnv;
+    // '\0' separates the fields
+    for (auto&& field : {path.generic_string(), std::to_string(size), std::to_string(modified), mapName}) {
+        fnv.Update({field.c_str(), field.size() + 1});
+    }
+    for (auto&& name : componentName) {
+        fnv.Update({name.c_str(), name.size() + 1});
+    }
+    return fnv.Hash();
+}
+
+auto ReadCache(const std::filesystem::path& path, std::uint64_t key) -> std::vector<double> {
+    std::ifstream file{path, std::ios::binary};
+    if (not file.is_open()) {
+        return {};
+    }
+    std::array<std::uint64_t, 3> header{};
+    if (not file.read(reinterpret_cast<char*>(header.data()), sizeof(header))) {
+        return {};
+    }
+    const auto [magic, cachedKey, size]{header};
+    if (magic != gCacheMagic or cachedKey != key) {
+        return {};
+    }
+    std::vector<double> buffer(size);
+    if (not file.read(reinterpret_cast<char*>(buffer.data()), size * sizeof(double))) {
+        return {};
+    }
+    return buffer;
+}
+
+auto WriteCache(const std::filesystem::path& path, std::uint64_t key, const std::vector<double>& buffer) -> void {
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    // write to a unique temporary then rename, so that concurrent writers never expose a partial cache
+    const auto temporary{fmt::format("{}.{:08x}.tmp", path.generic_string(), std::random_device{}())};
+    {
+        std::ofstream file{temporary, std::ios::binary};
+        const std::array<std::uint64_t, 3> header{gCacheMagic, key, buffer.size()};
+        file.write(reinterpret_cast<const char*>(header.data()), sizeof(header));
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(double));
+        if (not file) {
+            Mustard::PrintWarning(fmt::format("Cannot write field map cache {}, continue without caching", path));
+            std::filesystem::remove(temporary, ec);
+            return;
+        }
+    }
+    std::filesystem::rename(temporary, path, ec);
+    if (ec) {
+        std::filesystem::remove(temporary, ec);
+    }
+}
+
+auto ReadTree(const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName) -> std::vector<double> {
+    ROOT::RDataFrame data{mapName, fileName};
+    std::array coordinateResult{data.Take<double>("x"), data.Take<double>("y"), data.Take<double>("z")};
+    std::vector<ROOT::RDF::RResultPtr<std::vector<double>>> componentResult;
+    componentResult.reserve(componentName.size());
+    for (auto&& name : componentName) {
+        componentResult.emplace_back(data.Take<double>(name));
+    }
+
+    std::array<const std::vector<double>*, 3> coordinate;
+    std::array<gsl::index, 3> n;
+    std::array<double, 3> x0;
+    std::array<double, 3> dx;
+    for (gsl::index k{}; k < 3; ++k) {
+        coordinate[k] = coordinateResult[k].GetPtr();
+        auto axis{*coordinate[k]};
+        std::ranges::sort(axis);
+        const auto tolerance{1e-6 * (axis.back() - axis.front())};
+        const auto [first, last]{std::ranges::unique(axis, [&](auto a, auto b) { return b - a <= tolerance; })};
+        axis.erase(first, last);
+        if (axis.size() < 2) {
+            Mustard::Throw<std::runtime_error>(fmt::format("Field map '{}' in '{}' has less than 2 grid points along axis {}", mapName, fileName, k));
+        }
+        n[k] = ssize(axis);
+        x0[k] = axis.front();
+        dx[k] = (axis.back() - axis.front()) / (n[k] - 1);
+    }
+    if (x0[1] < 0) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Field map '{}' in '{}' is not y-symmetric (y_min = {} < 0)", mapName, fileName, x0[1]));
+    }
+    const auto nEntry{ssize(*coordinate[0])};
+    if (nEntry != n[0] * n[1] * n[2]) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Field map '{}' in '{}' is not a regular grid ({} entries, {}x{}x{} grid)",
+                                                       mapName, fileName, nEntry, n[0], n[1], n[2]));
+    }
+
+    const auto nComponent{ssize(componentName)};
+    std::vector<double> buffer(FieldGridView::NHeader() + nEntry * nComponent);
+    std::ranges::copy(n, buffer.begin());
+    std::ranges::copy(x0, buffer.begin() + 3);
+    std::ranges::copy(dx, buffer.begin() + 6);
+    for (gsl::index i{}; i < nEntry; ++i) {
+        std::array<gsl::index, 3> index;
+        for (gsl::index k{}; k < 3; ++k) {
+            index[k] = std::lround(((*coordinate[k])[i] - x0[k]) / dx[k]);
+        }
+        const auto offset{FieldGridView::NHeader() + ((index[0] * n[1] + index[1]) * n[2] + index[2]) * nComponent};
+        for (gsl::index c{}; c < nComponent; ++c) {
+            buffer[offset + c] = (*componentResult[c])[i];
+        }
+    }
+    return buffer;
+}
+
+} // namespace
+
+auto LoadFieldGrid(const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName) -> std::vector<double> {
+    const auto key{CacheKey(fileName, mapName, componentName)};
+    const auto cachePath{Description::FieldOption::Instance().ParsedFieldMapCacheDirectory() /
+                         fmt::format("{}.{}.{:016x}.bin", std::filesystem::path{fileName}.stem().generic_string(), mapName, key)};
+    if (auto buffer{ReadCache(cachePath, key)};
+        ssize(buffer) > FieldGridView::NHeader() and
+        ssize(buffer) == FieldGridView::NHeader() + FieldGridView{buffer.data(), static_cast<int>(componentName.size())}.NPoint() * ssize(componentName)) {
+        return buffer;
+    }
+    auto buffer{ReadTree(fileName, mapName, componentName)};
+    WriteCache(cachePath, key, buffer);
+    return buffer;
+}
+
+} // namespace MACE::Detector::Field
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace MACE::Detector::Field {
+
+/// @brief Read a y-symmetric field map (a tree with columns x, y, z followed by the field
+/// components) into a flat buffer suitable for FieldGridView.
+///
+/// The resampled grid is cached in binary form under FieldOption::ParsedFieldMapCacheDirectory(),
+/// keyed by the hash of the absolute path, size and modification time of the map file, the map
+/// name and the components. A cache hit skips the tree reading entirely; a stale or corrupted
+/// cache is silently rebuilt.
+auto LoadFieldGrid(const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName) -> std::vector<double>;
+
+} // namespace MACE::Detector::Field
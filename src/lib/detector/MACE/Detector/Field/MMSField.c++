@@ -11,6 +11,8 @@ MMSField::MMSField() :
     const auto& ecalField{Detector::Description::MMSField::Instance()};
     if (fieldOption.UseFast()) {
         fField = FastField{0, 0, ecalField.FastField()};
+    } else if (fieldOption.UseNodeSharedMap()) {
+        fField = SharedFieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "MMSField"};
     } else {
         fField = FieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "MMSField"};
     }
@@ -0,0 +1,97 @@
+#include "MACE/Detector/Field/LoadFieldGrid.h++"
+#include "MACE/Detector/Field/NodeSharedFieldGrid.h++"
+
+#include "Mustard/Env/BasicEnv.h++"
+#include "Mustard/Env/MPIEnv.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "fmt/format.h"
+#include "fmt/ranges.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+namespace MACE::Detector::Field {
+
+std::mutex NodeSharedFieldGrid::fgRegistryMutex{};
+std::atomic<std::size_t> NodeSharedFieldGrid::fgTotalSizeInByte{};
+
+NodeSharedFieldGrid::NodeSharedFieldGrid(PassKey, const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName) :
+    fGrid{},
+    fSizeInByte{},
+    fWindow{MPI_WIN_NULL} {
+    ReadAndShare(fileName, mapName, componentName);
+    fgTotalSizeInByte += fSizeInByte;
+    ReportMemoryUsage(mapName);
+}
+
+NodeSharedFieldGrid::~NodeSharedFieldGrid() {
+    fgTotalSizeInByte -= fSizeInByte;
+    if (fWindow == MPI_WIN_NULL) {
+        return;
+    }
+    if (int finalized{}; MPI_Finalized(&finalized) == MPI_SUCCESS and not finalized) {
+        MPI_Win_free(&fWindow);
+    }
+}
+
+auto NodeSharedFieldGrid::Acquire(const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName)
+    -> std::shared_ptr<const NodeSharedFieldGrid> {
+    static std::map<std::string, std::weak_ptr<const NodeSharedFieldGrid>> registry;
+    // held while constructing, so concurrent callers of the same map share one window
+    const std::scoped_lock lock{fgRegistryMutex};
+    auto& entry{registry[fmt::format("{}\n{}\n{}", fileName, mapName, fmt::join(componentName, ","))]};
+    if (auto grid{entry.lock()}) {
+        return grid;
+    }
+    auto grid{std::make_shared<const NodeSharedFieldGrid>(PassKey{}, fileName, mapName, componentName)};
+    entry = grid;
+    return grid;
+}
+
+auto NodeSharedFieldGrid::ReadAndShare(const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName) -> void {
+    const auto& intraNodeComm{Mustard::Env::MPIEnv::Instance().IntraNodeComm()};
+
+    // node master: load the grid into a flat buffer
+    std::vector<double> buffer;
+    if (intraNodeComm.rank() == 0) {
+        buffer = LoadFieldGrid(fileName, mapName, componentName);
+    }
+
+    // allocate window on node master, copy, and publish to the node
+    double* base{};
+    MPI_Win_allocate_shared(static_cast<MPI_Aint>(buffer.size() * sizeof(double)), sizeof(double), MPI_INFO_NULL,
+                            intraNodeComm.native_handle(), &base, &fWindow);
+    MPI_Win_fence(0, fWindow);
+    if (intraNodeComm.rank() == 0) {
+        std::ranges::copy(buffer, base);
+    }
+    MPI_Win_fence(0, fWindow);
+
+    // every rank: map the node master's segment read-only
+    MPI_Aint size{};
+    int dispUnit{};
+    double* shared{};
+    MPI_Win_shared_query(fWindow, 0, &size, &dispUnit, &shared);
+    fGrid = FieldGridView{shared, static_cast<int>(componentName.size())};
+    fSizeInByte = size;
+}
+
+auto NodeSharedFieldGrid::ReportMemoryUsage(const std::string& mapName) const -> void {
+    if (not Mustard::Env::VerboseLevelReach<'I'>()) {
+        return;
+    }
+    constexpr auto mib{1024. * 1024.};
+    const auto nRank{Mustard::Env::MPIEnv::Instance().IntraNodeComm().size()};
+    Mustard::MasterPrintLn("Field map '{}' ({}x{}x{} points, {} components) shared by {} rank(s) on node: "
+                           "{:.2f} MiB per node instead of {:.2f} MiB ({:.2f} MiB saved). "
+                           "Node-shared field maps in total: {:.2f} MiB",
+                           mapName, fGrid.NGrid()[0], fGrid.NGrid()[1], fGrid.NGrid()[2], fGrid.NComponent(), nRank,
+                           fSizeInByte / mib, nRank * fSizeInByte / mib, (nRank - 1) * fSizeInByte / mib,
+                           fgTotalSizeInByte.load() / mib);
+}
+
+} // namespace MACE::Detector::Field
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "MACE/Detector/Field/FieldGridView.h++"
+
+#include "mpi.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace MACE::Detector::Field {
+
+/// @brief A regular field grid with y-mirror symmetry (x, y >= 0, z), stored once per node
+/// in an MPI-3 shared-memory window.
+///
+/// The node master loads the field grid (see LoadFieldGrid), copies it into the window,
+/// and every rank on the node maps the window read-only.
+/// Grids are reference counted by (file, map, components), so a map acquired more than once
+/// (e.g. by both Geant4 and GenFit) reuses the same window.
+///
+/// @note Acquire is collective over the intra-node communicator. The registry and the size
+/// counter are guarded and thread-safe, but window allocation and release are MPI collectives:
+/// every rank on the node must acquire and release the same maps in the same order.
+class NodeSharedFieldGrid {
+private:
+    struct PassKey {};
+
+public:
+    NodeSharedFieldGrid(PassKey, const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName);
+    ~NodeSharedFieldGrid();
+
+    NodeSharedFieldGrid(const NodeSharedFieldGrid&) = delete;
+    auto operator=(const NodeSharedFieldGrid&) -> NodeSharedFieldGrid& = delete;
+
+    static auto Acquire(const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName)
+        -> std::shared_ptr<const NodeSharedFieldGrid>;
+
+    auto Grid() const -> const auto& { return fGrid; }
+    auto SizeInByte() const -> auto { return fSizeInByte; }
+
+    template<int N>
+    auto Interpolate(double x, double y, double z) const -> std::array<double, N> { return fGrid.Interpolate<N>(x, y, z); }
+
+    /// @brief Total bytes of all field grids currently shared on this node.
+    static auto TotalSizeInByte() -> std::size_t { return fgTotalSizeInByte.load(); }
+
+private:
+    auto ReadAndShare(const std::string& fileName, const std::string& mapName, const std::vector<std::string>& componentName) -> void;
+    auto ReportMemoryUsage(const std::string& mapName) const -> void;
+
+private:
+    FieldGridView fGrid;
+    std::size_t fSizeInByte;
+
+    MPI_Win fWindow;
+
+    static std::mutex fgRegistryMutex;
+    static std::atomic<std::size_t> fgTotalSizeInByte;
+};
+
+} // namespace MACE::Detector::Field
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "MACE/Detector/Field/NodeSharedFieldGrid.h++"
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
+#include "Mustard/Detector/Field/MagneticFieldBase.h++"
+#include "Mustard/Utility/VectorCast.h++"
+
+#include <array>
+#include <memory>
+#include <string>
+
+namespace MACE::Detector::Field {
+
+/// @brief Magnetic field map with y-mirror symmetry, loaded once per node (see NodeSharedFieldGrid).
+class NodeSharedMagneticFieldMapSymmetryY : public Mustard::Detector::Field::MagneticFieldBase<NodeSharedMagneticFieldMapSymmetryY> {
+public:
+    NodeSharedMagneticFieldMapSymmetryY(const std::string& fileName, const std::string& mapName) :
+        MagneticFieldBase<NodeSharedMagneticFieldMapSymmetryY>{},
+        fGrid{NodeSharedFieldGrid::Acquire(fileName, mapName, {"Bx", "By", "Bz"})} {}
+
+    template<Mustard::Concept::NumericVector3D T>
+    auto B(T x) const -> T { return Mustard::VectorCast<T>(fGrid->Interpolate<3>(x[0], x[1], x[2])); }
+
+private:
+    std::shared_ptr<const NodeSharedFieldGrid> fGrid;
+};
+
+/// @brief Electromagnetic field map with y-mirror symmetry, loaded once per node (see NodeSharedFieldGrid).
+class NodeSharedElectromagneticFieldMapSymmetryY : public Mustard::Detector::Field::ElectromagneticFieldBase<NodeSharedElectromagneticFieldMapSymmetryY> {
+public:
+    NodeSharedElectromagneticFieldMapSymmetryY(const std::string& fileName, const std::string& mapName) :
+        ElectromagneticFieldBase<NodeSharedElectromagneticFieldMapSymmetryY>{},
+        fGrid{NodeSharedFieldGrid::Acquire(fileName, mapName, {"Bx", "By", "Bz", "Ex", "Ey", "Ez"})} {}
+
+    template<Mustard::Concept::NumericVector3D T>
+    auto B(T x) const -> T {
+        const auto [bx, by, bz, _1, _2, _3]{fGrid->Interpolate<6>(x[0], x[1], x[2])};
+        return Mustard::VectorCast<T>(std::array{bx, by, bz});
+    }
+    template<Mustard::Concept::NumericVector3D T>
+    auto E(T x) const -> T {
+        const auto [_1, _2, _3, ex, ey, ez]{fGrid->Interpolate<6>(x[0], x[1], x[2])};
+        return Mustard::VectorCast<T>(std::array{ex, ey, ez});
+    }
+    template<Mustard::Concept::NumericVector3D T>
+    auto BE(T x) const -> F<T> {
+        const auto [bx, by, bz, ex, ey, ez]{fGrid->Interpolate<6>(x[0], x[1], x[2])};
+        return {Mustard::VectorCast<T>(std::array{bx, by, bz}), Mustard::VectorCast<T>(std::array{ex, ey, ez})};
+    }
+
+private:
+    std::shared_ptr<const NodeSharedFieldGrid> fGrid;
+};
+
+} // namespace MACE::Detector::Field
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "MACE/Detector/Field/FieldGridView.h++"
+#include "MACE/Detector/Field/LoadFieldGrid.h++"
+
+#include "Mustard/Concept/NumericVector.h++"
+#include "Mustard/Detector/Field/ElectromagneticFieldBase.h++"
+#include "Mustard/Utility/VectorCast.h++"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MACE::Detector::Field {
+
+/// @brief Electromagnetic field map with y-mirror symmetry, resampled once onto a regular grid
+/// (with on-disk cache, see LoadFieldGrid) and evaluated by trilinear interpolation.
+/// Copies share the same grid.
+class PrecomputedElectromagneticFieldMapSymmetryY : public Mustard::Detector::Field::ElectromagneticFieldBase<PrecomputedElectromagneticFieldMapSymmetryY> {
+public:
+    PrecomputedElectromagneticFieldMapSymmetryY(const std::string& fileName, const std::string& mapName) :
+        ElectromagneticFieldBase<PrecomputedElectromagneticFieldMapSymmetryY>{},
+        fBuffer{std::make_shared<const std::vector<double>>(LoadFieldGrid(fileName, mapName, {"Bx", "By", "Bz", "Ex", "Ey", "Ez"}))},
+        fGrid{fBuffer->data(), 6} {}
+
+    auto Grid() const -> const auto& { return fGrid; }
+
+    template<Mustard::Concept::NumericVector3D T>
+    auto B(T x) const -> T {
+        const auto [bx, by, bz, _1, _2, _3]{fGrid.Interpolate<6>(x[0], x[1], x[2])};
+        return Mustard::VectorCast<T>(std::array{bx, by, bz});
+    }
+    template<Mustard::Concept::NumericVector3D T>
+    auto E(T x) const -> T {
+        const auto [_1, _2, _3, ex, ey, ez]{fGrid.Interpolate<6>(x[0], x[1], x[2])};
+        return Mustard::VectorCast<T>(std::array{ex, ey, ez});
+    }
+    template<Mustard::Concept::NumericVector3D T>
+    auto BE(T x) const -> F<T> {
+        const auto [bx, by, bz, ex, ey, ez]{fGrid.Interpolate<6>(x[0], x[1], x[2])};
+        return {Mustard::VectorCast<T>(std::array{bx, by, bz}), Mustard::VectorCast<T>(std::array{ex, ey, ez})};
+    }
+
+private:
+    std::shared_ptr<const std::vector<double>> fBuffer;
+    FieldGridView fGrid;
+};
+
+} // namespace MACE::Detector::Field
@@ -11,6 +11,8 @@ SolenoidFieldS2::SolenoidFieldS2() : // clang-format off
     const auto& solenoid{Detector::Description::Solenoid::Instance()};
     if (fieldOption.UseFast()) {
         fField = FastField{solenoid.FastField(), 0, 0};
+    } else if (fieldOption.UseNodeSharedMap()) {
+        fField = SharedFieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "SolenoidFieldS2"};
     } else {
         fField = FieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "SolenoidFieldS2"};
     }
@@ -11,6 +11,8 @@ SolenoidFieldS3::SolenoidFieldS3() : // clang-format off
     const auto& solenoid{Detector::Description::Solenoid::Instance()};
     if (fieldOption.UseFast()) {
         fField = FastField{0, 0, solenoid.FastField()};
+    } else if (fieldOption.UseNodeSharedMap()) {
+        fField = SharedFieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "SolenoidFieldS3"};
     } else {
         fField = FieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "SolenoidFieldS3"};
     }
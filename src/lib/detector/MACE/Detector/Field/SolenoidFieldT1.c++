@@ -11,6 +11,8 @@ SolenoidFieldT1::SolenoidFieldT1() : // clang-format off
     const auto& solenoid{Detector::Description::Solenoid::Instance()};
     if (fieldOption.UseFast()) { // clang-format off
         fField = FastField{solenoid.FastField(), solenoid.T1Radius(), solenoid.T1Center(), {0, 0, 1}}; // clang-format on
+    } else if (fieldOption.UseNodeSharedMap()) {
+        fField = SharedFieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "SolenoidFieldT1"};
     } else {
         fField = FieldMap{fieldOption.ParsedFieldDataFilePath().generic_string(), "SolenoidFieldT1"};
     }
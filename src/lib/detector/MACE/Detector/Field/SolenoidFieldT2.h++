@@ -1,10 +1,13 @@
 #pragma once
 
+#include "MACE/Detector/Field/NodeSharedFieldMap.h++"
+
 #include "Mustard/Concept/NumericVector.h++"
 #include "Mustard/Detector/Field/MagneticFieldBase.h++"
 #include "Mustard/Detector/Field/MagneticFieldMap.h++"
 #include "Mustard/Detector/Field/ToroidField.h++"
 
+#include <utility>
 #include <variant>
 
 namespace MACE::Detector::Field {
@@ -16,12 +19,17 @@ public:
     template<Mustard::Concept::NumericVector3D T> // clang-format off
     auto B(T x) const -> T { return std::visit([&x](auto&& f) { return f.B(x); }, fField); } // clang-format on
 
+    /// @brief Visit the alternative (fast field or field map) chosen at construction.
+    template<typename V>
+    auto VisitField(V&& visitor) const -> decltype(auto) { return std::visit(std::forward<V>(visitor), fField); }
+
 private:
     using FastField = Mustard::Detector::Field::ToroidField;
     using FieldMap = Mustard::Detector::Field::MagneticFieldMapSymmetryY<>;
+    using SharedFieldMap = NodeSharedMagneticFieldMapSymmetryY;
 
 private:
-    std::variant<FastField, FieldMap> fField;
+    std::variant<FastField, FieldMap, SharedFieldMap> fField;
 };
 
 } // namespace MACE::Detector::Field
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "MACE/Data/Hit.h++"
+#include "MACE/Data/RawHit.h++"
+#include "MACE/Detector/Description/CDC.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace MACE::inline Reconstruction::inline Decoding {
+
+/// @brief Converts CDC raw hits of an event into CDCHit for reconstruction.
+///
+/// Drift distance is obtained by inverting the x-t relation of the sense layer at zero
+/// entrance angle (the track is not known yet), with drift time measured from the event time t0.
+/// A hit is good if its drift time is non-negative and its drift distance lies within the x-t table.
+class CDCDecoder {
+public:
+    using Hit = Mustard::Data::Tuple<Data::CDCHit>;
+
+public:
+    CDCDecoder();
+
+    template<std::indirectly_readable ARawHitPointer>
+        requires Mustard::Data::SuperTupleModel<typename std::iter_value_t<ARawHitPointer>::Model, Data::CDCReadout>
+    auto operator()(const std::vector<ARawHitPointer>& rawHit, double t0 = 0) const -> std::vector<std::shared_ptr<Hit>>;
+
+private:
+    double fMaxDriftDistance;
+    const std::vector<Detector::Description::CDC::CellInformation>* fCellMap;
+    const std::vector<Detector::Description::CDC::XTRelationTable>* fXTRelation;
+};
+
+} // namespace MACE::inline Reconstruction::inline Decoding
+
+#include "MACE/Reconstruction/Decoding/CDCDecoder.inl"
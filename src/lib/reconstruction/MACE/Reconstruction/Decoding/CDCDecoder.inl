@@ -0,0 +1,34 @@
+namespace MACE::inline Reconstruction::inline Decoding {
+
+inline CDCDecoder::CDCDecoder() :
+    fMaxDriftDistance{},
+    fCellMap{},
+    fXTRelation{} {
+    const auto& cdc{Detector::Description::CDC::Instance()};
+    fMaxDriftDistance = cdc.DriftTimeTableMaxDistance();
+    fCellMap = &cdc.CellMap();
+    fXTRelation = &cdc.XTRelation();
+}
+
+template<std::indirectly_readable ARawHitPointer>
+    requires Mustard::Data::SuperTupleModel<typename std::iter_value_t<ARawHitPointer>::Model, Data::CDCReadout>
+auto CDCDecoder::operator()(const std::vector<ARawHitPointer>& rawHit, double t0) const -> std::vector<std::shared_ptr<Hit>> {
+    std::vector<std::shared_ptr<Hit>> hit;
+    hit.reserve(rawHit.size());
+    for (int hitID{}; auto&& raw : rawHit) {
+        const auto cellID{*Get<"CellID">(*raw)};
+        const auto driftTime{*Get<"t">(*raw) - t0};
+        const auto d{(*fXTRelation)[fCellMap->at(cellID).senseLayerID].DriftDistance(driftTime, 0)};
+        const auto& h{hit.emplace_back(std::make_shared<Hit>())};
+        Get<"EvtID">(*h) = *Get<"EvtID">(*raw);
+        Get<"HitID">(*h) = hitID++;
+        Get<"CellID">(*h) = cellID;
+        Get<"t">(*h) = *Get<"t">(*raw);
+        Get<"Edep">(*h) = *Get<"Edep">(*raw);
+        Get<"d">(*h) = d;
+        Get<"Good">(*h) = driftTime >= 0 and d <= fMaxDriftDistance;
+    }
+    return hit;
+}
+
+} // namespace MACE::inline Reconstruction::inline Decoding
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "MACE/Data/Hit.h++"
+#include "MACE/Data/RawHit.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace MACE::inline Reconstruction::inline Decoding {
+
+/// @brief Converts ECAL raw hits of an event into ECALHit for reconstruction.
+class ECALDecoder {
+public:
+    using Hit = Mustard::Data::Tuple<Data::ECALHit>;
+
+public:
+    template<std::indirectly_readable ARawHitPointer>
+        requires Mustard::Data::SuperTupleModel<typename std::iter_value_t<ARawHitPointer>::Model, Data::ECALReadout>
+    auto operator()(const std::vector<ARawHitPointer>& rawHit) const -> std::vector<std::shared_ptr<Hit>>;
+};
+
+} // namespace MACE::inline Reconstruction::inline Decoding
+
+#include "MACE/Reconstruction/Decoding/ECALDecoder.inl"
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "MACE/Data/Hit.h++"
+#include "MACE/Data/RawHit.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace MACE::inline Reconstruction::inline Decoding {
+
+/// @brief Converts TTC raw hits of an event into TTCHit for reconstruction.
+/// Raw hits carry the summed tile amplitude only, so SiPM-wise ADC is left empty.
+class TTCDecoder {
+public:
+    using Hit = Mustard::Data::Tuple<Data::TTCHit>;
+
+public:
+    template<std::indirectly_readable ARawHitPointer>
+        requires Mustard::Data::SuperTupleModel<typename std::iter_value_t<ARawHitPointer>::Model, Data::TTCReadout>
+    auto operator()(const std::vector<ARawHitPointer>& rawHit) const -> std::vector<std::shared_ptr<Hit>>;
+};
+
+} // namespace MACE::inline Reconstruction::inline Decoding
+
+#include "MACE/Reconstruction/Decoding/TTCDecoder.inl"
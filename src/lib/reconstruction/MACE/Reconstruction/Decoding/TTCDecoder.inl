@@ -0,0 +1,20 @@
+namespace MACE::inline Reconstruction::inline Decoding {
+
+template<std::indirectly_readable ARawHitPointer>
+    requires Mustard::Data::SuperTupleModel<typename std::iter_value_t<ARawHitPointer>::Model, Data::TTCReadout>
+auto TTCDecoder::operator()(const std::vector<ARawHitPointer>& rawHit) const -> std::vector<std::shared_ptr<Hit>> {
+    std::vector<std::shared_ptr<Hit>> hit;
+    hit.reserve(rawHit.size());
+    for (int hitID{}; auto&& raw : rawHit) {
+        const auto& h{hit.emplace_back(std::make_shared<Hit>())};
+        Get<"EvtID">(*h) = *Get<"EvtID">(*raw);
+        Get<"HitID">(*h) = hitID++;
+        Get<"TileID">(*h) = *Get<"TileID">(*raw);
+        Get<"t">(*h) = *Get<"t">(*raw);
+        Get<"Edep">(*h) = *Get<"Edep">(*raw);
+        Get<"Good">(*h) = true;
+    }
+    return hit;
+}
+
+} // namespace MACE::inline Reconstruction::inline Decoding
@@ -0,0 +1,131 @@
+#include "MACE/Detector/Description/CDC.h++"
+#include "MACE/Reconstruction/MMSTracking/Alignment/AlignmentParameter.h++"
+
+#include "muc/utility"
+
+#include "fmt/format.h"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Alignment {
+
+namespace {
+
+auto FillValue(const AlignmentParameter& parameter,
+               const std::vector<std::vector<double>>& layerAlignment,
+               const std::vector<std::vector<double>>& cellAlignment,
+               const std::vector<double>& velocityScale) -> Eigen::VectorXd {
+    Eigen::VectorXd value{Eigen::VectorXd::Zero(parameter.NParameter())};
+    for (int i{}; i < std::ssize(layerAlignment); ++i) {
+        for (auto k : {AlignmentParameter::kDx, AlignmentParameter::kDy, AlignmentParameter::kDphi}) {
+            value[parameter.LayerIndex(i, k)] = layerAlignment[i].at(k);
+        }
+    }
+    for (int i{}; i < std::ssize(velocityScale); ++i) {
+        value[parameter.LayerIndex(i, AlignmentParameter::kDv)] = velocityScale[i] - 1;
+    }
+    for (auto&& row : cellAlignment) {
+        const auto cellID{static_cast<int>(std::lround(row.at(0)))};
+        value[parameter.CellIndex(cellID, AlignmentParameter::kCellDx)] = row.at(1);
+        value[parameter.CellIndex(cellID, AlignmentParameter::kCellDy)] = row.at(2);
+        if (row.size() == 5) {
+            value[parameter.CellIndex(cellID, AlignmentParameter::kCellTx)] = row[3];
+            value[parameter.CellIndex(cellID, AlignmentParameter::kCellTy)] = row[4];
+        }
+    }
+    return value;
+}
+
+} // namespace
+
+AlignmentParameter::AlignmentParameter() :
+    fNSenseLayer{},
+    fNCell{},
+    fEnabled{true, true, false} {
+    const auto& cdc{Detector::Description::CDC::Instance()};
+    fNSenseLayer = cdc.NSuperLayer() * cdc.NSenseLayerPerSuper();
+    fNCell = cdc.CellMap().size();
+}
+
+auto AlignmentParameter::Free(int index) const -> bool {
+    if (index >= 4 * fNSenseLayer) {
+        return Enabled(Group::Cell);
+    }
+    return index % 4 == kDv ? Enabled(Group::DriftVelocity) : Enabled(Group::SenseLayer);
+}
+
+auto AlignmentParameter::Name(int index) const -> std::string {
+    if (index >= 4 * fNSenseLayer) {
+        constexpr const char* cellParameterName[]{"dx", "dy", "tx", "ty"};
+        const auto i{index - 4 * fNSenseLayer};
+        return fmt::format("Cell{}.{}", i / 4, cellParameterName[i % 4]);
+    }
+    constexpr const char* layerParameterName[]{"dx", "dy", "dphi", "dv"};
+    return fmt::format("Layer{}.{}", index / 4, layerParameterName[index % 4]);
+}
+
+auto AlignmentParameter::Value() const -> Eigen::VectorXd {
+    const auto& cdc{Detector::Description::CDC::Instance()};
+    return FillValue(*this, cdc.SenseLayerAlignment(), cdc.CellAlignment(), cdc.DriftVelocityScale());
+}
+
+auto AlignmentParameter::Value(const YAML::Node& cdc) const -> Eigen::VectorXd {
+    const auto Read{[&cdc]<typename T>(const char* name) {
+        return cdc[name] ? cdc[name].as<T>() : T{};
+    }};
+    return FillValue(*this,
+                     Read.operator()<std::vector<std::vector<double>>>("SenseLayerAlignment"),
+                     Read.operator()<std::vector<std::vector<double>>>("CellAlignment"),
+                     Read.operator()<std::vector<double>>("DriftVelocityScale"));
+}
+
+auto AlignmentParameter::Apply(const Eigen::VectorXd& delta) const -> void {
+    const Eigen::VectorXd value{Value() + delta};
+    auto& cdc{Detector::Description::CDC::Instance()};
+
+    std::vector<std::vector<double>> layerAlignment(fNSenseLayer);
+    std::vector<double> velocityScale(fNSenseLayer);
+    for (int i{}; i < fNSenseLayer; ++i) {
+        layerAlignment[i] = {value[LayerIndex(i, kDx)], value[LayerIndex(i, kDy)], value[LayerIndex(i, kDphi)]};
+        velocityScale[i] = 1 + value[LayerIndex(i, kDv)];
+    }
+    std::vector<std::vector<double>> cellAlignment;
+    for (int i{}; i < fNCell; ++i) {
+        const auto dx{value[CellIndex(i, kCellDx)]};
+        const auto dy{value[CellIndex(i, kCellDy)]};
+        const auto tx{value[CellIndex(i, kCellTx)]};
+        const auto ty{value[CellIndex(i, kCellTy)]};
+        if (tx != 0 or ty != 0) {
+            cellAlignment.push_back({static_cast<double>(i), dx, dy, tx, ty});
+        } else if (dx != 0 or dy != 0) {
+            cellAlignment.push_back({static_cast<double>(i), dx, dy});
+        }
+    }
+    cdc.SenseLayerAlignment(std::move(layerAlignment));
+    cdc.CellAlignment(std::move(cellAlignment));
+    cdc.DriftVelocityScale(std::move(velocityScale));
+}
+
+auto AlignmentParameter::Export(YAML::Node& node) const -> void {
+    const auto& cdc{Detector::Description::CDC::Instance()};
+    auto cdcNode{node["CDC"]};
+    cdcNode["SenseLayerAlignment"] = cdc.SenseLayerAlignment();
+    cdcNode["CellAlignment"] = cdc.CellAlignment();
+    cdcNode["DriftVelocityScale"] = cdc.DriftVelocityScale();
+}
+
+auto AlignmentParameter::GroupName(Group group) -> std::string {
+    switch (group) {
+    case Group::SenseLayer:
+        return "SenseLayer";
+    case Group::DriftVelocity:
+        return "DriftVelocity";
+    case Group::Cell:
+        return "Cell";
+    }
+    muc::unreachable();
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Alignment
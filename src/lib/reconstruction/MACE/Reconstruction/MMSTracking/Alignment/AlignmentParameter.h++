@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Eigen/Core"
+
+#include "yaml-cpp/yaml.h"
+
+#include <array>
+#include <string>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Alignment {
+
+/// @brief Global parameters of the CDC alignment and drift velocity calibration.
+///
+/// Each sense layer has 4 parameters: a transverse shift (dx, dy), a rotation around z (dphi),
+/// and a relative change of the drift velocity (dv). Each cell has a transverse shift (dx, dy)
+/// on top of its layer, and a wire tilt (tx, ty) = d(dx, dy)/dz. Parameters are indexed as
+///   4 * senseLayerID + {0: dx, 1: dy, 2: dphi, 3: dv},
+///   4 * nSenseLayer + 4 * cellID + {0: dx, 1: dy, 2: tx, 3: ty}.
+/// The current values live in the CDC description (SenseLayerAlignment, CellAlignment and
+/// DriftVelocityScale), so the parameters here are corrections to it.
+class AlignmentParameter {
+public:
+    enum struct Group {
+        SenseLayer,
+        DriftVelocity,
+        Cell
+    };
+
+    enum LayerParameter {
+        kDx,
+        kDy,
+        kDphi,
+        kDv
+    };
+
+    enum CellParameter {
+        kCellDx,
+        kCellDy,
+        kCellTx,
+        kCellTy
+    };
+
+public:
+    AlignmentParameter();
+
+    auto NSenseLayer() const -> auto { return fNSenseLayer; }
+    auto NCell() const -> auto { return fNCell; }
+    auto NParameter() const -> auto { return 4 * fNSenseLayer + 4 * fNCell; }
+    auto LayerIndex(int senseLayerID, LayerParameter k) const -> int { return 4 * senseLayerID + k; }
+    auto CellIndex(int cellID, CellParameter k) const -> int { return 4 * fNSenseLayer + 4 * cellID + k; }
+
+    auto Enabled(Group group) const -> auto { return fEnabled[static_cast<int>(group)]; }
+    auto Enabled(Group group, bool val) -> void { fEnabled[static_cast<int>(group)] = val; }
+    /// @brief Whether the parameter at the index belongs to an enabled group.
+    auto Free(int index) const -> bool;
+    /// @brief Parameter name, e.g. "Layer3.dphi" or "Cell42.tx".
+    auto Name(int index) const -> std::string;
+
+    /// @brief Current values from the CDC description (dv = velocity scale - 1).
+    auto Value() const -> Eigen::VectorXd;
+    /// @brief Values from the CDC section of a description YAML (e.g. an injected misalignment).
+    auto Value(const YAML::Node& cdc) const -> Eigen::VectorXd;
+    /// @brief Add the correction to the CDC description.
+    auto Apply(const Eigen::VectorXd& delta) const -> void;
+    /// @brief Export the current alignment of the CDC description as a description YAML overlay.
+    auto Export(YAML::Node& node) const -> void;
+
+    static auto GroupName(Group group) -> std::string;
+
+private:
+    int fNSenseLayer;
+    int fNCell;
+    std::array<bool, 3> fEnabled;
+};
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Alignment
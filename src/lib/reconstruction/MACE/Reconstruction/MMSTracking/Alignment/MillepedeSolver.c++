@@ -0,0 +1,251 @@
+#include "MACE/Detector/Description/CDC.h++"
+#include "MACE/Reconstruction/MMSTracking/Alignment/MillepedeSolver.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "Eigen/Cholesky"
+#include "Eigen/SparseCore"
+#include "Eigen/SparseLU"
+
+#include "mplr/mplr.hpp"
+
+#include "muc/math"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Alignment {
+
+MillepedeSolver::MillepedeSolver(const AlignmentParameter& parameter) :
+    fParameter{&parameter},
+    fPreSigma{10},
+    fComputeError{},
+    fMatrix{},
+    fVector{Eigen::VectorXd::Zero(parameter.NParameter())},
+    fNTrack{},
+    fChi2{},
+    fNDF{} {}
+
+auto MillepedeSolver::AddTrack(const TrackResidual::TrackFit& fit) -> bool {
+    using Matrix5d = Eigen::Matrix<double, 5, 5>;
+    using Vector5d = Eigen::Matrix<double, 5, 1>;
+
+    // global parameters this track touches
+    std::vector<int> index;
+    muc::flat_hash_map<int, int> position;
+    for (auto&& r : fit.residual) {
+        for (int k{}; k < r.nGlobal; ++k) {
+            if (position.try_emplace(r.globalIndex[k], index.size()).second) {
+                index.emplace_back(r.globalIndex[k]);
+            }
+        }
+    }
+    const auto nGlobal{std::ssize(index)};
+    if (nGlobal == 0) {
+        return false;
+    }
+
+    // normal equations of the track, [gamma G^T; G d] (local, global) = -[beta; g]
+    Matrix5d gamma{Matrix5d::Zero()};
+    Vector5d beta{Vector5d::Zero()};
+    Eigen::MatrixXd bigG{Eigen::MatrixXd::Zero(nGlobal, 5)};
+    Eigen::MatrixXd d{Eigen::MatrixXd::Zero(nGlobal, nGlobal)};
+    Eigen::VectorXd g{Eigen::VectorXd::Zero(nGlobal)};
+    for (auto&& r : fit.residual) {
+        const auto w{1 / muc::pow(r.sigma, 2)};
+        gamma += w * r.local.transpose() * r.local;
+        beta += w * r.r * r.local.transpose();
+        for (int k{}; k < r.nGlobal; ++k) {
+            const auto p{position.at(r.globalIndex[k])};
+            bigG.row(p) += w * r.global[k] * r.local;
+            g[p] += w * r.global[k] * r.r;
+            for (int l{}; l < r.nGlobal; ++l) {
+                d(p, position.at(r.globalIndex[l])) += w * r.global[k] * r.global[l];
+            }
+        }
+    }
+    const Eigen::LDLT<Matrix5d> gammaLDLT{gamma};
+    if (gammaLDLT.info() != Eigen::Success or not gammaLDLT.isPositive()) {
+        return false;
+    }
+
+    // eliminate the local parameters
+    const Eigen::MatrixXd gammaInvGT{gammaLDLT.solve(bigG.transpose())};
+    const Eigen::MatrixXd c{d - bigG * gammaInvGT};
+    const Eigen::VectorXd b{g - gammaInvGT.transpose() * beta};
+    for (int p{}; p < nGlobal; ++p) {
+        fVector[index[p]] += b[p];
+        for (int q{}; q < nGlobal; ++q) {
+            if (index[p] <= index[q]) {
+                fMatrix[Key(index[p], index[q])] += c(p, q);
+            }
+        }
+    }
+    ++fNTrack;
+    fChi2 += fit.chi2;
+    fNDF += fit.ndf;
+    return true;
+}
+
+auto MillepedeSolver::Reset() -> void {
+    fMatrix.clear();
+    fVector.setZero();
+    fNTrack = 0;
+    fChi2 = 0;
+    fNDF = 0;
+}
+
+auto MillepedeSolver::Solve() const -> Result {
+    const auto& worldComm{mplr::comm_world()};
+    const auto comm{worldComm.native_handle()};
+    const auto nParameter{fParameter->NParameter()};
+
+    // merge
+    Result result{Eigen::VectorXd::Zero(nParameter), Eigen::VectorXd::Constant(nParameter, std::numeric_limits<double>::quiet_NaN()), fNTrack, fChi2, fNDF};
+    MPI_Allreduce(MPI_IN_PLACE, &result.nTrack, 1, MPI_LONG_LONG, MPI_SUM, comm);
+    MPI_Allreduce(MPI_IN_PLACE, &result.chi2, 1, MPI_DOUBLE, MPI_SUM, comm);
+    MPI_Allreduce(MPI_IN_PLACE, &result.ndf, 1, MPI_LONG_LONG, MPI_SUM, comm);
+    Eigen::VectorXd vector{fVector};
+    MPI_Allreduce(MPI_IN_PLACE, vector.data(), vector.size(), MPI_DOUBLE, MPI_SUM, comm);
+
+    std::vector<std::uint64_t> key;
+    std::vector<double> value;
+    key.reserve(fMatrix.size());
+    value.reserve(fMatrix.size());
+    for (auto&& [k, v] : fMatrix) {
+        key.emplace_back(k);
+        value.emplace_back(v);
+    }
+    const auto master{worldComm.rank() == 0};
+    const auto count{static_cast<int>(key.size())};
+    std::vector<int> countOfRank(master ? worldComm.size() : 0);
+    MPI_Gather(&count, 1, MPI_INT, countOfRank.data(), 1, MPI_INT, 0, comm);
+    std::vector<int> displacement(countOfRank.size());
+    std::exclusive_scan(countOfRank.cbegin(), countOfRank.cend(), displacement.begin(), 0);
+    const auto total{std::reduce(countOfRank.cbegin(), countOfRank.cend())};
+    std::vector<std::uint64_t> allKey(total);
+    std::vector<double> allValue(total);
+    MPI_Gatherv(key.data(), count, MPI_UINT64_T, allKey.data(), countOfRank.data(), displacement.data(), MPI_UINT64_T, 0, comm);
+    MPI_Gatherv(value.data(), count, MPI_DOUBLE, allValue.data(), countOfRank.data(), displacement.data(), MPI_DOUBLE, 0, comm);
+
+    // solve the bordered system [C A^T; A 0] (delta; lambda) = (-b; 0) on master
+    int success{};
+    if (master) {
+        std::vector<Eigen::Triplet<double>> triplet;
+        triplet.reserve(2 * total + nParameter);
+        for (int i{}; i < total; ++i) {
+            const auto row{static_cast<int>(allKey[i] >> 32)};
+            const auto column{static_cast<int>(allKey[i] & 0xFFFFFFFF)};
+            triplet.emplace_back(row, column, allValue[i]);
+            if (row != column) {
+                triplet.emplace_back(column, row, allValue[i]);
+            }
+        }
+        for (int i{}; i < nParameter; ++i) {
+            triplet.emplace_back(i, i, 1 / muc::pow(fPreSigma, 2));
+        }
+        auto nRow{nParameter};
+        // a constraint on fixed parameters only would be an empty (singular) row
+        const auto AddConstraint{[&](const std::vector<std::pair<int, double>>& coefficient) {
+            auto empty{true};
+            for (auto&& [i, a] : coefficient) {
+                if (fParameter->Free(i)) {
+                    triplet.emplace_back(nRow, i, a);
+                    triplet.emplace_back(i, nRow, a);
+                    empty = false;
+                }
+            }
+            if (not empty) {
+                ++nRow;
+            }
+        }};
+        const auto nSenseLayer{fParameter->NSenseLayer()};
+        if (fParameter->Enabled(AlignmentParameter::Group::SenseLayer)) {
+            for (auto k : {AlignmentParameter::kDx, AlignmentParameter::kDy, AlignmentParameter::kDphi}) {
+                std::vector<std::pair<int, double>> coefficient;
+                for (int l{}; l < nSenseLayer; ++l) {
+                    coefficient.emplace_back(fParameter->LayerIndex(l, k), 1);
+                }
+                AddConstraint(coefficient);
+            }
+        }
+        if (fParameter->Enabled(AlignmentParameter::Group::Cell)) {
+            std::vector<std::vector<std::pair<int, double>>> sumX(nSenseLayer);
+            std::vector<std::vector<std::pair<int, double>>> sumY(nSenseLayer);
+            std::vector<std::vector<std::pair<int, double>>> sumPhi(nSenseLayer);
+            std::vector<std::pair<int, double>> sumTx;
+            std::vector<std::pair<int, double>> sumTy;
+            for (auto&& cell : Detector::Description::CDC::Instance().CellMap()) {
+                const auto ix{fParameter->CellIndex(cell.cellID, AlignmentParameter::kCellDx)};
+                const auto iy{fParameter->CellIndex(cell.cellID, AlignmentParameter::kCellDy)};
+                const auto radial{cell.position.normalized()};
+                sumX[cell.senseLayerID].emplace_back(ix, 1);
+                sumY[cell.senseLayerID].emplace_back(iy, 1);
+                sumPhi[cell.senseLayerID].emplace_back(ix, -radial.y());
+                sumPhi[cell.senseLayerID].emplace_back(iy, radial.x());
+                sumTx.emplace_back(fParameter->CellIndex(cell.cellID, AlignmentParameter::kCellTx), 1);
+                sumTy.emplace_back(fParameter->CellIndex(cell.cellID, AlignmentParameter::kCellTy), 1);
+            }
+            for (int l{}; l < nSenseLayer; ++l) {
+                AddConstraint(sumX[l]);
+                AddConstraint(sumY[l]);
+                AddConstraint(sumPhi[l]);
+            }
+            AddConstraint(sumTx);
+            AddConstraint(sumTy);
+        }
+
+        Eigen::SparseMatrix<double> matrix(nRow, nRow);
+        matrix.setFromTriplets(triplet.cbegin(), triplet.cend());
+        Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+        solver.compute(matrix);
+        if (solver.info() == Eigen::Success) {
+            Eigen::VectorXd rhs{Eigen::VectorXd::Zero(nRow)};
+            rhs.head(nParameter) = -vector;
+            result.delta = solver.solve(rhs).head(nParameter);
+            success = solver.info() == Eigen::Success;
+            // errors from the diagonal of the inverse (constrained covariance), solved for a
+            // block of unit vectors at a time
+            if (fComputeError) {
+                std::vector<int> free;
+                for (int i{}; i < nParameter; ++i) {
+                    if (fParameter->Free(i)) {
+                        free.emplace_back(i);
+                    }
+                }
+                constexpr auto blockSize{64};
+                for (gsl::index begin{}; begin < std::ssize(free); begin += blockSize) {
+                    const auto n{std::min<gsl::index>(blockSize, std::ssize(free) - begin)};
+                    Eigen::MatrixXd unit{Eigen::MatrixXd::Zero(nRow, n)};
+                    for (gsl::index k{}; k < n; ++k) {
+                        unit(free[begin + k], k) = 1;
+                    }
+                    const Eigen::MatrixXd column{solver.solve(unit)};
+                    for (gsl::index k{}; k < n; ++k) {
+                        const auto i{free[begin + k]};
+                        result.error[i] = std::sqrt(std::max(0., column(i, k)));
+                    }
+                }
+                success = success and solver.info() == Eigen::Success;
+            }
+        }
+    }
+    MPI_Bcast(&success, 1, MPI_INT, 0, comm);
+    if (not success) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Alignment normal equations ({} parameters, {} tracks) cannot be solved", nParameter, result.nTrack));
+    }
+    MPI_Bcast(result.delta.data(), nParameter, MPI_DOUBLE, 0, comm);
+    MPI_Bcast(result.error.data(), nParameter, MPI_DOUBLE, 0, comm);
+    return result;
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Alignment
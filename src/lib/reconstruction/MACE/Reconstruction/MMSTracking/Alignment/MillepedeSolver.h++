@@ -0,0 +1,69 @@
+#pragma once
+
+#include "MACE/Reconstruction/MMSTracking/Alignment/AlignmentParameter.h++"
+#include "MACE/Reconstruction/MMSTracking/Alignment/TrackResidual.h++"
+
+#include "Eigen/Core"
+
+#include "muc/hash_map"
+
+#include <cstdint>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Alignment {
+
+/// @brief Global least squares for the alignment parameters, in the Millepede way.
+///
+/// Each track contributes its hits with the local (helix) parameters eliminated on the fly
+/// (the Schur complement of the track's normal equations), so that the global normal matrix
+/// stays of the size of the alignment parameters and is sparse (a hit couples its layer and
+/// cell only). Contributions are merged over MPI processes and solved on the master process
+/// with linear constraints removing the degenerate modes:
+///   - sum over sense layers of dx, dy and dphi vanishes (an overall shift or rotation of the
+///     CDC is absorbed by the tracks),
+///   - sum over the cells of each layer of dx, dy and of the azimuthal shift vanishes,
+///   - sum over all cells of the wire tilts tx and ty vanishes (an overall tilt of the CDC).
+/// Constraints only involve free parameters (see AlignmentParameter::Free). Every parameter is
+/// also regularized by a pre-sigma, which fixes the parameters no hit constrains (e.g. of
+/// disabled groups).
+/// Parameter errors need the diagonal of the inverse of the bordered matrix, i.e. one more
+/// solve per free parameter, and are only computed on request (ComputeError).
+class MillepedeSolver {
+public:
+    struct Result {
+        Eigen::VectorXd delta; ///< correction to the current alignment
+        Eigen::VectorXd error; ///< statistical error of the correction (NaN if not computed)
+        long long nTrack;
+        double chi2; ///< of the local fits, before the correction
+        long long ndf;
+    };
+
+public:
+    explicit MillepedeSolver(const AlignmentParameter& parameter);
+
+    auto PreSigma() const -> auto { return fPreSigma; }
+    auto PreSigma(double val) -> void { fPreSigma = val; }
+    auto ComputeError() const -> auto { return fComputeError; }
+    auto ComputeError(bool val) -> void { fComputeError = val; }
+
+    /// @brief Add a fitted track to the normal equations. Returns false if the track is ill-conditioned.
+    auto AddTrack(const TrackResidual::TrackFit& fit) -> bool;
+    auto Reset() -> void;
+    /// @brief Merge over MPI processes and solve (collective). All processes get the result.
+    auto Solve() const -> Result;
+
+private:
+    static auto Key(int i, int j) -> std::uint64_t { return static_cast<std::uint64_t>(i) << 32 | static_cast<std::uint32_t>(j); }
+
+private:
+    const AlignmentParameter* fParameter;
+    double fPreSigma;
+    bool fComputeError;
+
+    muc::flat_hash_map<std::uint64_t, double> fMatrix; ///< upper triangle, (i, j) with i <= j
+    Eigen::VectorXd fVector;
+    long long fNTrack;
+    double fChi2;
+    long long fNDF;
+};
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Alignment
@@ -0,0 +1,231 @@
+#include "MACE/Detector/Description/CDC.h++"
+#include "MACE/Reconstruction/MMSTracking/Alignment/TrackResidual.h++"
+
+#include "Mustard/Utility/LiteralUnit.h++"
+
+#include "Eigen/Cholesky"
+
+#include "muc/math"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <utility>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Alignment {
+
+using namespace Mustard::LiteralUnit::Length;
+
+TrackResidual::TrackResidual(const AlignmentParameter& parameter) :
+    fParameter{&parameter},
+    fResolution{150_um},
+    fMaxResidual{1.5_mm},
+    fMinHit{8},
+    fMaxIteration{5} {}
+
+auto TrackResidual::operator()(const Helix& helix, const DriftHit& hit) const -> std::optional<HitResidual> {
+    const auto& cdc{Detector::Description::CDC::Instance()};
+    const auto& cell{cdc.CellMap().at(hit.cellID)};
+    const Eigen::Vector3d w0{cell.position.x(), cell.position.y(), 0};
+    const auto& u{cell.direction};
+
+    const auto [c0, r0, phi0, z0, theta0, t0, velocity]{helix};
+    const auto cotTheta0{1 / std::tan(theta0)};
+    const auto H{[&](double phi) -> Eigen::Vector3d {
+        return {c0.x() + r0 * std::cos(phi), c0.y() + r0 * std::sin(phi), z0 + r0 * (phi - phi0) * cotTheta0};
+    }};
+    const auto dH{[&](double phi) -> Eigen::Vector3d {
+        return {-r0 * std::sin(phi), r0 * std::cos(phi), r0 * cotTheta0};
+    }};
+    const auto Transverse{[&u](const Eigen::Vector3d& v) -> Eigen::Vector3d { return v - v.dot(u) * u; }};
+
+    // closest approach on one turn, by Newton iterations on the squared distance
+    const auto ClosestPhi{[&](double phi) {
+        for (int i{}; i < 20; ++i) {
+            const Eigen::Vector3d e{Transverse(H(phi) - w0)};
+            const Eigen::Vector3d h1{dH(phi)};
+            const Eigen::Vector3d h2{-r0 * std::cos(phi), -r0 * std::sin(phi), 0};
+            const auto g{e.dot(h1)};
+            const auto gPrime{Transverse(h1).squaredNorm() + e.dot(h2)};
+            const auto step{gPrime > 0 ? std::clamp(-g / gPrime, -0.1, 0.1) : (g > 0 ? -0.01 : 0.01)};
+            phi += step;
+            if (std::abs(step) < 1e-12) {
+                break;
+            }
+        }
+        return phi;
+    }};
+    // azimuth of the wire around the helix center, at the z where the helix meets the wire
+    const auto WireAzimuth{[&](double phi) {
+        for (int i{}; i < 3; ++i) {
+            const Eigen::Vector3d w{w0 + (H(phi).z() / u.z()) * u};
+            phi = std::atan2(w.y() - c0.y(), w.x() - c0.x());
+        }
+        return phi;
+    }};
+
+    // scan turns forward from the vertex within the chamber, keep the closest
+    const auto forward{(theta0 > 0) == (r0 > 0) ? 1 : -1};
+    const auto zMax{cell.senseWireHalfLength * std::abs(u.z())};
+    auto phiBase{WireAzimuth(phi0)};
+    phiBase -= 2 * std::numbers::pi * std::floor(forward * (phiBase - phi0) / (2 * std::numbers::pi)) * forward;
+    auto bestPhi{std::numeric_limits<double>::quiet_NaN()};
+    auto bestDOCA{std::numeric_limits<double>::max()};
+    for (int turn{}; turn < 10; ++turn) {
+        const auto phiStart{phiBase + forward * 2 * std::numbers::pi * turn};
+        if (std::abs(H(phiStart).z()) > zMax + cdc.ReferenceCellWidth()) {
+            break;
+        }
+        const auto phi{ClosestPhi(WireAzimuth(phiStart))};
+        if (const auto doca{Transverse(H(phi) - w0).norm()};
+            doca < bestDOCA) {
+            bestDOCA = doca;
+            bestPhi = phi;
+        }
+    }
+    if (std::isnan(bestPhi)) {
+        return std::nullopt;
+    }
+    const Eigen::Vector3d x{H(bestPhi)};
+    const Eigen::Vector3d e{Transverse(x - w0)};
+    const auto doca{e.norm()};
+    const Eigen::Vector3d wire{x - e};
+    if (std::abs((wire - w0).dot(u)) > cell.senseWireHalfLength or doca > cdc.DriftTimeTableMaxDistance() or doca == 0) {
+        return std::nullopt;
+    }
+    const Eigen::Vector3d n{e / doca};
+
+    // measured drift distance, entrance angle as in CDCSD
+    const Eigen::Vector3d pT{Transverse(dH(bestPhi))};
+    const Eigen::Vector3d rT{Transverse(w0)};
+    auto entranceAngle{std::atan2(rT.cross(pT).dot(u), rT.dot(pT))};
+    if (entranceAngle > std::numbers::pi / 2) {
+        entranceAngle -= std::numbers::pi;
+    } else if (entranceAngle < -std::numbers::pi / 2) {
+        entranceAngle += std::numbers::pi;
+    }
+    const auto dPhi{bestPhi - phi0};
+    const auto tPass{std::isnan(hit.tPass) ?
+                         t0 + std::abs(r0 * dPhi / std::sin(theta0)) / velocity :
+                         hit.tPass};
+    const auto tDrift{hit.t - tPass};
+    const auto& xt{cdc.XTRelation()[cell.senseLayerID]};
+    const auto dMeasured{xt.DriftDistance(tDrift, entranceAngle)};
+
+    HitResidual residual;
+    residual.cellID = hit.cellID;
+    residual.senseLayerID = cell.senseLayerID;
+    residual.r = dMeasured - doca;
+    residual.rUnbiased = residual.r;
+    residual.sigma = fResolution;
+    // dr/dq = -n . dx/dq
+    residual.local << -n.x(),
+        -n.y(),
+        -(n.x() * std::cos(bestPhi) + n.y() * std::sin(bestPhi) + n.z() * dPhi * cotTheta0),
+        -n.z(),
+        n.z() * r0 * dPhi / muc::pow(std::sin(theta0), 2);
+    // dr/da = n . dwire/da
+    residual.nGlobal = 0;
+    const auto AddGlobal{[&](int index, double derivative) {
+        if (fParameter->Free(index)) {
+            residual.globalIndex[residual.nGlobal] = index;
+            residual.global[residual.nGlobal] = derivative;
+            ++residual.nGlobal;
+        }
+    }};
+    const auto& layerAlignment{cdc.SenseLayerAlignment()};
+    Eigen::Vector2d shift{0, 0};
+    if (not layerAlignment.empty()) {
+        shift += Eigen::Vector2d{layerAlignment[cell.senseLayerID][0], layerAlignment[cell.senseLayerID][1]};
+    }
+    for (auto&& row : cdc.CellAlignment()) {
+        if (std::lround(row[0]) == hit.cellID) {
+            shift += Eigen::Vector2d{row[1], row[2]};
+            if (row.size() == 5) {
+                shift += wire.z() * Eigen::Vector2d{row[3], row[4]};
+            }
+        }
+    }
+    const auto layer{cell.senseLayerID};
+    AddGlobal(fParameter->LayerIndex(layer, AlignmentParameter::kDx), n.x());
+    AddGlobal(fParameter->LayerIndex(layer, AlignmentParameter::kDy), n.y());
+    AddGlobal(fParameter->LayerIndex(layer, AlignmentParameter::kDphi), n.y() * (wire.x() - shift.x()) - n.x() * (wire.y() - shift.y()));
+    if (fParameter->Free(fParameter->LayerIndex(layer, AlignmentParameter::kDv))) {
+        // velocity scaled by (1 + dv): d = x(t (1 + dv))
+        constexpr auto epsilon{1e-4};
+        AddGlobal(fParameter->LayerIndex(layer, AlignmentParameter::kDv),
+                  (xt.DriftDistance(tDrift * (1 + epsilon), entranceAngle) -
+                   xt.DriftDistance(tDrift * (1 - epsilon), entranceAngle)) /
+                      (2 * epsilon));
+    }
+    AddGlobal(fParameter->CellIndex(hit.cellID, AlignmentParameter::kCellDx), n.x());
+    AddGlobal(fParameter->CellIndex(hit.cellID, AlignmentParameter::kCellDy), n.y());
+    AddGlobal(fParameter->CellIndex(hit.cellID, AlignmentParameter::kCellTx), n.x() * wire.z());
+    AddGlobal(fParameter->CellIndex(hit.cellID, AlignmentParameter::kCellTy), n.y() * wire.z());
+
+    return residual;
+}
+
+auto TrackResidual::Fit(Helix helix, const std::vector<DriftHit>& hit) const -> std::optional<TrackFit> {
+    if (std::ssize(hit) < fMinHit) {
+        return std::nullopt;
+    }
+    using Matrix5d = Eigen::Matrix<double, 5, 5>;
+    using Vector5d = Eigen::Matrix<double, 5, 1>;
+
+    std::vector<HitResidual> residual;
+    Eigen::LDLT<Matrix5d> gamma;
+    auto converged{false};
+    for (int iteration{};; ++iteration) {
+        residual.clear();
+        for (auto&& h : hit) {
+            if (auto r{(*this)(helix, h)};
+                r and std::abs(r->r) < fMaxResidual) {
+                residual.emplace_back(*std::move(r));
+            }
+        }
+        if (std::ssize(residual) < fMinHit) {
+            return std::nullopt;
+        }
+        Matrix5d a{Matrix5d::Zero()};
+        Vector5d b{Vector5d::Zero()};
+        for (auto&& r : residual) {
+            const auto w{1 / muc::pow(r.sigma, 2)};
+            a += w * r.local.transpose() * r.local;
+            b += w * r.r * r.local.transpose();
+        }
+        gamma.compute(a);
+        if (gamma.info() != Eigen::Success or not gamma.isPositive()) {
+            return std::nullopt;
+        }
+        if (converged or iteration == fMaxIteration) {
+            break;
+        }
+        const Vector5d delta{-gamma.solve(b)};
+        helix.c0 += delta.head<2>();
+        helix.r0 += delta[2];
+        helix.z0 += delta[3];
+        helix.theta0 += delta[4];
+        converged = delta.head<4>().cwiseAbs().maxCoeff() < 1_um and std::abs(delta[4]) < 1e-6;
+    }
+
+    // unbiased residuals, r / (1 - h) with h the leverage of the hit; outlier rejection on them
+    TrackFit fit{helix, {}, 0, 0};
+    for (auto&& r : residual) {
+        const auto leverage{(r.local * gamma.solve(r.local.transpose()))(0) / muc::pow(r.sigma, 2)};
+        r.rUnbiased = r.r / std::max(1 - leverage, 1e-3);
+        if (std::abs(r.rUnbiased) > fMaxResidual) {
+            continue;
+        }
+        fit.chi2 += muc::pow(r.r / r.sigma, 2);
+        fit.residual.emplace_back(std::move(r));
+    }
+    fit.ndf = std::ssize(fit.residual) - 5;
+    if (std::ssize(fit.residual) < fMinHit) {
+        return std::nullopt;
+    }
+    return fit;
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Alignment
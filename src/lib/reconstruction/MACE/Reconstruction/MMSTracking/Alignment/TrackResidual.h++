@@ -0,0 +1,105 @@
+#pragma once
+
+#include "MACE/Data/MMSTrack.h++"
+#include "MACE/Reconstruction/MMSTracking/Alignment/AlignmentParameter.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Utility/PhysicalConstant.h++"
+
+#include "Eigen/Core"
+
+#include "muc/math"
+
+#include <array>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Alignment {
+
+/// @brief CDC hit residuals w.r.t. a helix, and their derivatives w.r.t. the helix (local)
+/// and the alignment (global) parameters.
+///
+/// The helix is the MMSTrack one, x = c0 + r0 (cos(phi), sin(phi)), z = z0 + r0 (phi - phi0) / tan(theta0),
+/// with local parameters (c0x, c0y, r0, z0, theta0) at fixed phi0, as the track covariance.
+/// The residual is the measured drift distance (from the drift time through the x-t relation of
+/// the sense layer) minus the distance of closest approach (DOCA) of the helix to the sense wire,
+/// both from the current CDC description. The drift time is the signal time minus T0 plus the time
+/// of flight along the helix (or a given pass time, e.g. the MC truth); the time of flight is not
+/// differentiated. Derivatives of the DOCA are analytic (the closest point is stationary), the one
+/// w.r.t. the drift velocity is numerical.
+///
+/// This is a standalone uniform-field helix refit, not the residuals of the GenFit track fit: it is
+/// the path to validate the alignment on simulation (inject, reconstruct, recover), and is valid
+/// where the field in the CDC is uniform.
+class TrackResidual {
+public:
+    struct Helix {
+        Eigen::Vector2d c0;
+        double r0;
+        double phi0;
+        double z0;
+        double theta0;
+        double t0;
+        double velocity;
+    };
+
+    struct DriftHit {
+        int cellID;
+        double t;     ///< signal time
+        double tPass; ///< time the particle passes the cell, NaN for T0 plus time of flight along the helix
+    };
+
+    struct HitResidual {
+        int cellID;
+        int senseLayerID;
+        double r;                          ///< measured minus expected drift distance
+        double rUnbiased;                  ///< residual w.r.t. the fit without this hit
+        double sigma;                      ///< drift distance resolution
+        Eigen::Matrix<double, 1, 5> local; ///< dr / d(c0x, c0y, r0, z0, theta0)
+        std::array<int, 8> globalIndex;
+        std::array<double, 8> global; ///< dr / d(alignment parameter)
+        int nGlobal;
+    };
+
+    struct TrackFit {
+        Helix helix;
+        std::vector<HitResidual> residual; ///< of hits passed the outlier cut
+        double chi2;
+        int ndf;
+    };
+
+public:
+    explicit TrackResidual(const AlignmentParameter& parameter);
+
+    auto Resolution() const -> auto { return fResolution; }
+    auto MaxResidual() const -> auto { return fMaxResidual; }
+    auto MinHit() const -> auto { return fMinHit; }
+    auto MaxIteration() const -> auto { return fMaxIteration; }
+
+    auto Resolution(double val) -> void { fResolution = val; }
+    auto MaxResidual(double val) -> void { fMaxResidual = val; }
+    auto MinHit(int val) -> void { fMinHit = val; }
+    auto MaxIteration(int val) -> void { fMaxIteration = val; }
+
+    /// @brief Residual of a hit and its derivatives, nullopt if the helix does not pass the wire.
+    auto operator()(const Helix& helix, const DriftHit& hit) const -> std::optional<HitResidual>;
+    /// @brief Refit the helix to the hits (Gauss-Newton, rejecting hits with residual beyond MaxResidual)
+    /// and return residuals at the fitted helix. nullopt if less than MinHit hits remain.
+    auto Fit(Helix helix, const std::vector<DriftHit>& hit) const -> std::optional<TrackFit>;
+
+    template<Mustard::Data::SuperTupleModel<Data::MMSTrack> ATrack>
+    static auto HelixOf(const Mustard::Data::Tuple<ATrack>& track) -> Helix;
+
+private:
+    const AlignmentParameter* fParameter;
+    double fResolution;
+    double fMaxResidual;
+    int fMinHit;
+    int fMaxIteration;
+};
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Alignment
+
+#include "MACE/Reconstruction/MMSTracking/Alignment/TrackResidual.inl"
@@ -0,0 +1,18 @@
+namespace MACE::inline Reconstruction::MMSTracking::inline Alignment {
+
+template<Mustard::Data::SuperTupleModel<Data::MMSTrack> ATrack>
+auto TrackResidual::HelixOf(const Mustard::Data::Tuple<ATrack>& track) -> Helix {
+    using Mustard::PhysicalConstant::c_light;
+    using Mustard::PhysicalConstant::electron_mass_c2;
+    const auto c0{*Get<"c0">(track)};
+    const auto gamma{1 + *Get<"Ek0">(track) / electron_mass_c2};
+    return {{c0[0], c0[1]},
+            *Get<"r0">(track),
+            *Get<"phi0">(track),
+            *Get<"z0">(track),
+            *Get<"theta0">(track),
+            *Get<"t0">(track),
+            std::sqrt(1 - 1 / muc::pow(gamma, 2)) * c_light};
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Alignment
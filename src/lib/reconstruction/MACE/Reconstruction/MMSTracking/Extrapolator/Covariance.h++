@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Mustard/Utility/PhysicalConstant.h++"
+
+#include "Eigen/Core"
+
+#include "muc/array"
+#include "muc/math"
+
+#include "gsl/gsl"
+
+#include <cmath>
+#include <vector>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Extrapolator {
+
+/// @brief Jacobian of the helix parameters (c0x, c0y, r0, z0, theta0) w.r.t. the vertex (x, y, z, px, py, pz),
+/// with phi0 fixed as the reference. See Data::CalculateHelix for the parametrization.
+inline auto HelixJacobian(muc::array3d p0, int charge, double magneticFluxDensity) -> Eigen::Matrix<double, 5, 6> {
+    using Mustard::PhysicalConstant::c_light;
+
+    const auto sign{-charge};
+    const auto kappa{1 / (magneticFluxDensity * c_light)};
+    const auto pT2{muc::hypot_sq(p0[0], p0[1])};
+    const auto pT{std::sqrt(pT2)};
+    const auto p2{pT2 + muc::pow(p0[2], 2)};
+
+    Eigen::Matrix<double, 5, 6> jacobian;
+    jacobian.setZero();
+    jacobian(0, 0) = 1;
+    jacobian(0, 4) = -sign * kappa;
+    jacobian(1, 1) = 1;
+    jacobian(1, 3) = sign * kappa;
+    jacobian(2, 3) = kappa * p0[0] / pT;
+    jacobian(2, 4) = kappa * p0[1] / pT;
+    jacobian(3, 2) = 1;
+    jacobian(4, 3) = sign * p0[2] * p0[0] / (pT * p2);
+    jacobian(4, 4) = sign * p0[2] * p0[1] / (pT * p2);
+    jacobian(4, 5) = -sign * pT / p2;
+    return jacobian;
+}
+
+/// @brief Jacobian of the vertex (x, y, z, px, py, pz) w.r.t. the helix parameters (c0x, c0y, r0, z0, theta0),
+/// with phi0 fixed as the reference. See Data::CalculateVertex for the parametrization.
+inline auto VertexJacobian(double r0, double phi0, double theta0, int charge, double magneticFluxDensity) -> Eigen::Matrix<double, 6, 5> {
+    using Mustard::PhysicalConstant::c_light;
+
+    const auto k{-charge * magneticFluxDensity * c_light}; // pXY = k * r0
+    const auto cos0{std::cos(phi0)};
+    const auto sin0{std::sin(phi0)};
+
+    Eigen::Matrix<double, 6, 5> jacobian;
+    jacobian.setZero();
+    jacobian(0, 0) = 1;
+    jacobian(0, 2) = cos0;
+    jacobian(1, 1) = 1;
+    jacobian(1, 2) = sin0;
+    jacobian(2, 3) = 1;
+    jacobian(3, 2) = -k * sin0;
+    jacobian(4, 2) = k * cos0;
+    jacobian(5, 2) = k / std::tan(theta0);
+    jacobian(5, 4) = -k * r0 / muc::pow(std::sin(theta0), 2);
+    return jacobian;
+}
+
+/// @brief Pack the lower triangle of a symmetric matrix row by row, as stored in data models.
+template<int N>
+auto PackCovariance(const Eigen::Matrix<double, N, N>& cov) -> std::vector<float> {
+    std::vector<float> packed;
+    packed.reserve(N * (N + 1) / 2);
+    for (gsl::index i{}; i < N; ++i) {
+        for (gsl::index j{}; j <= i; ++j) {
+            packed.emplace_back(cov(i, j));
+        }
+    }
+    return packed;
+}
+
+/// @brief Inverse of PackCovariance. An ill-sized input gives a zero matrix.
+template<int N>
+auto UnpackCovariance(const std::vector<float>& packed) -> Eigen::Matrix<double, N, N> {
+    Eigen::Matrix<double, N, N> cov;
+    cov.setZero();
+    if (std::ssize(packed) != N * (N + 1) / 2) {
+        return cov;
+    }
+    for (gsl::index i{}, k{}; i < N; ++i) {
+        for (gsl::index j{}; j <= i; ++j, ++k) {
+            cov(i, j) = packed[k];
+            cov(j, i) = packed[k];
+        }
+    }
+    return cov;
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Extrapolator
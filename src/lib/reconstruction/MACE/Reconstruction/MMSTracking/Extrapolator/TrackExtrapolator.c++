@@ -0,0 +1,217 @@
+#include "MACE/Detector/Description/ECALField.h++"
+#include "MACE/Detector/Description/MMSField.h++"
+#include "MACE/Detector/Description/Target.h++"
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/TrackExtrapolator.h++"
+
+#include "Mustard/Utility/LiteralUnit.h++"
+#include "Mustard/Utility/PhysicalConstant.h++"
+
+#include "TDatabasePDG.h"
+
+#include "muc/math"
+#include "muc/utility"
+
+#include <cmath>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Extrapolator {
+
+namespace {
+
+using namespace Mustard::LiteralUnit::Energy;
+using namespace Mustard::LiteralUnit::Length;
+
+constexpr auto positionDelta{10_um};
+constexpr auto relativeMomentumDelta{1e-5};
+
+} // namespace
+
+TrackExtrapolator::TrackExtrapolator(FieldModel fieldModel) :
+    fFieldModel{fieldModel},
+    fStepLength{5_mm},
+    fMaxPathLength{10_m},
+    fTolerance{1_nm},
+    fFastField{Detector::Description::MMSField::Instance().FastField()},
+    fField{} {
+    if (fFieldModel == FieldModel::FieldMap) {
+        fField.emplace();
+    }
+}
+
+auto TrackExtrapolator::TargetPlane() -> Plane {
+    // the target is placed at the origin (see Detector::Definition::Target and AcceleratorField)
+    const auto& target{Detector::Description::Target::Instance()};
+    if (target.ShapeType() == Detector::Description::Target::TargetShapeType::Cuboid) {
+        const auto& cuboid{target.Cuboid()};
+        return {{0, 0, 0}, {-cuboid.SinTiltAngle(), 0, cuboid.CosTiltAngle()}};
+    }
+    return {{0, 0, 0}, {0, 0, 1}};
+}
+
+auto TrackExtrapolator::MCPPlane() -> Plane {
+    // MCP chamber and MCP are placed at the center of ECAL field region
+    return {Detector::Description::ECALField::Instance().Center(), {0, 0, 1}};
+}
+
+auto TrackExtrapolator::ParticleOf(int pdgID) -> std::optional<Particle> {
+    const auto particle{TDatabasePDG::Instance()->GetParticle(pdgID)};
+    if (particle == nullptr) {
+        return std::nullopt;
+    }
+    // TParticlePDG charge is in units of e/3 and mass in GeV
+    return Particle{static_cast<int>(std::lround(particle->Charge() / 3)), particle->Mass() * 1_GeV};
+}
+
+auto TrackExtrapolator::Extrapolate(const State& state, int charge, double mass, const Plane& plane) const -> std::optional<State> {
+    const Eigen::Vector3d normal{Eigen::Vector3d{plane.normal[0], plane.normal[1], plane.normal[2]}.normalized()};
+    const Eigen::Vector3d point{plane.point[0], plane.point[1], plane.point[2]};
+    return Extrapolate(state, charge, mass,
+                       Surface{[=](const Eigen::Vector3d& x) { return normal.dot(x - point); },
+                               [=](const Eigen::Vector3d&) { return normal; }});
+}
+
+auto TrackExtrapolator::Extrapolate(const State& state, int charge, double mass, const Cylinder& cylinder) const -> std::optional<State> {
+    const auto radius{cylinder.radius};
+    return Extrapolate(state, charge, mass,
+                       Surface{[=](const Eigen::Vector3d& x) { return x.head<2>().norm() - radius; },
+                               [](const Eigen::Vector3d& x) { return Eigen::Vector3d{x[0], x[1], 0}.normalized(); }});
+}
+
+auto TrackExtrapolator::Extrapolate(const State& state, int charge, double mass, const Sphere& sphere) const -> std::optional<State> {
+    const Eigen::Vector3d center{sphere.center[0], sphere.center[1], sphere.center[2]};
+    const auto radius{sphere.radius};
+    return Extrapolate(state, charge, mass,
+                       Surface{[=](const Eigen::Vector3d& x) { return (x - center).norm() - radius; },
+                               [=](const Eigen::Vector3d& x) { return Eigen::Vector3d{(x - center).normalized()}; }});
+}
+
+auto TrackExtrapolator::Extrapolate(const State& state, int charge, double mass, const Surface& surface) const -> std::optional<State> {
+    Vector6d y0;
+    y0 << state.x[0], state.x[1], state.x[2], state.p[0], state.p[1], state.p[2];
+    const Eigen::Vector3d x0{y0.head<3>()};
+    const auto approaching{surface.distance(x0) * surface.normal(x0).dot(y0.tail<3>()) < 0};
+    const auto pMag{y0.tail<3>().norm()};
+
+    for (auto direction : {approaching ? 1. : -1., approaching ? -1. : 1.}) {
+        const auto transported{Transport(y0, charge, direction, surface)};
+        if (not transported) {
+            continue;
+        }
+        const auto& [y, s]{*transported};
+
+        Eigen::Matrix<double, 6, 6> jacobian;
+        for (int i{}; i < 6; ++i) {
+            const auto delta{i < 3 ? positionDelta : relativeMomentumDelta * pMag};
+            auto yPlus{y0};
+            auto yMinus{y0};
+            yPlus[i] += delta;
+            yMinus[i] -= delta;
+            const auto plus{Transport(yPlus, charge, direction, surface)};
+            const auto minus{Transport(yMinus, charge, direction, surface)};
+            if (plus and minus) {
+                jacobian.col(i) = (plus->first - minus->first) / (2 * delta);
+            } else {
+                jacobian.col(i).setZero();
+            }
+        }
+
+        using Mustard::PhysicalConstant::c_light;
+        State result;
+        result.t = state.t + s * std::sqrt(muc::pow(pMag, 2) + muc::pow(mass, 2)) / (pMag * c_light);
+        result.s = state.s + s;
+        result.x = {y[0], y[1], y[2]};
+        result.p = {y[3], y[4], y[5]};
+        result.cov = jacobian * state.cov * jacobian.transpose();
+        return result;
+    }
+    return std::nullopt;
+}
+
+auto TrackExtrapolator::Transport(const Vector6d& y0, int charge, double direction, const Surface& surface) const
+    -> std::optional<std::pair<Vector6d, double>> {
+    const auto Distance{[&](const Vector6d& y) { return surface.distance(y.head<3>()); }};
+
+    auto y{y0};
+    auto d{Distance(y)};
+    for (double s{}; std::abs(s) < fMaxPathLength; s += direction * fStepLength) {
+        const auto next{Step(y, charge, direction * fStepLength)};
+        const auto dNext{Distance(next)};
+        if (d * dNext > 0) {
+            y = next;
+            d = dNext;
+            continue;
+        }
+        // crossed in this step, bisect
+        auto lower{0.};
+        auto upper{direction * fStepLength};
+        auto yCross{next};
+        while (std::abs(upper - lower) > fTolerance) {
+            const auto middle{(lower + upper) / 2};
+            yCross = Step(y, charge, middle);
+            if (d * Distance(yCross) > 0) {
+                lower = middle;
+            } else {
+                upper = middle;
+            }
+        }
+        const auto sCross{(lower + upper) / 2};
+        yCross = Step(y, charge, sCross);
+        // last correction along the tangent, puts the state on the surface
+        const Eigen::Vector3d tangent{yCross.tail<3>().normalized()};
+        const auto correction{-Distance(yCross) / surface.normal(yCross.head<3>()).dot(tangent)};
+        yCross.head<3>() += correction * tangent;
+        return std::pair{yCross, s + sCross + correction};
+    }
+    return std::nullopt;
+}
+
+auto TrackExtrapolator::Step(const Vector6d& y, int charge, double ds) const -> Vector6d {
+    switch (fFieldModel) {
+    case FieldModel::Uniform:
+        return HelixStep(y, charge, ds);
+    case FieldModel::FieldMap:
+        return RungeKuttaStep(y, charge, ds);
+    }
+    muc::unreachable();
+}
+
+auto TrackExtrapolator::HelixStep(const Vector6d& y, int charge, double ds) const -> Vector6d {
+    // du/ds = a * (uy, -ux, 0) in a uniform field along z
+    using Mustard::PhysicalConstant::c_light;
+    const Eigen::Vector3d u{y.tail<3>().normalized()};
+    const auto a{charge * c_light * fFastField / y.tail<3>().norm()};
+    const auto phi{a * ds};
+    Vector6d next{y};
+    if (std::abs(phi) < 1e-9) {
+        next.head<3>() += ds * u;
+        return next;
+    }
+    const auto cosPhi{std::cos(phi)};
+    const auto sinPhi{std::sin(phi)};
+    next[0] += (u[0] * sinPhi + u[1] * (1 - cosPhi)) / a;
+    next[1] += (u[1] * sinPhi - u[0] * (1 - cosPhi)) / a;
+    next[2] += u[2] * ds;
+    next[3] = y[3] * cosPhi + y[4] * sinPhi;
+    next[4] = y[4] * cosPhi - y[3] * sinPhi;
+    return next;
+}
+
+auto TrackExtrapolator::RungeKuttaStep(const Vector6d& y, int charge, double ds) const -> Vector6d {
+    // dx/ds = u, dp/ds = q c u x B
+    using Mustard::PhysicalConstant::c_light;
+    const auto Derivative{[&](const Vector6d& state) {
+        const Eigen::Vector3d u{state.tail<3>().normalized()};
+        const auto b{fField->B<muc::array3d>({state[0], state[1], state[2]})};
+        const Eigen::Vector3d bVector{b[0], b[1], b[2]};
+        Vector6d derivative;
+        derivative.head<3>() = u;
+        derivative.tail<3>() = charge * c_light * u.cross(bVector);
+        return derivative;
+    }};
+    const Vector6d k1{Derivative(y)};
+    const Vector6d k2{Derivative(y + ds / 2 * k1)};
+    const Vector6d k3{Derivative(y + ds / 2 * k2)};
+    const Vector6d k4{Derivative(y + ds * k3)};
+    return y + ds / 6 * (k1 + 2 * k2 + 2 * k3 + k4);
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Extrapolator
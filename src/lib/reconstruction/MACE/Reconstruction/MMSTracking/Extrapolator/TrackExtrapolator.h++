@@ -0,0 +1,125 @@
+#pragma once
+
+#include "MACE/Data/MMSTrack.h++"
+#include "MACE/Detector/Field/MMSField.h++"
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/Covariance.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Utility/PhysicalConstant.h++"
+
+#include "Eigen/Core"
+
+#include "muc/array"
+
+#include <functional>
+#include <optional>
+#include <utility>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Extrapolator {
+
+/// @brief Propagates a track state and its covariance to a surface (a plane, a cylinder
+/// coaxial with z or a sphere), without GenFit.
+///
+/// The state is transported either analytically as a helix in the MMS fast (uniform) field,
+/// or by Runge-Kutta (RK4) integration in the MMS field (the map, as chosen by FieldOption).
+/// The direction (along or against the momentum) is the one approaching the surface.
+/// The covariance is transported by the Jacobian of the state on the surface w.r.t. the
+/// initial state, from central differences. Energy loss and multiple scattering are not
+/// included.
+class TrackExtrapolator {
+public:
+    enum struct FieldModel {
+        Uniform,
+        FieldMap
+    };
+
+    struct Plane {
+        muc::array3d point;
+        muc::array3d normal;
+    };
+
+    /// @brief Cylinder coaxial with the z axis.
+    struct Cylinder {
+        double radius;
+    };
+
+    struct Sphere {
+        muc::array3d center;
+        double radius;
+    };
+
+    /// @brief Charge (in e) and mass of the extrapolated particle.
+    struct Particle {
+        int charge;
+        double mass;
+    };
+
+    struct State {
+        double t;
+        double s;
+        muc::array3d x;
+        muc::array3d p;
+        Eigen::Matrix<double, 6, 6> cov; ///< over (x, y, z, px, py, pz)
+    };
+
+public:
+    explicit TrackExtrapolator(FieldModel fieldModel = FieldModel::FieldMap);
+
+    auto TheFieldModel() const -> auto { return fFieldModel; }
+    auto StepLength() const -> auto { return fStepLength; }
+    auto MaxPathLength() const -> auto { return fMaxPathLength; }
+    auto Tolerance() const -> auto { return fTolerance; }
+
+    auto StepLength(double val) -> void { fStepLength = val; }
+    auto MaxPathLength(double val) -> void { fMaxPathLength = val; }
+    auto Tolerance(double val) -> void { fTolerance = val; }
+
+    /// @brief Downstream face of the target (the plane through the target center for non-cuboid targets).
+    static auto TargetPlane() -> Plane;
+    /// @brief Front face of the MCP.
+    static auto MCPPlane() -> Plane;
+    /// @brief Charge and mass of a particle by PDG ID (from TDatabasePDG, as GenFit does), nullopt if unknown.
+    static auto ParticleOf(int pdgID) -> std::optional<Particle>;
+
+    /// @brief Extrapolate a state of a particle with charge (in e) and mass to the surface.
+    /// @return The state on the surface, or nullopt if the surface is not reached within MaxPathLength.
+    auto Extrapolate(const State& state, int charge, double mass, const Plane& plane) const -> std::optional<State>;
+    auto Extrapolate(const State& state, int charge, double mass, const Cylinder& cylinder) const -> std::optional<State>;
+    auto Extrapolate(const State& state, int charge, double mass, const Sphere& sphere) const -> std::optional<State>;
+    /// @brief Extrapolate the vertex state of an MMS track to the surface, with the charge and mass
+    /// of its particle (nullopt if the PDG ID is unknown). The vertex covariance follows from the
+    /// helix covariance ("cov"), zero if it is unknown.
+    template<Mustard::Data::SuperTupleModel<Data::MMSTrack> ATrack, typename ASurface>
+    auto Extrapolate(const Mustard::Data::Tuple<ATrack>& track, const ASurface& surface) const -> std::optional<State>;
+
+private:
+    using Vector6d = Eigen::Matrix<double, 6, 1>; ///< (x, y, z, px, py, pz)
+
+    /// @brief A surface as the zero of a signed distance (negative on one side), and its gradient.
+    struct Surface {
+        std::function<double(const Eigen::Vector3d&)> distance;
+        std::function<Eigen::Vector3d(const Eigen::Vector3d&)> normal;
+    };
+
+private:
+    auto Extrapolate(const State& state, int charge, double mass, const Surface& surface) const -> std::optional<State>;
+    auto Transport(const Vector6d& y0, int charge, double direction, const Surface& surface) const
+        -> std::optional<std::pair<Vector6d, double>>;
+    auto Step(const Vector6d& y, int charge, double ds) const -> Vector6d;
+    auto HelixStep(const Vector6d& y, int charge, double ds) const -> Vector6d;
+    auto RungeKuttaStep(const Vector6d& y, int charge, double ds) const -> Vector6d;
+
+private:
+    FieldModel fFieldModel;
+    double fStepLength;
+    double fMaxPathLength;
+    double fTolerance;
+
+    double fFastField;
+    std::optional<Detector::Field::MMSField> fField;
+};
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Extrapolator
+
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/TrackExtrapolator.inl"
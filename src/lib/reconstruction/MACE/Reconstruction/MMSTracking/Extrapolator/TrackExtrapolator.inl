@@ -0,0 +1,21 @@
+namespace MACE::inline Reconstruction::MMSTracking::inline Extrapolator {
+
+template<Mustard::Data::SuperTupleModel<Data::MMSTrack> ATrack, typename ASurface>
+auto TrackExtrapolator::Extrapolate(const Mustard::Data::Tuple<ATrack>& track, const ASurface& surface) const -> std::optional<State> {
+    const auto particle{ParticleOf(Get<"PDGID">(track))};
+    if (not particle) {
+        return std::nullopt;
+    }
+    // the helix parameters are in the sign convention of Data::CalculateHelix
+    const auto helixCharge{Get<"PDGID">(track) > 0 ? -1 : 1};
+    const auto jacobian{VertexJacobian(*Get<"r0">(track), *Get<"phi0">(track), *Get<"theta0">(track), helixCharge, fFastField)};
+    State vertex;
+    vertex.t = *Get<"t0">(track);
+    vertex.s = 0;
+    vertex.x = Get<"x0">(track).template As<muc::array3d>();
+    vertex.p = Get<"p0">(track).template As<muc::array3d>();
+    vertex.cov = jacobian * UnpackCovariance<5>(*Get<"cov">(track)) * jacobian.transpose();
+    return Extrapolate(vertex, particle->charge, particle->mass, surface);
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Extrapolator
@@ -6,6 +6,7 @@
 #include "MACE/Detector/Definition/CDCGas.h++"
 #include "MACE/Detector/Definition/CDCSuperLayer.h++"
 #include "MACE/Detector/Definition/World.h++"
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/Covariance.h++"
 #include "MACE/Reconstruction/MMSTracking/Field/GenFitMMSField.h++"
 #include "MACE/Reconstruction/MMSTracking/Fitter/FitterBase.h++"
 
@@ -35,6 +36,8 @@
 
 #include "CLHEP/Units/SystemOfUnits.h"
 
+#include "Eigen/Core"
+
 #include "TDatabasePDG.h"
 #include "TGeoManager.h"
 #include "TMatrixDSymfwd.h"
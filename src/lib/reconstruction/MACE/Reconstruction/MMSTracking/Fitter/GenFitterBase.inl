@@ -175,7 +175,21 @@ auto GenFitterBase<AHit, ATrack, AFitter>::Finalize(std::shared_ptr<genfit::Trac
     Get<"x0">(*track) = this->template FromTVector3<muc::array3d>(x0);
     Get<"Ek0">(*track) = ek0;
     Get<"p0">(*track) = this->template FromTVector3<muc::array3d>(p0);
-    Data::CalculateHelix(*track, Detector::Description::MMSField::Instance().FastField());
+    const auto fastField{Detector::Description::MMSField::Instance().FastField()};
+    Data::CalculateHelix(*track, fastField);
+    // helix covariance, from position-momentum covariance at the first state
+    TVector3 position;
+    TVector3 momentum;
+    TMatrixDSym posMomCov(6);
+    firstState->getPosMomCov(position, momentum, posMomCov);
+    Eigen::Matrix<double, 6, 6> vertexCov;
+    for (gsl::index i{}; i < 6; ++i) {
+        for (gsl::index j{}; j < 6; ++j) {
+            vertexCov(i, j) = posMomCov(i, j) * (i < 3 ? CLHEP::cm : CLHEP::GeV) * (j < 3 ? CLHEP::cm : CLHEP::GeV);
+        }
+    }
+    const auto helixJacobian{HelixJacobian(this->template FromTVector3<muc::array3d>(p0), pdgID > 0 ? -1 : 1, fastField)};
+    Get<"cov">(*track) = PackCovariance<5>(helixJacobian * vertexCov * helixJacobian.transpose());
 
     if (fEnableEventDisplay) {
         genfit::EventDisplay::getInstance()->addEvent(genfitTrack.get());
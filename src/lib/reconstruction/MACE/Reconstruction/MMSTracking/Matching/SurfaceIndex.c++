@@ -0,0 +1,46 @@
+#include "MACE/Reconstruction/MMSTracking/Matching/SurfaceIndex.h++"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Matching {
+
+SurfaceIndex::SurfaceIndex(int nPhiBin, double wMin, double wMax, int nWBin) :
+    fNPhiBin{std::max(nPhiBin, 1)},
+    fWMin{wMin},
+    fWMax{wMax},
+    fNWBin{std::max(nWBin, 1)},
+    fBin(fNPhiBin * fNWBin) {}
+
+auto SurfaceIndex::Insert(int id, double phi, double w) -> void {
+    fBin[PhiBin(phi) * fNWBin + WBin(w)].emplace_back(id);
+}
+
+auto SurfaceIndex::Query(double phi, double w, double phiWindow, double wWindow) const -> std::vector<int> {
+    std::vector<int> id;
+    const auto phiBinWidth{2 * std::numbers::pi / fNPhiBin};
+    const auto nPhi{std::min(2 * static_cast<int>(std::ceil(phiWindow / phiBinWidth)) + 1, fNPhiBin)};
+    const auto firstPhiBin{PhiBin(phi) - nPhi / 2};
+    const auto wFirst{WBin(w - wWindow)};
+    const auto wLast{WBin(w + wWindow)};
+    for (int i{}; i < nPhi; ++i) {
+        const auto phiBin{((firstPhiBin + i) % fNPhiBin + fNPhiBin) % fNPhiBin};
+        for (auto wBin{wFirst}; wBin <= wLast; ++wBin) {
+            const auto& bin{fBin[phiBin * fNWBin + wBin]};
+            id.insert(id.end(), bin.cbegin(), bin.cend());
+        }
+    }
+    return id;
+}
+
+auto SurfaceIndex::PhiBin(double phi) const -> int {
+    const auto u{phi / (2 * std::numbers::pi)};
+    return std::clamp(static_cast<int>((u - std::floor(u)) * fNPhiBin), 0, fNPhiBin - 1);
+}
+
+auto SurfaceIndex::WBin(double w) const -> int {
+    return std::clamp(static_cast<int>(std::floor((w - fWMin) / (fWMax - fWMin) * fNWBin)), 0, fNWBin - 1);
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Matching
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vector>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Matching {
+
+/// @brief Grid index of detector elements on a surface parametrized by the azimuth and a second
+/// coordinate w (z on a barrel, cos(theta) on a sphere), for lookup of the elements near a point.
+/// Azimuth wraps around, w is clamped to its range.
+class SurfaceIndex {
+public:
+    SurfaceIndex(int nPhiBin, double wMin, double wMax, int nWBin);
+
+    auto Insert(int id, double phi, double w) -> void;
+    /// @brief IDs of elements with (phi, w) inside the window, possibly with a few from the edge bins.
+    auto Query(double phi, double w, double phiWindow, double wWindow) const -> std::vector<int>;
+
+private:
+    auto PhiBin(double phi) const -> int;
+    auto WBin(double w) const -> int;
+
+private:
+    int fNPhiBin;
+    double fWMin;
+    double fWMax;
+    int fNWBin;
+    std::vector<std::vector<int>> fBin; ///< [phi bin * nWBin + w bin]
+};
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Matching
@@ -0,0 +1,196 @@
+#include "MACE/Detector/Description/ECAL.h++"
+#include "MACE/Detector/Description/ECALField.h++"
+#include "MACE/Detector/Description/TTC.h++"
+#include "MACE/Reconstruction/MMSTracking/Matching/TrackMatcher.h++"
+
+#include "Mustard/Utility/LiteralUnit.h++"
+#include "Mustard/Utility/PhysicalConstant.h++"
+
+#include "Eigen/Geometry"
+
+#include "muc/math"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Matching {
+
+using namespace Mustard::LiteralUnit::Length;
+
+TrackMatcher::TrackMatcher(TrackExtrapolator::FieldModel fieldModel) :
+    fExtrapolator{fieldModel},
+    fMaxChi2{9},
+    fTTCResolution{2_mm},
+    fECALResolution{5_mm},
+    fTTCCylinder{},
+    fECALSphere{},
+    fTTC{},
+    fECAL{} {
+    BuildTTC();
+    BuildECAL();
+}
+
+auto TrackMatcher::BuildTTC() -> void {
+    const auto& ttc{Detector::Description::TTC::Instance()};
+    const auto& width{ttc.Width()};
+    const auto& position{ttc.Position()};
+    const auto nRing{std::ssize(width)};
+    const auto nAlongPhi{ttc.NAlongPhi()};
+    const auto deltaPhi{2 * std::numbers::pi / nAlongPhi};
+
+    auto zMin{std::numeric_limits<double>::max()};
+    auto zMax{std::numeric_limits<double>::lowest()};
+    for (gsl::index i{}; i < nRing; ++i) {
+        zMin = std::min(zMin, position[i][2] - width[i] / 2);
+        zMax = std::max(zMax, position[i][2] + width[i] / 2);
+    }
+
+    // tile ID is i * NAlongPhi + j, as placed in the TTC definition
+    FaceSet set{{}, SurfaceIndex{nAlongPhi, zMin, zMax, static_cast<int>(nRing)}, 0};
+    for (gsl::index i{}; i < nRing; ++i) {
+        for (int j{}; j < nAlongPhi; ++j) {
+            const auto phi{j * deltaPhi + (muc::even(i) ? 0 : deltaPhi / 2)};
+            const Eigen::Vector3d center{Eigen::AngleAxisd{phi, Eigen::Vector3d::UnitZ()} *
+                                         Eigen::Vector3d{position[i][0], position[i][1], position[i][2]}};
+            const auto slant{phi + ttc.SlantAngle()};
+            const Eigen::Vector3d normal{std::cos(slant), std::sin(slant), 0};
+            const Eigen::Vector3d along{-std::sin(slant) * ttc.Length() / 2, std::cos(slant) * ttc.Length() / 2, 0};
+            const Eigen::Vector3d across{0, 0, width[i] / 2};
+            set.index.Insert(set.face.size(), std::atan2(center.y(), center.x()), center.z());
+            set.face.push_back({center, normal,
+                                {center - along - across, center + along - across, center + along + across, center - along + across},
+                                std::hypot(ttc.Length(), width[i]) / 2});
+            set.size = std::max(set.size, set.face.back().size);
+        }
+    }
+    fTTCCylinder = {ttc.Radius()};
+    fTTC = std::move(set);
+}
+
+auto TrackMatcher::BuildECAL() -> void {
+    const auto& ecal{Detector::Description::ECAL::Instance()};
+    const auto& [vertexList, faceList]{ecal.Mesh()};
+    // crystals are placed in the ECAL field volume without rotation
+    const auto ecalCenter{Detector::Description::ECALField::Instance().Center()};
+    const Eigen::Vector3d origin{ecalCenter[0], ecalCenter[1], ecalCenter[2]};
+
+    std::vector<Face> face;
+    face.reserve(faceList.size());
+    double meanRadius{};
+    double maxSize{};
+    for (auto&& module : faceList) {
+        // inner face: the plane through the scaled centroid, cut by the vertex rays (as in ECALCrystal)
+        const Eigen::Vector3d centroid{module.centroid.x(), module.centroid.y(), module.centroid.z()};
+        const Eigen::Vector3d normal{Eigen::Vector3d{module.normal.x(), module.normal.y(), module.normal.z()}.normalized()};
+        const Eigen::Vector3d center{ecal.InnerRadius() * centroid};
+        std::vector<Eigen::Vector3d> vertex;
+        vertex.reserve(module.vertexIndex.size());
+        double size{};
+        for (auto i : module.vertexIndex) {
+            const Eigen::Vector3d ray{vertexList[i].x(), vertexList[i].y(), vertexList[i].z()};
+            const Eigen::Vector3d v{ray * normal.dot(center) / normal.dot(ray)};
+            size = std::max(size, (v - center).norm());
+            vertex.emplace_back(v + origin);
+        }
+        face.push_back({center + origin, normal, std::move(vertex), size});
+        meanRadius += center.norm() / faceList.size();
+        maxSize = std::max(maxSize, size);
+    }
+
+    const auto angularSize{maxSize / meanRadius};
+    FaceSet set{std::move(face),
+                SurfaceIndex{static_cast<int>(std::ceil(2 * std::numbers::pi / angularSize)), -1, 1,
+                             static_cast<int>(std::ceil(2 / angularSize))},
+                maxSize};
+    for (gsl::index moduleID{}; moduleID < std::ssize(set.face); ++moduleID) {
+        const Eigen::Vector3d direction{(set.face[moduleID].center - origin).normalized()};
+        set.index.Insert(moduleID, std::atan2(direction.y(), direction.x()), direction.z());
+    }
+    fECALSphere = {ecalCenter, meanRadius};
+    fECAL = std::move(set);
+}
+
+auto TrackMatcher::MatchTTC(int trkID, double mass, const TrackExtrapolator::State& state, std::vector<Match>& match) const -> void {
+    const auto sigma{std::sqrt(state.cov.topLeftCorner<3, 3>().trace() + muc::pow(fTTCResolution, 2))};
+    const auto window{fTTC->size + std::sqrt(fMaxChi2) * sigma};
+    const auto first{match.size()};
+    for (auto tileID : fTTC->index.Query(std::atan2(state.x[1], state.x[0]), state.x[2], window / fTTCCylinder.radius, window)) {
+        if (auto m{MatchFace(trkID, mass, state, fTTC->face[tileID], tileID, fTTCResolution)}) {
+            match.emplace_back(*m);
+        }
+    }
+    std::ranges::sort(match.begin() + first, match.end(), {}, &Match::chi2);
+}
+
+auto TrackMatcher::MatchECAL(int trkID, double mass, const TrackExtrapolator::State& state, std::vector<Match>& match) const -> void {
+    const auto sigma{std::sqrt(state.cov.topLeftCorner<3, 3>().trace() + muc::pow(fECALResolution, 2))};
+    const auto angularWindow{(fECAL->size + std::sqrt(fMaxChi2) * sigma) / fECALSphere.radius};
+    const Eigen::Vector3d direction{Eigen::Vector3d{state.x[0] - fECALSphere.center[0],
+                                                    state.x[1] - fECALSphere.center[1],
+                                                    state.x[2] - fECALSphere.center[2]}
+                                        .normalized()};
+    const auto sinTheta{direction.head<2>().norm()};
+    const auto phiWindow{sinTheta > angularWindow ? angularWindow / sinTheta : std::numbers::pi};
+    const auto first{match.size()};
+    for (auto moduleID : fECAL->index.Query(std::atan2(direction.y(), direction.x()), direction.z(), phiWindow, angularWindow)) {
+        if (auto m{MatchFace(trkID, mass, state, fECAL->face[moduleID], moduleID, fECALResolution)}) {
+            match.emplace_back(*m);
+        }
+    }
+    std::ranges::sort(match.begin() + first, match.end(), {}, &Match::chi2);
+}
+
+auto TrackMatcher::MatchFace(int trkID, double mass, const TrackExtrapolator::State& state, const Face& face, int faceID, double resolution) const -> std::optional<Match> {
+    const Eigen::Vector3d x{state.x[0], state.x[1], state.x[2]};
+    const Eigen::Vector3d p{state.p[0], state.p[1], state.p[2]};
+    const Eigen::Vector3d u{p.normalized()};
+    const auto cosIncidence{face.normal.dot(u)};
+    if (std::abs(cosIncidence) < 1e-3) {
+        return std::nullopt;
+    }
+    // straight onto the face plane, the face is close to the surface the state is on
+    const auto ds{face.normal.dot(face.center - x) / cosIncidence};
+    const Eigen::Vector3d xFace{x + ds * u};
+    const Eigen::Matrix3d projector{Eigen::Matrix3d::Identity() - u * face.normal.transpose() / cosIncidence};
+    const Eigen::Matrix3d cov{projector * state.cov.topLeftCorner<3, 3>() * projector.transpose()};
+
+    // nearest point on the polygon boundary, and whether the point is inside (same side of every edge)
+    const auto nVertex{std::ssize(face.vertex)};
+    auto minDistance2{std::numeric_limits<double>::max()};
+    Eigen::Vector3d nearest{xFace};
+    int nLeft{};
+    int nRight{};
+    for (gsl::index i{}; i < nVertex; ++i) {
+        const auto& a{face.vertex[i]};
+        const Eigen::Vector3d edge{face.vertex[(i + 1) % nVertex] - a};
+        const Eigen::Vector3d toPoint{xFace - a};
+        (face.normal.dot(edge.cross(toPoint)) > 0 ? nLeft : nRight)++;
+        const Eigen::Vector3d q{a + std::clamp(edge.dot(toPoint) / edge.squaredNorm(), 0., 1.) * edge};
+        if (const auto distance2{(xFace - q).squaredNorm()};
+            distance2 < minDistance2) {
+            minDistance2 = distance2;
+            nearest = q;
+        }
+    }
+
+    double chi2{};
+    if (nLeft != nVertex and nRight != nVertex) {
+        const Eigen::Vector3d d{xFace - nearest};
+        const Eigen::Vector3d dHat{d.normalized()};
+        chi2 = d.squaredNorm() / (dHat.dot(cov * dHat) + muc::pow(resolution, 2));
+    }
+    if (chi2 > fMaxChi2) {
+        return std::nullopt;
+    }
+
+    using Mustard::PhysicalConstant::c_light;
+    const auto pMag{p.norm()};
+    const auto t{state.t + ds * std::sqrt(muc::pow(pMag, 2) + muc::pow(mass, 2)) / (pMag * c_light)};
+    return Match{trkID, faceID, chi2, t, {xFace.x(), xFace.y(), xFace.z()}};
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Matching
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "MACE/Data/Cluster.h++"
+#include "MACE/Data/MMSTrack.h++"
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/TrackExtrapolator.h++"
+#include "MACE/Reconstruction/MMSTracking/Matching/SurfaceIndex.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include "Eigen/Core"
+
+#include "muc/array"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace MACE::inline Reconstruction::MMSTracking::inline Matching {
+
+/// @brief Matches MMS tracks to TTC tiles and ECAL modules by extrapolation through the MMS field.
+///
+/// A track is extrapolated from its vertex to the TTC barrel radius, and onward to the ECAL
+/// inner sphere. Tiles and modules near the crossing point are looked up in a SurfaceIndex,
+/// and the crossing point is carried along the track direction onto each of their faces.
+/// The matching distance is a chi2 of the distance from that point to the face (zero inside),
+/// with the extrapolated position covariance and a resolution floor added in quadrature.
+/// The floor stands for what the extrapolation does not model: multiple scattering, and the
+/// field beyond the MMS field map.
+class TrackMatcher {
+public:
+    struct Match {
+        int trkID;
+        int detectorID;  ///< TTC tile ID or ECAL module ID
+        double chi2;     ///< 0 if the track crosses the face
+        double t;        ///< track time at the face
+        muc::array3d x;  ///< track position on the face
+    };
+
+    struct EventMatch {
+        std::vector<Match> ttc;  ///< in track order, by increasing chi2 for each track
+        std::vector<Match> ecal; ///< in track order, by increasing chi2 for each track
+    };
+
+public:
+    explicit TrackMatcher(TrackExtrapolator::FieldModel fieldModel = TrackExtrapolator::FieldModel::FieldMap);
+
+    auto TheExtrapolator() const -> const auto& { return fExtrapolator; }
+    auto TheExtrapolator() -> auto& { return fExtrapolator; }
+    auto MaxChi2() const -> auto { return fMaxChi2; }
+    auto TTCResolution() const -> auto { return fTTCResolution; }
+    auto ECALResolution() const -> auto { return fECALResolution; }
+
+    auto MaxChi2(double val) -> void { fMaxChi2 = val; }
+    auto TTCResolution(double val) -> void { fTTCResolution = val; }
+    auto ECALResolution(double val) -> void { fECALResolution = val; }
+
+    /// @brief Match all tracks of an event, with the charge and mass of each track's particle
+    /// (tracks of unknown PDG ID are skipped).
+    /// Tracks are extrapolated one at a time: there are few per event, and each extrapolation
+    /// is a sequential stepping with its own surface crossings, so events (not tracks) are the
+    /// unit of parallelism, as in the other reconstruction apps.
+    template<Mustard::Data::SuperTupleModel<Data::MMSTrack> ATrack>
+    auto operator()(const std::vector<std::shared_ptr<Mustard::Data::Tuple<ATrack>>>& track) const -> EventMatch;
+
+    /// @brief The best (least chi2) ECAL match with any module of each cluster, nullopt if none.
+    template<Mustard::Data::SuperTupleModel<Data::ECALCluster> ACluster>
+    static auto ClusterMatch(const std::vector<Match>& ecalMatch,
+                             const std::vector<std::shared_ptr<Mustard::Data::Tuple<ACluster>>>& cluster) -> std::vector<std::optional<Match>>;
+
+private:
+    /// @brief A tile or module face, as a convex polygon.
+    struct Face {
+        Eigen::Vector3d center;
+        Eigen::Vector3d normal;
+        std::vector<Eigen::Vector3d> vertex; ///< in order around the polygon
+        double size;                         ///< largest distance from the center to a vertex
+    };
+
+    struct FaceSet {
+        std::vector<Face> face;
+        SurfaceIndex index;
+        double size; ///< largest face size
+    };
+
+private:
+    auto BuildTTC() -> void;
+    auto BuildECAL() -> void;
+    auto MatchTTC(int trkID, double mass, const TrackExtrapolator::State& state, std::vector<Match>& match) const -> void;
+    auto MatchECAL(int trkID, double mass, const TrackExtrapolator::State& state, std::vector<Match>& match) const -> void;
+    auto MatchFace(int trkID, double mass, const TrackExtrapolator::State& state, const Face& face, int faceID, double resolution) const -> std::optional<Match>;
+
+private:
+    TrackExtrapolator fExtrapolator;
+    double fMaxChi2;
+    double fTTCResolution;
+    double fECALResolution;
+
+    TrackExtrapolator::Cylinder fTTCCylinder;
+    TrackExtrapolator::Sphere fECALSphere;
+    std::optional<FaceSet> fTTC;
+    std::optional<FaceSet> fECAL;
+};
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Matching
+
+#include "MACE/Reconstruction/MMSTracking/Matching/TrackMatcher.inl"
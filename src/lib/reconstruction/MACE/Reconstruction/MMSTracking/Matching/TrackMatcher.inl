@@ -0,0 +1,43 @@
+namespace MACE::inline Reconstruction::MMSTracking::inline Matching {
+
+template<Mustard::Data::SuperTupleModel<Data::MMSTrack> ATrack>
+auto TrackMatcher::operator()(const std::vector<std::shared_ptr<Mustard::Data::Tuple<ATrack>>>& track) const -> EventMatch {
+    EventMatch match;
+    for (auto&& t : track) {
+        const auto particle{TrackExtrapolator::ParticleOf(*Get<"PDGID">(*t))};
+        if (not particle) {
+            continue;
+        }
+        const auto trkID{*Get<"TrkID">(*t)};
+        const auto ttcState{fExtrapolator.Extrapolate(*t, fTTCCylinder)};
+        if (ttcState) {
+            MatchTTC(trkID, particle->mass, *ttcState, match.ttc);
+        }
+        // onward from the TTC if the track gets there, the ECAL may still be reached otherwise
+        const auto ecalState{ttcState ?
+                                 fExtrapolator.Extrapolate(*ttcState, particle->charge, particle->mass, fECALSphere) :
+                                 fExtrapolator.Extrapolate(*t, fECALSphere)};
+        if (ecalState) {
+            MatchECAL(trkID, particle->mass, *ecalState, match.ecal);
+        }
+    }
+    return match;
+}
+
+template<Mustard::Data::SuperTupleModel<Data::ECALCluster> ACluster>
+auto TrackMatcher::ClusterMatch(const std::vector<Match>& ecalMatch,
+                                const std::vector<std::shared_ptr<Mustard::Data::Tuple<ACluster>>>& cluster) -> std::vector<std::optional<Match>> {
+    std::vector<std::optional<Match>> best(cluster.size());
+    for (std::size_t i{}; i < cluster.size(); ++i) {
+        const auto& moduleID{*Get<"ModID">(*cluster[i])};
+        for (auto&& m : ecalMatch) {
+            if (std::ranges::find(moduleID, m.detectorID) != moduleID.cend() and
+                (not best[i] or m.chi2 < best[i]->chi2)) {
+                best[i] = m;
+            }
+        }
+    }
+    return best;
+}
+
+} // namespace MACE::inline Reconstruction::MMSTracking::inline Matching
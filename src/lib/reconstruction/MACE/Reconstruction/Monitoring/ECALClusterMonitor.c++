@@ -0,0 +1,66 @@
+#include "MACE/Detector/Description/ECAL.h++"
+#include "MACE/Reconstruction/Monitoring/ECALClusterMonitor.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+
+#include "muc/math"
+
+#include <algorithm>
+#include <cmath>
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+using namespace Mustard::LiteralUnit::Energy;
+
+ECALClusterMonitor::ECALClusterMonitor() :
+    fModuleCentroid{},
+    fHistogram{} {
+    const auto& faceList{Detector::Description::ECAL::Instance().Mesh().faceList};
+    fModuleCentroid.reserve(faceList.size());
+    for (auto&& face : faceList) {
+        fModuleCentroid.push_back({face.centroid.x(), face.centroid.y(), face.centroid.z()});
+    }
+
+    fHistogram.reserve(kNHistogram);
+    fHistogram.emplace_back("ECALResidualE", "Cluster energy residual;(E - E^{true}) / E^{true}", 200, -1, 1);
+    fHistogram.emplace_back("ECALResidualAngle", "Cluster direction residual;#angle(x, x^{true}) (rad)", 200, 0, 0.2);
+    fHistogram.emplace_back("ECALFakeRateEPassed", "Fake clusters;E (MeV)", 120, 0, 1.2);
+    fHistogram.emplace_back("ECALFakeRateETotal", "Clusters;E (MeV)", 120, 0, 1.2);
+    fHistogram.emplace_back("ECALContainment", "Energy containment;#sumE / #sumE_{dep}^{true}", 120, 0, 1.2);
+}
+
+auto ECALClusterMonitor::Merge() -> void {
+    for (auto&& histogram : fHistogram) {
+        histogram.Merge();
+    }
+}
+
+auto ECALClusterMonitor::Write() const -> void {
+    for (auto&& histogram : fHistogram) {
+        histogram.ToTH1D()->Write();
+    }
+}
+
+auto ECALClusterMonitor::Print() const -> void {
+    const auto nCluster{fHistogram[kFakeRateETotal].Entries()};
+    Mustard::MasterPrintLn("ECAL clusters {}, fake rate {:.4f}, energy resolution {:.4g}, containment {:.4f}",
+                           nCluster, nCluster > 0 ? fHistogram[kFakeRateEPassed].Entries() / nCluster : 0.,
+                           fHistogram[kResidualE].RMS(), fHistogram[kContainment].Mean());
+}
+
+auto ECALClusterMonitor::FillCluster(double e, const muc::array3d& x, double eTrue, const muc::array3d& xTrue) -> void {
+    fHistogram[kFakeRateETotal].Fill(e / 1_MeV);
+    if (eTrue <= 0) {
+        fHistogram[kFakeRateEPassed].Fill(e / 1_MeV);
+        return;
+    }
+    fHistogram[kResidualE].Fill((e - eTrue) / eTrue);
+    const auto norm{muc::hypot(x[0], x[1], x[2]) * muc::hypot(xTrue[0], xTrue[1], xTrue[2])};
+    if (norm > 0) {
+        const auto cosAngle{(x[0] * xTrue[0] + x[1] * xTrue[1] + x[2] * xTrue[2]) / norm};
+        fHistogram[kResidualAngle].Fill(std::acos(std::clamp(cosAngle, -1., 1.)));
+    }
+}
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
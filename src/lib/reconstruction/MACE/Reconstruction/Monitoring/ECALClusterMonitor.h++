@@ -0,0 +1,59 @@
+#pragma once
+
+#include "MACE/Data/Cluster.h++"
+#include "MACE/Data/Hit.h++"
+#include "MACE/Reconstruction/Monitoring/Histogram.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include "muc/array"
+#include "muc/hash_map"
+
+#include <memory>
+#include <vector>
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+/// @brief Figures of merit of reconstructed ECAL clusters against the simulated energy deposition.
+///
+/// The truth of a cluster is the simulated energy deposited in its modules, located at the
+/// energy-weighted module face centroid (the same estimator as the reconstruction, applied to the
+/// true deposits). Clusters without any true deposit are fakes. The containment is the
+/// reconstructed energy of all clusters over the total true deposit of the event.
+/// Fill is thread-safe; Merge is collective over MPI_COMM_WORLD.
+class ECALClusterMonitor {
+public:
+    ECALClusterMonitor();
+
+    template<Mustard::Data::SuperTupleModel<Data::ECALCluster> ACluster, Mustard::Data::SuperTupleModel<Data::ECALHit> AHit>
+    auto Fill(const std::vector<std::shared_ptr<Mustard::Data::Tuple<ACluster>>>& cluster,
+              const std::vector<std::shared_ptr<Mustard::Data::Tuple<AHit>>>& simHit) -> void;
+
+    auto HistogramList() const -> const auto& { return fHistogram; }
+    auto Merge() -> void;
+    /// @brief Write histograms (as TH1D) into the current directory.
+    auto Write() const -> void;
+    auto Print() const -> void;
+
+private:
+    enum HistogramIndex {
+        kResidualE,
+        kResidualAngle,
+        kFakeRateEPassed,
+        kFakeRateETotal,
+        kContainment,
+        kNHistogram
+    };
+
+private:
+    auto FillCluster(double e, const muc::array3d& x, double eTrue, const muc::array3d& xTrue) -> void;
+
+private:
+    std::vector<muc::array3d> fModuleCentroid;
+    std::vector<Histogram> fHistogram;
+};
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
+
+#include "MACE/Reconstruction/Monitoring/ECALClusterMonitor.inl"
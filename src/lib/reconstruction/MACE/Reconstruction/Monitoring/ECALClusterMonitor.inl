@@ -0,0 +1,42 @@
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+template<Mustard::Data::SuperTupleModel<Data::ECALCluster> ACluster, Mustard::Data::SuperTupleModel<Data::ECALHit> AHit>
+auto ECALClusterMonitor::Fill(const std::vector<std::shared_ptr<Mustard::Data::Tuple<ACluster>>>& cluster,
+                              const std::vector<std::shared_ptr<Mustard::Data::Tuple<AHit>>>& simHit) -> void {
+    muc::flat_hash_map<short, double> eTrueOfModule;
+    double eTrueTotal{};
+    for (auto&& hit : simHit) {
+        eTrueOfModule[*Get<"ModID">(*hit)] += *Get<"Edep">(*hit);
+        eTrueTotal += *Get<"Edep">(*hit);
+    }
+
+    double eTotal{};
+    for (auto&& c : cluster) {
+        double eTrue{};
+        muc::array3d xTrue{};
+        for (auto modID : *Get<"ModID">(*c)) {
+            const auto m{eTrueOfModule.find(modID)};
+            if (m == eTrueOfModule.cend() or modID < 0 or modID >= std::ssize(fModuleCentroid)) {
+                continue;
+            }
+            eTrue += m->second;
+            for (int i{}; i < 3; ++i) {
+                xTrue[i] += m->second * fModuleCentroid[modID][i];
+            }
+        }
+        if (eTrue > 0) {
+            for (auto&& x : xTrue) {
+                x /= eTrue;
+            }
+        }
+        const double e{*Get<"Edep">(*c)};
+        eTotal += e;
+        FillCluster(e, Get<"x">(*c).template As<muc::array3d>(), eTrue, xTrue);
+    }
+
+    if (eTrueTotal > 0) {
+        fHistogram[kContainment].Fill(eTotal / eTrueTotal);
+    }
+}
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
@@ -0,0 +1,88 @@
+#include "MACE/Reconstruction/Monitoring/Histogram.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "mpi.h"
+
+#include "muc/math"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+Histogram::Histogram(std::string name, std::string title, int nBin, double low, double up) :
+    fName{std::move(name)},
+    fTitle{std::move(title)},
+    fNBin{nBin},
+    fLow{low},
+    fUp{up},
+    fAccumulator{} {
+    if (fNBin < 1 or not(fLow < fUp)) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Invalid binning of histogram '{}' ({} bins in [{}, {}))", fName, fNBin, fLow, fUp));
+    }
+    fAccumulator = std::make_unique<std::atomic<double>[]>(NAccumulator());
+}
+
+auto Histogram::Fill(double x, double weight) -> void {
+    const auto Add{[this](int i, double value) { fAccumulator[i].fetch_add(value, std::memory_order_relaxed); }};
+    const auto statistic{2 * (fNBin + 2)};
+    Add(statistic + kEntries, 1);
+    const auto inRange{fLow <= x and x < fUp};
+    const auto bin{inRange ? std::clamp(1 + static_cast<int>((x - fLow) / (fUp - fLow) * fNBin), 1, fNBin) :
+                             (x < fLow ? 0 : fNBin + 1)};
+    Add(bin, weight);
+    Add(fNBin + 2 + bin, weight * weight);
+    if (not inRange) {
+        return;
+    }
+    Add(statistic + kSumW, weight);
+    Add(statistic + kSumW2, weight * weight);
+    Add(statistic + kSumWX, weight * x);
+    Add(statistic + kSumWX2, weight * x * x);
+}
+
+auto Histogram::Mean() const -> double {
+    const auto sumW{Statistic(kSumW)};
+    return sumW != 0 ? Statistic(kSumWX) / sumW : 0;
+}
+
+auto Histogram::RMS() const -> double {
+    const auto sumW{Statistic(kSumW)};
+    return sumW != 0 ? std::sqrt(std::max(0., Statistic(kSumWX2) / sumW - muc::pow(Mean(), 2))) : 0;
+}
+
+auto Histogram::Merge() -> void {
+    std::vector<double> value(NAccumulator());
+    for (int i{}; i < NAccumulator(); ++i) {
+        value[i] = fAccumulator[i].load(std::memory_order_relaxed);
+    }
+    MPI_Allreduce(MPI_IN_PLACE, value.data(), value.size(), MPI_DOUBLE, MPI_SUM, mplr::comm_world().native_handle());
+    for (int i{}; i < NAccumulator(); ++i) {
+        fAccumulator[i].store(value[i], std::memory_order_relaxed);
+    }
+}
+
+auto Histogram::ToTH1D() const -> std::unique_ptr<TH1D> {
+    auto histogram{std::make_unique<TH1D>(fName.c_str(), fTitle.c_str(), fNBin, fLow, fUp)};
+    histogram->SetDirectory(nullptr);
+    histogram->Sumw2();
+    for (int i{}; i < fNBin + 2; ++i) {
+        histogram->SetBinContent(i, fAccumulator[i].load(std::memory_order_relaxed));
+        histogram->SetBinError(i, std::sqrt(fAccumulator[fNBin + 2 + i].load(std::memory_order_relaxed)));
+    }
+    std::array<double, 4> stats{Statistic(kSumW), Statistic(kSumW2), Statistic(kSumWX), Statistic(kSumWX2)};
+    histogram->PutStats(stats.data());
+    histogram->SetEntries(Statistic(kEntries));
+    return histogram;
+}
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "TH1.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+/// @brief Fixed-binning 1-D histogram that can be filled from several threads at once and summed
+/// over MPI processes.
+///
+/// Bin contents and statistics are atomics, so Fill takes no lock. Statistics (mean, RMS) cover
+/// the in-range entries only, as in TH1. Merge() sums everything over MPI_COMM_WORLD; it is
+/// collective, and no thread may fill during it.
+class Histogram {
+public:
+    Histogram(std::string name, std::string title, int nBin, double low, double up);
+
+    auto Name() const -> const auto& { return fName; }
+    auto Title() const -> const auto& { return fTitle; }
+    auto NBin() const -> auto { return fNBin; }
+
+    auto Fill(double x, double weight = 1) -> void;
+
+    auto Entries() const -> double { return Statistic(kEntries); }
+    auto SumW() const -> double { return Statistic(kSumW); }
+    auto Mean() const -> double;
+    auto RMS() const -> double;
+
+    auto Merge() -> void;
+    auto ToTH1D() const -> std::unique_ptr<TH1D>;
+
+private:
+    enum StatisticIndex {
+        kSumW,
+        kSumW2,
+        kSumWX,
+        kSumWX2,
+        kEntries,
+        kNStatistic
+    };
+
+private:
+    auto Statistic(StatisticIndex i) const -> double { return fAccumulator[2 * (fNBin + 2) + i].load(std::memory_order_relaxed); }
+    auto NAccumulator() const -> int { return 2 * (fNBin + 2) + kNStatistic; }
+
+private:
+    std::string fName;
+    std::string fTitle;
+    int fNBin;
+    double fLow;
+    double fUp;
+    /// bin sum of weights in [0, nBin + 2), bin sum of squared weights in [nBin + 2, 2 (nBin + 2)), then the statistics
+    std::unique_ptr<std::atomic<double>[]> fAccumulator;
+};
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
@@ -0,0 +1,194 @@
+#include "MACE/Reconstruction/Monitoring/RegressionTest.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "TClass.h"
+#include "TDirectory.h"
+#include "TH1.h"
+#include "TKey.h"
+#include "TMath.h"
+
+#include "muc/math"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string_view>
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+namespace {
+
+/// @brief |a - b| / sigma, zero if identical and infinity if different with no spread.
+auto Significance(double a, double b, double variance) -> double {
+    if (a == b) {
+        return 0;
+    }
+    return variance > 0 ? std::abs(a - b) / std::sqrt(variance) : std::numeric_limits<double>::infinity();
+}
+
+} // namespace
+
+RegressionTest::RegressionTest(double suspiciousZ, double failedZ) :
+    fSuspiciousZ{suspiciousZ},
+    fFailedZ{failedZ} {
+    if (not(0 < fSuspiciousZ and fSuspiciousZ <= fFailedZ)) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Invalid Z thresholds (suspicious {}, failed {})", fSuspiciousZ, fFailedZ));
+    }
+}
+
+auto RegressionTest::Compare(TDirectory& reference, TDirectory& test) const -> std::vector<Result> {
+    std::vector<Result> result;
+    Compare(reference, test, {}, result);
+    return result;
+}
+
+auto RegressionTest::Judge(double z) const -> Verdict {
+    if (not(z <= fFailedZ)) { // NaN fails
+        return Verdict::Failed;
+    }
+    if (z > fSuspiciousZ) {
+        return Verdict::Suspicious;
+    }
+    return z > 0 ? Verdict::Passed : Verdict::Identical;
+}
+
+auto RegressionTest::Worst(const std::vector<Result>& result) -> Verdict {
+    auto worst{Verdict::Identical};
+    for (auto&& r : result) {
+        worst = std::max(worst, r.verdict);
+    }
+    return worst;
+}
+
+auto RegressionTest::Print(const std::vector<Result>& result) -> void {
+    constexpr std::string_view verdictName[]{"IDENTICAL", "PASSED", "SUSPICIOUS", "FAILED"};
+    Mustard::MasterPrintLn("{:<48} {:<10} {:>10} {:>10}", "Histogram", "Test", "Z", "Verdict");
+    for (auto&& [name, test, z, verdict] : result) {
+        Mustard::MasterPrintLn("{:<48} {:<10} {:>10.3g} {:>10}", name, test, z, verdictName[static_cast<int>(verdict)]);
+    }
+}
+
+auto RegressionTest::Compare(TDirectory& reference, TDirectory& test, const std::string& path, std::vector<Result>& result) const -> void {
+    const auto KeyNameSet{[](TDirectory& directory) {
+        std::set<std::string> name;
+        for (auto&& key : *directory.GetListOfKeys()) {
+            name.emplace(key->GetName());
+        }
+        return name;
+    }};
+    const auto referenceName{KeyNameSet(reference)};
+    const auto testName{KeyNameSet(test)};
+
+    for (auto&& name : testName) {
+        if (not referenceName.contains(name)) {
+            result.push_back({path + name, "missing", std::numeric_limits<double>::infinity(), Verdict::Failed});
+        }
+    }
+
+    const auto IsDirectory{[](TDirectory& directory, const std::string& name) {
+        const auto objectClass{TClass::GetClass(directory.GetKey(name.c_str())->GetClassName())};
+        return objectClass and objectClass->InheritsFrom(TDirectory::Class());
+    }};
+    const auto Read{[](TDirectory& directory, const std::string& name) {
+        return std::unique_ptr<TObject>{directory.GetKey(name.c_str())->ReadObj()};
+    }};
+    for (auto&& name : referenceName) {
+        if (not testName.contains(name)) {
+            result.push_back({path + name, "missing", std::numeric_limits<double>::infinity(), Verdict::Failed});
+            continue;
+        }
+        if (const auto referenceIsDirectory{IsDirectory(reference, name)};
+            referenceIsDirectory or IsDirectory(test, name)) {
+            if (referenceIsDirectory and IsDirectory(test, name)) {
+                Compare(*reference.GetDirectory(name.c_str()), *test.GetDirectory(name.c_str()), path + name + '/', result);
+            } else {
+                result.push_back({path + name, "type", std::numeric_limits<double>::infinity(), Verdict::Failed});
+            }
+            continue;
+        }
+
+        // ratios are compared as a whole, under the base name
+        constexpr std::string_view passed{"Passed"};
+        constexpr std::string_view total{"Total"};
+        if (name.ends_with(total) and referenceName.contains(name.substr(0, name.size() - total.size()).append(passed))) {
+            continue;
+        }
+        const auto referenceObject{Read(reference, name)};
+        const auto testObject{Read(test, name)};
+        const auto referenceHistogram{dynamic_cast<const TH1*>(referenceObject.get())};
+        const auto testHistogram{dynamic_cast<const TH1*>(testObject.get())};
+        if (referenceHistogram == nullptr or testHistogram == nullptr) {
+            continue;
+        }
+        if (name.ends_with(passed)) {
+            const auto base{name.substr(0, name.size() - passed.size())};
+            const auto totalName{base + std::string{total}};
+            if (referenceName.contains(totalName) and testName.contains(totalName)) {
+                const auto referenceTotal{Read(reference, totalName)};
+                const auto testTotal{Read(test, totalName)};
+                const auto referenceTotalHistogram{dynamic_cast<const TH1*>(referenceTotal.get())};
+                const auto testTotalHistogram{dynamic_cast<const TH1*>(testTotal.get())};
+                if (referenceTotalHistogram and testTotalHistogram) {
+                    CompareRatio(path + base, *referenceHistogram, *referenceTotalHistogram,
+                                 *testHistogram, *testTotalHistogram, result);
+                    continue;
+                }
+            }
+        }
+        CompareDistribution(path + name, *referenceHistogram, *testHistogram, result);
+    }
+}
+
+auto RegressionTest::CompareRatio(const std::string& name, const TH1& referencePassed, const TH1& referenceTotal,
+                                  const TH1& testPassed, const TH1& testTotal, std::vector<Result>& result) const -> void {
+    const auto k1{referencePassed.GetEntries()};
+    const auto n1{referenceTotal.GetEntries()};
+    const auto k2{testPassed.GetEntries()};
+    const auto n2{testTotal.GetEntries()};
+    double z{};
+    if (n1 > 0 and n2 > 0) {
+        const auto p{(k1 + k2) / (n1 + n2)};
+        z = Significance(k1 / n1, k2 / n2, p * (1 - p) * (1 / n1 + 1 / n2));
+    } else if (n1 != n2) {
+        z = std::numeric_limits<double>::infinity();
+    }
+    result.push_back({name, "ratio", z, Judge(z)});
+}
+
+auto RegressionTest::CompareDistribution(const std::string& name, const TH1& reference, const TH1& test, std::vector<Result>& result) const -> void {
+    if (reference.GetNbinsX() != test.GetNbinsX() or
+        reference.GetXaxis()->GetXmin() != test.GetXaxis()->GetXmin() or
+        reference.GetXaxis()->GetXmax() != test.GetXaxis()->GetXmax()) {
+        result.push_back({name, "binning", std::numeric_limits<double>::infinity(), Verdict::Failed});
+        return;
+    }
+
+    const auto n1{reference.GetEffectiveEntries()};
+    const auto n2{test.GetEffectiveEntries()};
+    if (n1 <= 0 or n2 <= 0) {
+        const auto z{n1 == n2 ? 0 : std::numeric_limits<double>::infinity()};
+        result.push_back({name, "entries", z, Judge(z)});
+        return;
+    }
+
+    // shape, normalized to the same area
+    const auto pValue{reference.Chi2Test(&test, "UU NORM")};
+    const auto zShape{std::max(0., TMath::NormQuantile(1 - pValue / 2))};
+    result.push_back({name, "shape", zShape, Judge(zShape)});
+
+    const auto sigma1{reference.GetStdDev()};
+    const auto sigma2{test.GetStdDev()};
+    const auto zMean{Significance(reference.GetMean(), test.GetMean(), muc::pow(sigma1, 2) / n1 + muc::pow(sigma2, 2) / n2)};
+    result.push_back({name, "mean", zMean, Judge(zMean)});
+    // standard error of the standard deviation, normal approximation
+    const auto zWidth{Significance(sigma1, sigma2, muc::pow(sigma1, 2) / (2 * n1) + muc::pow(sigma2, 2) / (2 * n2))};
+    result.push_back({name, "width", zWidth, Judge(zWidth)});
+}
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+class TDirectory;
+class TH1;
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+/// @brief Statistical comparison of two runs of monitoring histograms.
+///
+/// Histograms are compared by name, recursively through subdirectories. A "<base>Passed" and
+/// "<base>Total" pair is a ratio (efficiency, fake rate, ...) and is compared with a pooled
+/// two-proportion z-test. Any other histogram gets a shape test (chi2, p-value converted to a
+/// two-sided Z), and z-tests of its mean and width. Each Z is judged as in the regression scripts
+/// of src/test: Identical (0), Passed, Suspicious, or Failed. A histogram present in only one run
+/// is Failed.
+class RegressionTest {
+public:
+    enum struct Verdict {
+        Identical,
+        Passed,
+        Suspicious,
+        Failed
+    };
+
+    struct Result {
+        std::string name;
+        std::string test;
+        double z;
+        Verdict verdict;
+    };
+
+public:
+    explicit RegressionTest(double suspiciousZ = 3, double failedZ = 5);
+
+    auto SuspiciousZ() const -> auto { return fSuspiciousZ; }
+    auto FailedZ() const -> auto { return fFailedZ; }
+
+    auto SuspiciousZ(double val) -> void { fSuspiciousZ = val; }
+    auto FailedZ(double val) -> void { fFailedZ = val; }
+
+    auto Compare(TDirectory& reference, TDirectory& test) const -> std::vector<Result>;
+    auto Judge(double z) const -> Verdict;
+
+    static auto Worst(const std::vector<Result>& result) -> Verdict;
+    static auto Print(const std::vector<Result>& result) -> void;
+
+private:
+    auto Compare(TDirectory& reference, TDirectory& test, const std::string& path, std::vector<Result>& result) const -> void;
+    auto CompareRatio(const std::string& name, const TH1& referencePassed, const TH1& referenceTotal,
+                      const TH1& testPassed, const TH1& testTotal, std::vector<Result>& result) const -> void;
+    auto CompareDistribution(const std::string& name, const TH1& reference, const TH1& test, std::vector<Result>& result) const -> void;
+
+private:
+    double fSuspiciousZ;
+    double fFailedZ;
+};
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
@@ -0,0 +1,72 @@
+#include "MACE/Reconstruction/Monitoring/SciFiMonitor.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+using namespace Mustard::LiteralUnit::Energy;
+using namespace Mustard::LiteralUnit::Length;
+using namespace Mustard::LiteralUnit::Time;
+
+SciFiMonitor::SciFiMonitor(double matchDistance) :
+    fMatchDistance{matchDistance},
+    fHistogram{} {
+    fHistogram.reserve(kNHistogram);
+    fHistogram.emplace_back("SciFiEfficiencyEkPassed", "Found truth tracks;E_{k}^{true} (MeV)", 60, 0, 60);
+    fHistogram.emplace_back("SciFiEfficiencyEkTotal", "Truth tracks;E_{k}^{true} (MeV)", 60, 0, 60);
+    fHistogram.emplace_back("SciFiFakeRateZPassed", "Fake points;z (mm)", 68, -170, 170);
+    fHistogram.emplace_back("SciFiFakeRateZTotal", "Points;z (mm)", 68, -170, 170);
+    fHistogram.emplace_back("SciFiResidualX", "Point x residual;x - x^{true} (mm)", 200, -5, 5);
+    fHistogram.emplace_back("SciFiResidualY", "Point y residual;y - y^{true} (mm)", 200, -5, 5);
+    fHistogram.emplace_back("SciFiResidualZ", "Point z residual;z - z^{true} (mm)", 200, -5, 5);
+    fHistogram.emplace_back("SciFiResidualT", "Point time residual;t - t^{true} (ns)", 200, -10, 10);
+}
+
+auto SciFiMonitor::Merge() -> void {
+    for (auto&& histogram : fHistogram) {
+        histogram.Merge();
+    }
+}
+
+auto SciFiMonitor::Write() const -> void {
+    for (auto&& histogram : fHistogram) {
+        histogram.ToTH1D()->Write();
+    }
+}
+
+auto SciFiMonitor::Print() const -> void {
+    const auto Ratio{[this](int passed, int total) {
+        const auto n{fHistogram[total].Entries()};
+        return n > 0 ? fHistogram[passed].Entries() / n : 0.;
+    }};
+    Mustard::MasterPrintLn("SciFi efficiency {:.4f} ({} truth tracks), point fake rate {:.4f} ({} points)",
+                           Ratio(kEfficiencyEkPassed, kEfficiencyEkTotal), fHistogram[kEfficiencyEkTotal].Entries(),
+                           Ratio(kFakeRateZPassed, kFakeRateZTotal), fHistogram[kFakeRateZTotal].Entries());
+    for (auto i{kResidualX}; i < kNHistogram; i = static_cast<HistogramIndex>(i + 1)) {
+        const auto& histogram{fHistogram[i]};
+        Mustard::MasterPrintLn("{:>20} mean {:>10.4g} RMS {:>10.4g} ({} entries)",
+                               histogram.Name(), histogram.Mean(), histogram.RMS(), histogram.Entries());
+    }
+}
+
+auto SciFiMonitor::FillPoint(const muc::array3d& x, double t, const muc::array3d* xTrue, double tTrue) -> void {
+    fHistogram[kFakeRateZTotal].Fill(x[2] / 1_mm);
+    if (xTrue == nullptr) {
+        fHistogram[kFakeRateZPassed].Fill(x[2] / 1_mm);
+        return;
+    }
+    fHistogram[kResidualX].Fill((x[0] - (*xTrue)[0]) / 1_mm);
+    fHistogram[kResidualY].Fill((x[1] - (*xTrue)[1]) / 1_mm);
+    fHistogram[kResidualZ].Fill((x[2] - (*xTrue)[2]) / 1_mm);
+    fHistogram[kResidualT].Fill((t - tTrue) / 1_ns);
+}
+
+auto SciFiMonitor::FillTruth(double ek, bool found) -> void {
+    fHistogram[kEfficiencyEkTotal].Fill(ek / 1_MeV);
+    if (found) {
+        fHistogram[kEfficiencyEkPassed].Fill(ek / 1_MeV);
+    }
+}
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
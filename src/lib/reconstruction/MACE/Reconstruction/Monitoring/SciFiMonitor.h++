@@ -0,0 +1,71 @@
+#pragma once
+
+#include "MACE/PhaseI/Data/SimHit.h++"
+#include "MACE/PhaseI/Data/Track.h++"
+#include "MACE/Reconstruction/Monitoring/Histogram.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include "muc/array"
+#include "muc/hash_map"
+#include "muc/math"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+/// @brief Figures of merit of the Phase-I SciFi tracker reconstruction (ReconSciFi) against the
+/// simulated fiber hits.
+///
+/// ReconSciFi reconstructs fiber crossing points (ReconTrack), not tracks. A point matches the
+/// nearest simulated hit (SciFiSimHit) of the event within MatchDistance, and fills the position
+/// and time residuals; points matching nothing are fakes. A truth track (TrkID) is found if a point
+/// lies within MatchDistance of any of its hits.
+/// Fill is thread-safe; Merge is collective over MPI_COMM_WORLD.
+class SciFiMonitor {
+public:
+    explicit SciFiMonitor(double matchDistance = 5); ///< in mm
+
+    auto MatchDistance() const -> auto { return fMatchDistance; }
+    auto MatchDistance(double val) -> void { fMatchDistance = val; }
+
+    /// @brief Match the reconstructed points of an event to the simulated hits of the same event.
+    template<Mustard::Data::SuperTupleModel<PhaseI::Data::ReconTrack> APoint, Mustard::Data::SuperTupleModel<PhaseI::Data::SciFiSimHit> AHit>
+    auto Fill(const std::vector<std::shared_ptr<Mustard::Data::Tuple<APoint>>>& point,
+              const std::vector<std::shared_ptr<Mustard::Data::Tuple<AHit>>>& simHit) -> void;
+
+    auto HistogramList() const -> const auto& { return fHistogram; }
+    auto Merge() -> void;
+    /// @brief Write histograms (as TH1D) into the current directory.
+    auto Write() const -> void;
+    auto Print() const -> void;
+
+private:
+    enum HistogramIndex {
+        kEfficiencyEkPassed,
+        kEfficiencyEkTotal,
+        kFakeRateZPassed,
+        kFakeRateZTotal,
+        kResidualX,
+        kResidualY,
+        kResidualZ,
+        kResidualT,
+        kNHistogram
+    };
+
+private:
+    /// @param xTrue position of the matched hit, nullptr for a fake point
+    auto FillPoint(const muc::array3d& x, double t, const muc::array3d* xTrue, double tTrue) -> void;
+    auto FillTruth(double ek, bool found) -> void;
+
+private:
+    double fMatchDistance;
+    std::vector<Histogram> fHistogram;
+};
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
+
+#include "MACE/Reconstruction/Monitoring/SciFiMonitor.inl"
@@ -0,0 +1,42 @@
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+template<Mustard::Data::SuperTupleModel<PhaseI::Data::ReconTrack> APoint, Mustard::Data::SuperTupleModel<PhaseI::Data::SciFiSimHit> AHit>
+auto SciFiMonitor::Fill(const std::vector<std::shared_ptr<Mustard::Data::Tuple<APoint>>>& point,
+                        const std::vector<std::shared_ptr<Mustard::Data::Tuple<AHit>>>& simHit) -> void {
+    // vertex kinetic energy of each truth track, and whether a point found it
+    muc::flat_hash_map<int, std::pair<double, bool>> truth;
+    for (auto&& hit : simHit) {
+        truth.try_emplace(*Get<"TrkID">(*hit), *Get<"Ek0">(*hit), false);
+    }
+
+    const auto maxDistance2{muc::pow(fMatchDistance, 2)};
+    for (auto&& p : point) {
+        const auto x{Get<"x">(*p).template As<muc::array3d>()};
+        const Mustard::Data::Tuple<AHit>* nearest{};
+        auto nearestDistance2{maxDistance2};
+        for (auto&& hit : simHit) {
+            const auto xTrue{Get<"x">(*hit).template As<muc::array3d>()};
+            const auto distance2{muc::pow(x[0] - xTrue[0], 2) + muc::pow(x[1] - xTrue[1], 2) + muc::pow(x[2] - xTrue[2], 2)};
+            if (distance2 > maxDistance2) {
+                continue;
+            }
+            truth.at(*Get<"TrkID">(*hit)).second = true;
+            if (distance2 <= nearestDistance2) {
+                nearest = hit.get();
+                nearestDistance2 = distance2;
+            }
+        }
+        if (nearest == nullptr) {
+            FillPoint(x, *Get<"t">(*p), nullptr, 0);
+        } else {
+            const auto xTrue{Get<"x">(*nearest).template As<muc::array3d>()};
+            FillPoint(x, *Get<"t">(*p), &xTrue, *Get<"t">(*nearest));
+        }
+    }
+
+    for (auto&& [_, truthTrack] : truth) {
+        FillTruth(truthTrack.first, truthTrack.second);
+    }
+}
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
@@ -0,0 +1,128 @@
+#include "MACE/Reconstruction/MMSTracking/Extrapolator/Covariance.h++"
+#include "MACE/Reconstruction/Monitoring/TrackMonitor.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/Utility/LiteralUnit.h++"
+#include "Mustard/Utility/MathConstant.h++"
+
+#include "muc/math"
+
+#include <algorithm>
+#include <cmath>
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+using namespace Mustard::LiteralUnit::Energy;
+using namespace Mustard::LiteralUnit::Length;
+using namespace Mustard::LiteralUnit::Time;
+using namespace Mustard::MathConstant;
+
+TrackMonitor::TrackMonitor(double minPurity) :
+    fMinPurity{minPurity},
+    fHistogram{} {
+    fHistogram.reserve(kNHistogram);
+    fHistogram.emplace_back("TrackEfficiencyEkPassed", "Matched truth tracks;E_{k}^{true} (MeV)", 60, 0, 60);
+    fHistogram.emplace_back("TrackEfficiencyEkTotal", "Truth tracks;E_{k}^{true} (MeV)", 60, 0, 60);
+    fHistogram.emplace_back("TrackEfficiencyCosThetaPassed", "Matched truth tracks;cos#theta^{true}", 40, -1, 1);
+    fHistogram.emplace_back("TrackEfficiencyCosThetaTotal", "Truth tracks;cos#theta^{true}", 40, -1, 1);
+    fHistogram.emplace_back("TrackFakeRateEkPassed", "Fake tracks;E_{k} (MeV)", 60, 0, 60);
+    fHistogram.emplace_back("TrackFakeRateEkTotal", "Tracks;E_{k} (MeV)", 60, 0, 60);
+    fHistogram.emplace_back("TrackCloneRateEkPassed", "Clone tracks;E_{k} (MeV)", 60, 0, 60);
+    fHistogram.emplace_back("TrackCloneRateEkTotal", "Matched tracks;E_{k} (MeV)", 60, 0, 60);
+    fHistogram.emplace_back("TrackResidualP", "Momentum residual;p - p^{true} (MeV)", 200, -5, 5);
+    fHistogram.emplace_back("TrackResidualPT", "Transverse momentum residual;p_{T} - p_{T}^{true} (MeV)", 200, -5, 5);
+    fHistogram.emplace_back("TrackResidualTheta", "Polar angle residual;#theta - #theta^{true} (rad)", 200, -0.1, 0.1);
+    fHistogram.emplace_back("TrackResidualPhi", "Azimuth angle residual;#phi - #phi^{true} (rad)", 200, -0.1, 0.1);
+    fHistogram.emplace_back("TrackResidualX0", "Vertex x residual;x_{0} - x_{0}^{true} (mm)", 200, -10, 10);
+    fHistogram.emplace_back("TrackResidualY0", "Vertex y residual;y_{0} - y_{0}^{true} (mm)", 200, -10, 10);
+    fHistogram.emplace_back("TrackResidualZ0", "Vertex z residual;z_{0} - z_{0}^{true} (mm)", 200, -20, 20);
+    fHistogram.emplace_back("TrackResidualT0", "Vertex time residual;t_{0} - t_{0}^{true} (ns)", 200, -5, 5);
+    fHistogram.emplace_back("TrackPullC0X", "Helix center x pull;(c_{0x} - c_{0x}^{true}) / #sigma", 100, -10, 10);
+    fHistogram.emplace_back("TrackPullC0Y", "Helix center y pull;(c_{0y} - c_{0y}^{true}) / #sigma", 100, -10, 10);
+    fHistogram.emplace_back("TrackPullR0", "Helix radius pull;(r_{0} - r_{0}^{true}) / #sigma", 100, -10, 10);
+    fHistogram.emplace_back("TrackPullZ0", "Helix z_{0} pull;(z_{0} - z_{0}^{true}) / #sigma", 100, -10, 10);
+    fHistogram.emplace_back("TrackPullTheta0", "Helix #theta_{0} pull;(#theta_{0} - #theta_{0}^{true}) / #sigma", 100, -10, 10);
+}
+
+auto TrackMonitor::Merge() -> void {
+    for (auto&& histogram : fHistogram) {
+        histogram.Merge();
+    }
+}
+
+auto TrackMonitor::Write() const -> void {
+    for (auto&& histogram : fHistogram) {
+        histogram.ToTH1D()->Write();
+    }
+}
+
+auto TrackMonitor::Print() const -> void {
+    const auto Ratio{[this](int passed, int total) {
+        const auto n{fHistogram[total].Entries()};
+        return n > 0 ? fHistogram[passed].Entries() / n : 0.;
+    }};
+    Mustard::MasterPrintLn("Track efficiency {:.4f} ({} truth tracks), fake rate {:.4f}, clone rate {:.4f}",
+                           Ratio(kEfficiencyEkPassed, kEfficiencyEkTotal), fHistogram[kEfficiencyEkTotal].Entries(),
+                           Ratio(kFakeRateEkPassed, kFakeRateEkTotal), Ratio(kCloneRateEkPassed, kCloneRateEkTotal));
+    for (auto i{kResidualP}; i < kNHistogram; i = static_cast<HistogramIndex>(i + 1)) {
+        const auto& histogram{fHistogram[i]};
+        Mustard::MasterPrintLn("{:>20} mean {:>10.4g} RMS {:>10.4g} ({} entries)",
+                               histogram.Name(), histogram.Mean(), histogram.RMS(), histogram.Entries());
+    }
+}
+
+auto TrackMonitor::FillTruth(const Parameter& truth, bool found) -> void {
+    const auto ek{truth.ek0 / 1_MeV};
+    const auto cosTheta{truth.p0[2] / muc::hypot(truth.p0[0], truth.p0[1], truth.p0[2])};
+    fHistogram[kEfficiencyEkTotal].Fill(ek);
+    fHistogram[kEfficiencyCosThetaTotal].Fill(cosTheta);
+    if (found) {
+        fHistogram[kEfficiencyEkPassed].Fill(ek);
+        fHistogram[kEfficiencyCosThetaPassed].Fill(cosTheta);
+    }
+}
+
+auto TrackMonitor::FillTrack(const Parameter& track, bool fake, bool clone) -> void {
+    const auto ek{track.ek0 / 1_MeV};
+    fHistogram[kFakeRateEkTotal].Fill(ek);
+    if (fake) {
+        fHistogram[kFakeRateEkPassed].Fill(ek);
+        return;
+    }
+    fHistogram[kCloneRateEkTotal].Fill(ek);
+    if (clone) {
+        fHistogram[kCloneRateEkPassed].Fill(ek);
+    }
+}
+
+auto TrackMonitor::FillMatched(const Parameter& track, const Parameter& truth) -> void {
+    const auto& p{track.p0};
+    const auto& pTrue{truth.p0};
+    const auto pT{muc::hypot(p[0], p[1])};
+    const auto pTTrue{muc::hypot(pTrue[0], pTrue[1])};
+    fHistogram[kResidualP].Fill((muc::hypot(pT, p[2]) - muc::hypot(pTTrue, pTrue[2])) / 1_MeV);
+    fHistogram[kResidualPT].Fill((pT - pTTrue) / 1_MeV);
+    fHistogram[kResidualTheta].Fill(std::atan2(pT, p[2]) - std::atan2(pTTrue, pTrue[2]));
+    fHistogram[kResidualPhi].Fill(std::remainder(std::atan2(p[1], p[0]) - std::atan2(pTrue[1], pTrue[0]), 2 * pi));
+    fHistogram[kResidualX0].Fill((track.x0[0] - truth.x0[0]) / 1_mm);
+    fHistogram[kResidualY0].Fill((track.x0[1] - truth.x0[1]) / 1_mm);
+    fHistogram[kResidualZ0].Fill((track.x0[2] - truth.x0[2]) / 1_mm);
+    fHistogram[kResidualT0].Fill((track.t0 - truth.t0) / 1_ns);
+
+    if (track.cov.empty()) {
+        return;
+    }
+    const auto cov{MMSTracking::UnpackCovariance<5>(track.cov)};
+    const auto Pull{[&](HistogramIndex h, int i, double residual) {
+        if (cov(i, i) > 0) {
+            fHistogram[h].Fill(residual / std::sqrt(cov(i, i)));
+        }
+    }};
+    Pull(kPullC0X, 0, track.c0[0] - truth.c0[0]);
+    Pull(kPullC0Y, 1, track.c0[1] - truth.c0[1]);
+    Pull(kPullR0, 2, track.r0 - truth.r0);
+    Pull(kPullZ0, 3, track.z0 - truth.z0);
+    Pull(kPullTheta0, 4, track.theta0 - truth.theta0);
+}
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "MACE/Data/MMSTrack.h++"
+#include "MACE/Reconstruction/Monitoring/Histogram.h++"
+
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Data/TupleModel.h++"
+
+#include "muc/array"
+#include "muc/hash_map"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+/// @brief Truth matching and figures of merit of reconstructed MMS tracks.
+///
+/// A track matches the truth track (MMSSimTrack) it shares most CDC hits with, by HitID within
+/// the event, if the shared fraction of its hits (purity) is at least MinPurity. Truth tracks
+/// that no track matches are losses (efficiency), tracks matching nothing are fakes, and further
+/// tracks matching an already matched truth track are clones. The best matched track fills the
+/// momentum and vertex residuals, and the helix pulls if it has a covariance.
+/// Fill is thread-safe; Merge is collective over MPI_COMM_WORLD.
+class TrackMonitor {
+public:
+    explicit TrackMonitor(double minPurity = 0.5);
+
+    auto MinPurity() const -> auto { return fMinPurity; }
+    auto MinPurity(double val) -> void { fMinPurity = val; }
+
+    /// @brief Match the tracks of an event to the truth tracks of the same event.
+    template<Mustard::Data::SuperTupleModel<Data::MMSTrack> ATrack, Mustard::Data::SuperTupleModel<Data::MMSTrack> ATruth>
+    auto Fill(const std::vector<std::shared_ptr<Mustard::Data::Tuple<ATrack>>>& track,
+              const std::vector<std::shared_ptr<Mustard::Data::Tuple<ATruth>>>& truth) -> void;
+
+    auto HistogramList() const -> const auto& { return fHistogram; }
+    auto Merge() -> void;
+    /// @brief Write histograms (as TH1D) into the current directory.
+    auto Write() const -> void;
+    auto Print() const -> void;
+
+private:
+    struct Parameter {
+        double t0;
+        muc::array3d x0;
+        double ek0;
+        muc::array3d p0;
+        muc::array2d c0;
+        double r0;
+        double z0;
+        double theta0;
+        std::vector<float> cov;
+    };
+
+    enum HistogramIndex {
+        kEfficiencyEkPassed,
+        kEfficiencyEkTotal,
+        kEfficiencyCosThetaPassed,
+        kEfficiencyCosThetaTotal,
+        kFakeRateEkPassed,
+        kFakeRateEkTotal,
+        kCloneRateEkPassed,
+        kCloneRateEkTotal,
+        kResidualP,
+        kResidualPT,
+        kResidualTheta,
+        kResidualPhi,
+        kResidualX0,
+        kResidualY0,
+        kResidualZ0,
+        kResidualT0,
+        kPullC0X,
+        kPullC0Y,
+        kPullR0,
+        kPullZ0,
+        kPullTheta0,
+        kNHistogram
+    };
+
+private:
+    template<typename AModel>
+    static auto ParameterOf(const Mustard::Data::Tuple<AModel>& track) -> Parameter;
+    auto FillTruth(const Parameter& truth, bool found) -> void;
+    auto FillTrack(const Parameter& track, bool fake, bool clone) -> void;
+    auto FillMatched(const Parameter& track, const Parameter& truth) -> void;
+
+private:
+    double fMinPurity;
+    std::vector<Histogram> fHistogram;
+};
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
+
+#include "MACE/Reconstruction/Monitoring/TrackMonitor.inl"
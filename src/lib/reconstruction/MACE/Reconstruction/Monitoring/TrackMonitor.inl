@@ -0,0 +1,66 @@
+namespace MACE::inline Reconstruction::inline Monitoring {
+
+template<Mustard::Data::SuperTupleModel<Data::MMSTrack> ATrack, Mustard::Data::SuperTupleModel<Data::MMSTrack> ATruth>
+auto TrackMonitor::Fill(const std::vector<std::shared_ptr<Mustard::Data::Tuple<ATrack>>>& track,
+                        const std::vector<std::shared_ptr<Mustard::Data::Tuple<ATruth>>>& truth) -> void {
+    std::vector<Parameter> truthParameter;
+    truthParameter.reserve(truth.size());
+    muc::flat_hash_map<int, gsl::index> truthOfHit;
+    for (gsl::index i{}; i < std::ssize(truth); ++i) {
+        truthParameter.emplace_back(ParameterOf(*truth[i]));
+        for (auto hitID : *Get<"HitID">(*truth[i])) {
+            truthOfHit.try_emplace(hitID, i);
+        }
+    }
+
+    // (purity, track, truth) of matched tracks, the others are fakes
+    std::vector<std::tuple<double, gsl::index, gsl::index>> match;
+    std::vector<Parameter> trackParameter;
+    trackParameter.reserve(track.size());
+    for (gsl::index t{}; t < std::ssize(track); ++t) {
+        trackParameter.emplace_back(ParameterOf(*track[t]));
+        const auto& hitID{*Get<"HitID">(*track[t])};
+        muc::flat_hash_map<gsl::index, int> nShared;
+        for (auto id : hitID) {
+            if (const auto i{truthOfHit.find(id)}; i != truthOfHit.cend()) {
+                ++nShared[i->second];
+            }
+        }
+        const auto best{std::ranges::max_element(nShared, {}, [](auto&& shared) { return shared.second; })};
+        const auto purity{best == nShared.end() ? 0. : static_cast<double>(best->second) / hitID.size()};
+        if (purity >= fMinPurity and purity > 0) {
+            match.emplace_back(purity, t, best->first);
+        } else {
+            FillTrack(trackParameter.back(), true, false);
+        }
+    }
+
+    std::ranges::sort(match, std::greater{});
+    std::vector<bool> found(truth.size());
+    for (auto&& [_, t, i] : match) {
+        const auto clone{found[i]};
+        found[i] = true;
+        FillTrack(trackParameter[t], false, clone);
+        if (not clone) {
+            FillMatched(trackParameter[t], truthParameter[i]);
+        }
+    }
+    for (gsl::index i{}; i < std::ssize(truth); ++i) {
+        FillTruth(truthParameter[i], found[i]);
+    }
+}
+
+template<typename AModel>
+auto TrackMonitor::ParameterOf(const Mustard::Data::Tuple<AModel>& track) -> Parameter {
+    return {*Get<"t0">(track),
+            Get<"x0">(track).template As<muc::array3d>(),
+            *Get<"Ek0">(track),
+            Get<"p0">(track).template As<muc::array3d>(),
+            Get<"c0">(track).template As<muc::array2d>(),
+            *Get<"r0">(track),
+            *Get<"z0">(track),
+            *Get<"theta0">(track),
+            *Get<"cov">(track)};
+}
+
+} // namespace MACE::inline Reconstruction::inline Monitoring
@@ -0,0 +1,111 @@
+#include "MACE/Simulation/Generator/DecayVertexPrimaryGenerator.h++"
+
+#include "Mustard/Data/Processor.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/Value.h++"
+#include "Mustard/Geant4X/Particle/Antimuonium.h++"
+#include "Mustard/Geant4X/Particle/Muonium.h++"
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "G4Event.hh"
+#include "G4ParticleTable.hh"
+#include "G4PrimaryParticle.hh"
+#include "G4PrimaryVertex.hh"
+#include "Randomize.hh"
+
+#include "ROOT/RDataFrame.hxx"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+
+#include <stdexcept>
+
+namespace MACE::inline Simulation::inline Generator {
+
+namespace {
+
+using DecayVertexModel = Mustard::Data::TupleModel<Mustard::Data::Value<int, "EvtID", "Event ID">,
+                                                   Mustard::Data::Value<int, "PDGID", "Parent PDG ID">,
+                                                   Mustard::Data::Value<double, "t", "Decay time">,
+                                                   Mustard::Data::Value<muc::array3f, "x", "Decay position">,
+                                                   Mustard::Data::Value<muc::array3f, "p", "Momentum just before decay">>;
+
+} // namespace
+
+DecayVertexPrimaryGenerator::DecayVertexPrimaryGenerator() :
+    G4VPrimaryGenerator{},
+    fDecayVertex{},
+    fPositionSmearing{},
+    fTimeSmearing{},
+    fPolarization{},
+    fMuoniumDepolarization{0.5},
+    fDecayProductGenerator{},
+    fMessengerRegister{this} {}
+
+auto DecayVertexPrimaryGenerator::LoadDecayVertex(const std::string& fileName, const std::string& treeName) -> void {
+    const auto nBefore{fDecayVertex.size()};
+    // each process keeps its share of the vertices, which samples the same distribution
+    Mustard::Data::Processor processor;
+    processor.Process<DecayVertexModel>(
+        ROOT::RDataFrame{treeName, fileName}, int{}, "EvtID",
+        [&](bool byPass, auto&& event) {
+            if (byPass) {
+                return;
+            }
+            for (auto&& vertex : event) {
+                fDecayVertex.push_back({*Get<"t">(*vertex), *Get<"x">(*vertex), *Get<"p">(*vertex), *Get<"PDGID">(*vertex)});
+            }
+        });
+    fDecayVertex.shrink_to_fit();
+    if (fDecayVertex.size() == nBefore) {
+        Mustard::PrintWarning(fmt::format("No decay vertex loaded from {}:{}", fileName, treeName));
+    }
+}
+
+auto DecayVertexPrimaryGenerator::GeneratePrimaryVertex(G4Event* event) -> void {
+    if (fDecayVertex.empty()) {
+        Mustard::Throw<std::logic_error>("No decay vertex loaded (try /MACE/Generator/DecayVertex/Load)");
+    }
+    auto& rng{*G4Random::getTheEngine()};
+
+    const auto& [t, x, p, pdgID]{fDecayVertex[static_cast<gsl::index>(rng.flat() * fDecayVertex.size())]};
+    G4ThreeVector position{x[0], x[1], x[2]};
+    auto time{t};
+    if (fPositionSmearing > 0) {
+        position += G4ThreeVector{G4RandGauss::shoot(&rng, 0, fPositionSmearing),
+                                  G4RandGauss::shoot(&rng, 0, fPositionSmearing),
+                                  G4RandGauss::shoot(&rng, 0, fPositionSmearing)};
+    }
+    if (fTimeSmearing > 0) {
+        time += G4RandGauss::shoot(&rng, 0, fTimeSmearing);
+    }
+
+    if (fDecayProductGenerator) {
+        const auto nVertexBefore{event->GetNumberOfPrimaryVertex()};
+        fDecayProductGenerator->GeneratePrimaryVertex(event);
+        for (auto i{nVertexBefore}; i < event->GetNumberOfPrimaryVertex(); ++i) {
+            auto& vertex{*event->GetPrimaryVertex(i)};
+            vertex.SetPosition(position.x(), position.y(), position.z());
+            vertex.SetT0(time);
+        }
+        return;
+    }
+
+    const auto particle{G4ParticleTable::GetParticleTable()->FindParticle(pdgID)};
+    if (particle == nullptr) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Unknown parent PDG ID {} in decay vertex data", pdgID));
+    }
+    auto polarization{fPolarization};
+    if (particle == Mustard::Geant4X::Muonium::Definition() or particle == Mustard::Geant4X::Antimuonium::Definition()) {
+        polarization *= fMuoniumDepolarization;
+    }
+    const auto primary{new G4PrimaryParticle{particle, p[0], p[1], p[2]}};
+    primary->SetPolarization(polarization);
+    primary->SetProperTime(0); // decays on the spot
+    const auto primaryVertex{new G4PrimaryVertex{position, time}};
+    primaryVertex->SetPrimary(primary);
+    event->AddPrimaryVertex(primaryVertex);
+}
+
+} // namespace MACE::inline Simulation::inline Generator
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "MACE/Simulation/Generator/DecayVertexPrimaryGeneratorMessenger.h++"
+
+#include "G4ThreeVector.hh"
+#include "G4VPrimaryGenerator.hh"
+
+#include "muc/array"
+
+#include <string>
+#include <vector>
+
+class G4Event;
+
+namespace MACE::inline Simulation::inline Generator {
+
+/// @brief Resamples decay vertices of a previous simulation (e.g. SimTarget's MuoniumTrack),
+/// so that studies downstream of the target can skip the beam transport and target stages.
+///
+/// Decay vertices ("PDGID", "t", "x", "p") from one or more files are kept in a compact table.
+/// Each event draws one of them at random, optionally smeared in position and time by a
+/// Gaussian kernel (i.e. sampling a kernel density estimate of the vertex distribution).
+/// The decay products come either
+///  - from Geant4 (default): the parent is emitted with its momentum, its polarization and
+///    a zero pre-assigned proper time, so it decays on the spot through its decay table; or
+///  - from a decay product generator (e.g. the matrix-element generator), whose vertices are
+///    moved to the sampled decay vertex. Parent momentum and polarization are then up to it.
+/// The parent polarization is the muon polarization, scaled by MuoniumDepolarization for
+/// (anti)muonium (0.5 from hyperfine mixing in zero or weak field).
+class DecayVertexPrimaryGenerator : public G4VPrimaryGenerator {
+public:
+    DecayVertexPrimaryGenerator();
+
+    auto LoadDecayVertex(const std::string& fileName, const std::string& treeName) -> void;
+    auto ClearDecayVertex() -> void { fDecayVertex.clear(); }
+
+    auto PositionSmearing(double val) -> void { fPositionSmearing = val; }
+    auto TimeSmearing(double val) -> void { fTimeSmearing = val; }
+    auto Polarization(G4ThreeVector val) -> void { fPolarization = val; }
+    auto MuoniumDepolarization(double val) -> void { fMuoniumDepolarization = val; }
+    auto DecayProductGenerator(G4VPrimaryGenerator* val) -> void { fDecayProductGenerator = val; }
+
+    auto GeneratePrimaryVertex(G4Event* event) -> void override;
+
+private:
+    struct DecayVertex {
+        double t;
+        muc::array3f x;
+        muc::array3f p;
+        int pdgID;
+    };
+
+private:
+    std::vector<DecayVertex> fDecayVertex;
+
+    double fPositionSmearing;
+    double fTimeSmearing;
+    G4ThreeVector fPolarization;
+    double fMuoniumDepolarization;
+    G4VPrimaryGenerator* fDecayProductGenerator;
+
+    DecayVertexPrimaryGeneratorMessenger::Register<DecayVertexPrimaryGenerator> fMessengerRegister;
+};
+
+} // namespace MACE::inline Simulation::inline Generator
@@ -0,0 +1,104 @@
+#include "MACE/Simulation/Generator/DecayVertexPrimaryGenerator.h++"
+#include "MACE/Simulation/Generator/DecayVertexPrimaryGeneratorMessenger.h++"
+
+#include "G4UIcmdWith3Vector.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithoutParameter.hh"
+#include "G4UIcommand.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIparameter.hh"
+
+#include <sstream>
+#include <string>
+
+namespace MACE::inline Simulation::inline Messenger {
+
+DecayVertexPrimaryGeneratorMessenger::DecayVertexPrimaryGeneratorMessenger() :
+    SingletonMessenger{},
+    fDirectory{},
+    fLoad{},
+    fClear{},
+    fPositionSmearing{},
+    fTimeSmearing{},
+    fPolarization{},
+    fMuoniumDepolarization{} {
+
+    fDirectory = std::make_unique<G4UIdirectory>("/MACE/Generator/DecayVertex/");
+    fDirectory->SetGuidance("Resampling of decay vertices from a previous simulation (e.g. SimTarget).");
+
+    fLoad = std::make_unique<G4UIcommand>("/MACE/Generator/DecayVertex/Load", this);
+    fLoad->SetGuidance("Add decay vertices (columns 'PDGID', 't', 'x' and 'p') in a ROOT file to the table, "
+                       "e.g. SimTarget's G4Run0/MuoniumTrack. Can be executed repeatedly for several files.");
+    fLoad->SetParameter(new G4UIparameter{"file", 's', false});
+    const auto tree{new G4UIparameter{"tree", 's', true}};
+    tree->SetDefaultValue("G4Run0/MuoniumTrack");
+    fLoad->SetParameter(tree);
+    fLoad->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fClear = std::make_unique<G4UIcmdWithoutParameter>("/MACE/Generator/DecayVertex/Clear", this);
+    fClear->SetGuidance("Remove all decay vertices from the table.");
+    fClear->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fPositionSmearing = std::make_unique<G4UIcmdWithADoubleAndUnit>("/MACE/Generator/DecayVertex/PositionSmearing", this);
+    fPositionSmearing->SetGuidance("Width of the Gaussian smoothing kernel of decay position (0 for plain resampling).");
+    fPositionSmearing->SetParameterName("sigma", false);
+    fPositionSmearing->SetUnitCategory("Length");
+    fPositionSmearing->SetRange("sigma >= 0");
+    fPositionSmearing->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fTimeSmearing = std::make_unique<G4UIcmdWithADoubleAndUnit>("/MACE/Generator/DecayVertex/TimeSmearing", this);
+    fTimeSmearing->SetGuidance("Width of the Gaussian smoothing kernel of decay time (0 for plain resampling).");
+    fTimeSmearing->SetParameterName("sigma", false);
+    fTimeSmearing->SetUnitCategory("Time");
+    fTimeSmearing->SetRange("sigma >= 0");
+    fTimeSmearing->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fPolarization = std::make_unique<G4UIcmdWith3Vector>("/MACE/Generator/DecayVertex/Polarization", this);
+    fPolarization->SetGuidance("Muon polarization at the decay vertex (Geant4 decay products only).");
+    fPolarization->SetParameterName("Px", "Py", "Pz", false);
+    fPolarization->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fMuoniumDepolarization = std::make_unique<G4UIcmdWithADouble>("/MACE/Generator/DecayVertex/MuoniumDepolarization", this);
+    fMuoniumDepolarization->SetGuidance("Fraction of the muon polarization retained in (anti)muonium "
+                                        "(0.5 for hyperfine mixing in zero or weak field).");
+    fMuoniumDepolarization->SetParameterName("f", false);
+    fMuoniumDepolarization->SetRange("f >= 0 && f <= 1");
+    fMuoniumDepolarization->AvailableForStates(G4State_PreInit, G4State_Idle);
+}
+
+DecayVertexPrimaryGeneratorMessenger::~DecayVertexPrimaryGeneratorMessenger() = default;
+
+auto DecayVertexPrimaryGeneratorMessenger::SetNewValue(G4UIcommand* command, G4String value) -> void {
+    if (command == fLoad.get()) {
+        Deliver<DecayVertexPrimaryGenerator>([&](auto&& r) {
+            std::istringstream is{value};
+            std::string file;
+            std::string tree;
+            is >> file >> tree;
+            r.LoadDecayVertex(file, tree);
+        });
+    } else if (command == fClear.get()) {
+        Deliver<DecayVertexPrimaryGenerator>([&](auto&& r) {
+            r.ClearDecayVertex();
+        });
+    } else if (command == fPositionSmearing.get()) {
+        Deliver<DecayVertexPrimaryGenerator>([&](auto&& r) {
+            r.PositionSmearing(fPositionSmearing->GetNewDoubleValue(value));
+        });
+    } else if (command == fTimeSmearing.get()) {
+        Deliver<DecayVertexPrimaryGenerator>([&](auto&& r) {
+            r.TimeSmearing(fTimeSmearing->GetNewDoubleValue(value));
+        });
+    } else if (command == fPolarization.get()) {
+        Deliver<DecayVertexPrimaryGenerator>([&](auto&& r) {
+            r.Polarization(fPolarization->GetNew3VectorValue(value));
+        });
+    } else if (command == fMuoniumDepolarization.get()) {
+        Deliver<DecayVertexPrimaryGenerator>([&](auto&& r) {
+            r.MuoniumDepolarization(fMuoniumDepolarization->GetNewDoubleValue(value));
+        });
+    }
+}
+
+} // namespace MACE::inline Simulation::inline Messenger
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Mustard/Geant4X/Interface/SingletonMessenger.h++"
+
+#include <memory>
+
+class G4UIcmdWith3Vector;
+class G4UIcmdWithADouble;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithoutParameter;
+class G4UIcommand;
+class G4UIdirectory;
+
+namespace MACE::inline Simulation {
+
+inline namespace Generator {
+class DecayVertexPrimaryGenerator;
+} // namespace Generator
+
+inline namespace Messenger {
+
+class DecayVertexPrimaryGeneratorMessenger final : public Mustard::Geant4X::SingletonMessenger<DecayVertexPrimaryGeneratorMessenger,
+                                                                                               DecayVertexPrimaryGenerator> {
+    friend Mustard::Env::Memory::SingletonInstantiator;
+
+private:
+    DecayVertexPrimaryGeneratorMessenger();
+    ~DecayVertexPrimaryGeneratorMessenger();
+
+public:
+    auto SetNewValue(G4UIcommand* command, G4String value) -> void override;
+
+private:
+    std::unique_ptr<G4UIdirectory> fDirectory;
+    std::unique_ptr<G4UIcommand> fLoad;
+    std::unique_ptr<G4UIcmdWithoutParameter> fClear;
+    std::unique_ptr<G4UIcmdWithADoubleAndUnit> fPositionSmearing;
+    std::unique_ptr<G4UIcmdWithADoubleAndUnit> fTimeSmearing;
+    std::unique_ptr<G4UIcmdWith3Vector> fPolarization;
+    std::unique_ptr<G4UIcmdWithADouble> fMuoniumDepolarization;
+};
+
+} // namespace Messenger
+
+} // namespace MACE::inline Simulation
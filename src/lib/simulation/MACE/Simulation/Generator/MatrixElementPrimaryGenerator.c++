@@ -0,0 +1,180 @@
+#include "MACE/Simulation/Generator/MatrixElementPrimaryGenerator.h++"
+#include "MACE/Utility/PhaseSpaceIntegrationCache.h++"
+
+#include "Mustard/Data/Processor.h++"
+#include "Mustard/Data/TupleModel.h++"
+#include "Mustard/Data/Value.h++"
+#include "Mustard/Execution/Executor.h++"
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+#include "Mustard/Math/MCIntegrationUtility.h++"
+#include "Mustard/Utility/MathConstant.h++"
+#include "Mustard/Utility/PhysicalConstant.h++"
+
+#include "G4Event.hh"
+#include "G4PrimaryParticle.hh"
+#include "G4PrimaryVertex.hh"
+#include "Randomize.hh"
+
+#include "ROOT/RDataFrame.hxx"
+
+#include "muc/array"
+#include "muc/math"
+#include "muc/utility"
+
+#include "gsl/gsl"
+
+#include "fmt/format.h"
+
+#include <concepts>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace MACE::inline Simulation::inline Generator {
+
+using namespace Mustard::MathConstant;
+using namespace Mustard::PhysicalConstant;
+
+namespace {
+
+using DecayVertexModel = Mustard::Data::TupleModel<Mustard::Data::Value<int, "EvtID", "Event ID">,
+                                                   Mustard::Data::Value<double, "t", "Decay time">,
+                                                   Mustard::Data::Value<muc::array3f, "x", "Decay position">>;
+
+} // namespace
+
+MatrixElementPrimaryGenerator::MatrixElementPrimaryGenerator() :
+    G4VPrimaryGenerator{},
+    fProcess{Process::M2ENNEE},
+    fMomentum{},
+    fPolarization{},
+    fIRCut{electron_mass_c2},
+    fThinningRatio{},
+    fACFSampleSize{},
+    fIntegralPrecisionGoal{0.01},
+    fIntegrationCacheDirectory{"mace_integration_cache"},
+    fVertexPosition{},
+    fVertexTime{},
+    fDecayTime{},
+    fDecayPosition{},
+    fGenerator{},
+    fBranchingRatio{},
+    fMessengerRegister{this} {}
+
+auto MatrixElementPrimaryGenerator::LoadDecayVertex(const std::string& fileName, const std::string& treeName) -> void {
+    fDecayTime.clear();
+    fDecayPosition.clear();
+    // each process keeps its share of the vertices, which samples the same distribution
+    Mustard::Data::Processor processor;
+    processor.Process<DecayVertexModel>(
+        ROOT::RDataFrame{treeName, fileName}, int{}, "EvtID",
+        [&](bool byPass, auto&& event) {
+            if (byPass) {
+                return;
+            }
+            for (auto&& vertex : event) {
+                const auto x{Get<"x">(*vertex).template As<muc::array3d>()};
+                fDecayTime.emplace_back(Get<"t">(*vertex));
+                fDecayPosition.emplace_back(x[0], x[1], x[2]);
+            }
+        });
+    if (fDecayPosition.empty()) {
+        Mustard::PrintWarning(fmt::format("No decay vertex loaded from {}:{}, the fixed vertex will be used", fileName, treeName));
+    }
+}
+
+auto MatrixElementPrimaryGenerator::Initialize() -> void {
+    switch (fProcess) {
+    case Process::M2ENNE:
+        fGenerator.emplace<Mustard::M2ENNEGenerator>("muonium", fMomentum, fIRCut, fThinningRatio, fACFSampleSize);
+        break;
+    case Process::M2ENNEE:
+        fGenerator.emplace<Mustard::M2ENNEEGenerator>("mu+", fMomentum, fPolarization, fThinningRatio, fACFSampleSize);
+        break;
+    case Process::M2ENNGG:
+        fGenerator.emplace<Mustard::M2ENNGGGenerator>("mu+", fMomentum, fPolarization, fIRCut, fThinningRatio, fACFSampleSize);
+        break;
+    }
+    const auto [parentMass, parentLifetime]{fProcess == Process::M2ENNE ? std::pair{muonium_mass_c2, muonium_lifetime} :
+                                                                          std::pair{muon_mass_c2, muon_lifetime}};
+
+    std::visit(
+        [&]<typename G>(G& generator) {
+            if constexpr (not std::same_as<G, std::monostate>) {
+                // integrate phase space, sharing the integration cache with the GenM2ENN* programs
+                Mustard::Executor<unsigned long long> executor{"Integration", "Sample"};
+                std::optional<PhaseSpaceIntegrationCache> cache;
+                if (not fIntegrationCacheDirectory.empty()) {
+                    cache.emplace(fIntegrationCacheDirectory, PhysicsKey());
+                }
+                const auto initialState{cache ? cache->Load() : std::nullopt};
+                const auto [integral, nEff, integrationState]{initialState ?
+                                                                  generator.PhaseSpaceIntegral(executor, fIntegralPrecisionGoal, *initialState) :
+                                                                  generator.PhaseSpaceIntegral(executor, fIntegralPrecisionGoal)};
+                if (cache) {
+                    cache->Merge(initialState.value_or(Mustard::Math::MCIntegrationState{}), integrationState);
+                }
+                const auto width{muc::pow(2 * pi, 4) / (2 * parentMass) * integral};
+                const auto branchingRatio{width * (parentLifetime / hbar_Planck)};
+                fBranchingRatio = branchingRatio.value;
+                Mustard::MasterPrintLn("In-process generator branching ratio: {} +/- {} (rel. unc.: {:.3}%, N_eff: {:.2f})",
+                                       branchingRatio.value, branchingRatio.uncertainty,
+                                       branchingRatio.uncertainty / branchingRatio.value * 100, nEff);
+                // burn in
+                generator.MCMCInitialize(*G4Random::getTheEngine());
+            }
+        },
+        fGenerator);
+}
+
+auto MatrixElementPrimaryGenerator::GeneratePrimaryVertex(G4Event* event) -> void {
+    if (std::holds_alternative<std::monostate>(fGenerator)) {
+        Mustard::Throw<std::logic_error>("MatrixElementPrimaryGenerator not initialized (try /MACE/Generator/MatrixElement/Initialize)");
+    }
+    auto& rng{*G4Random::getTheEngine()};
+
+    auto position{fVertexPosition};
+    auto time{fVertexTime};
+    if (not fDecayPosition.empty()) {
+        const auto i{static_cast<gsl::index>(rng.flat() * fDecayPosition.size())};
+        position = fDecayPosition[i];
+        time = fDecayTime[i];
+    }
+
+    const auto primaryVertex{new G4PrimaryVertex{position, time}};
+    std::visit(
+        [&]<typename G>(G& generator) {
+            if constexpr (not std::same_as<G, std::monostate>) {
+                const auto [weight, pdgID, p]{generator(rng)};
+                primaryVertex->SetWeight(fBranchingRatio * weight);
+                for (gsl::index i{}; i < ssize(pdgID); ++i) {
+                    if (const auto absPDGID{std::abs(pdgID[i])};
+                        absPDGID == 12 or absPDGID == 14 or absPDGID == 16) {
+                        continue;
+                    }
+                    primaryVertex->SetPrimary(new G4PrimaryParticle{pdgID[i], p[i].x(), p[i].y(), p[i].z()});
+                }
+            }
+        },
+        fGenerator);
+    event->AddPrimaryVertex(primaryVertex);
+}
+
+auto MatrixElementPrimaryGenerator::PhysicsKey() const -> std::string {
+    // same as the unbiased GenM2ENN* keys, so that both reuse one integration
+    switch (fProcess) {
+    case Process::M2ENNE:
+        return fmt::format("M2ENNE|p:{},{},{};ir-cut:{};;", fMomentum.x(), fMomentum.y(), fMomentum.z(), fIRCut);
+    case Process::M2ENNEE:
+        return fmt::format("M2ENNEE|p:{},{},{};P:{},{},{};;;", fMomentum.x(), fMomentum.y(), fMomentum.z(),
+                           fPolarization.x(), fPolarization.y(), fPolarization.z());
+    case Process::M2ENNGG:
+        return fmt::format("M2ENNGG|p:{},{},{};P:{},{},{};ir-cut:{};", fMomentum.x(), fMomentum.y(), fMomentum.z(),
+                           fPolarization.x(), fPolarization.y(), fPolarization.z(), fIRCut);
+    }
+    muc::unreachable();
+}
+
+} // namespace MACE::inline Simulation::inline Generator
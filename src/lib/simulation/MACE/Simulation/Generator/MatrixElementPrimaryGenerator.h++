@@ -0,0 +1,84 @@
+#pragma once
+
+#include "MACE/Simulation/Generator/MatrixElementPrimaryGeneratorMessenger.h++"
+
+#include "Mustard/Physics/Generator/M2ENNEEGenerator.h++"
+#include "Mustard/Physics/Generator/M2ENNEGenerator.h++"
+#include "Mustard/Physics/Generator/M2ENNGGGenerator.h++"
+
+#include "G4ThreeVector.hh"
+#include "G4VPrimaryGenerator.hh"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+class G4Event;
+
+namespace MACE::inline Simulation::inline Generator {
+
+/// @brief Samples muon / muonium decays from a matrix-element-based MCMC generator on demand,
+/// inside the Geant4 event loop, instead of reading GeneratedKinematics files.
+///
+/// Initialize() integrates the phase space (reusing and updating the same integration cache
+/// as the GenM2ENN* programs) and burns in the chain; it is collective over MPI_COMM_WORLD.
+/// Each event gets one primary vertex carrying the decay products (neutrinos omitted) and the
+/// weight branching ratio x bias compensation, i.e. the "w" of GeneratedKinematics.
+/// The decay position and time are either fixed, or drawn from decay vertices
+/// ("t", "x") of a previous simulation, e.g. SimTarget's MuoniumTrack.
+class MatrixElementPrimaryGenerator : public G4VPrimaryGenerator {
+public:
+    enum struct Process {
+        M2ENNE,
+        M2ENNEE,
+        M2ENNGG
+    };
+
+public:
+    MatrixElementPrimaryGenerator();
+
+    auto SelectedProcess(Process val) -> void { fProcess = val; }
+    auto Momentum(G4ThreeVector val) -> void { fMomentum = val; }
+    auto Polarization(G4ThreeVector val) -> void { fPolarization = val; }
+    auto IRCut(double val) -> void { fIRCut = val; }
+    auto ThinningRatio(double val) -> void { fThinningRatio = val; }
+    auto ACFSampleSize(unsigned val) -> void { fACFSampleSize = val; }
+    auto IntegralPrecisionGoal(double val) -> void { fIntegralPrecisionGoal = val; }
+    auto IntegrationCacheDirectory(std::filesystem::path val) -> void { fIntegrationCacheDirectory = std::move(val); }
+    auto VertexPosition(G4ThreeVector val) -> void { fVertexPosition = val; }
+    auto VertexTime(double val) -> void { fVertexTime = val; }
+    auto LoadDecayVertex(const std::string& fileName, const std::string& treeName) -> void;
+
+    auto BranchingRatio() const -> auto { return fBranchingRatio; }
+
+    auto Initialize() -> void;
+
+    auto GeneratePrimaryVertex(G4Event* event) -> void override;
+
+private:
+    auto PhysicsKey() const -> std::string;
+
+private:
+    Process fProcess;
+    G4ThreeVector fMomentum;
+    G4ThreeVector fPolarization;
+    double fIRCut;
+    std::optional<double> fThinningRatio;
+    std::optional<unsigned> fACFSampleSize;
+    double fIntegralPrecisionGoal;
+    std::filesystem::path fIntegrationCacheDirectory;
+
+    G4ThreeVector fVertexPosition;
+    double fVertexTime;
+    std::vector<double> fDecayTime;
+    std::vector<G4ThreeVector> fDecayPosition;
+
+    std::variant<std::monostate, Mustard::M2ENNEGenerator, Mustard::M2ENNEEGenerator, Mustard::M2ENNGGGenerator> fGenerator;
+    double fBranchingRatio;
+
+    MatrixElementPrimaryGeneratorMessenger::Register<MatrixElementPrimaryGenerator> fMessengerRegister;
+};
+
+} // namespace MACE::inline Simulation::inline Generator
@@ -0,0 +1,167 @@
+#include "MACE/Simulation/Generator/MatrixElementPrimaryGenerator.h++"
+#include "MACE/Simulation/Generator/MatrixElementPrimaryGeneratorMessenger.h++"
+
+#include "G4UIcmdWith3Vector.hh"
+#include "G4UIcmdWith3VectorAndUnit.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithoutParameter.hh"
+#include "G4UIcommand.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIparameter.hh"
+
+#include <sstream>
+#include <string>
+
+namespace MACE::inline Simulation::inline Messenger {
+
+MatrixElementPrimaryGeneratorMessenger::MatrixElementPrimaryGeneratorMessenger() :
+    SingletonMessenger{},
+    fDirectory{},
+    fProcess{},
+    fMomentum{},
+    fPolarization{},
+    fIRCut{},
+    fThinningRatio{},
+    fACFSampleSize{},
+    fIntegralPrecisionGoal{},
+    fIntegrationCacheDirectory{},
+    fVertexPosition{},
+    fVertexTime{},
+    fDecayVertexData{},
+    fInitialize{} {
+
+    fDirectory = std::make_unique<G4UIdirectory>("/MACE/Generator/MatrixElement/");
+    fDirectory->SetGuidance("In-process matrix-element-based decay generator.");
+
+    fProcess = std::make_unique<G4UIcmdWithAString>("/MACE/Generator/MatrixElement/Process", this);
+    fProcess->SetGuidance("Decay process: M2ENNE (muonium), M2ENNEE or M2ENNGG (mu+).");
+    fProcess->SetParameterName("process", false);
+    fProcess->SetCandidates("M2ENNE M2ENNEE M2ENNGG");
+    fProcess->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fMomentum = std::make_unique<G4UIcmdWith3VectorAndUnit>("/MACE/Generator/MatrixElement/Momentum", this);
+    fMomentum->SetGuidance("Momentum of the decaying particle.");
+    fMomentum->SetParameterName("px", "py", "pz", false);
+    fMomentum->SetUnitCategory("Energy");
+    fMomentum->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fPolarization = std::make_unique<G4UIcmdWith3Vector>("/MACE/Generator/MatrixElement/Polarization", this);
+    fPolarization->SetGuidance("Polarization of the decaying muon (M2ENNEE and M2ENNGG).");
+    fPolarization->SetParameterName("Px", "Py", "Pz", false);
+    fPolarization->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fIRCut = std::make_unique<G4UIcmdWithADoubleAndUnit>("/MACE/Generator/MatrixElement/IRCut", this);
+    fIRCut->SetGuidance("IR cut for the final-state electron (M2ENNE) or photons (M2ENNGG).");
+    fIRCut->SetParameterName("E", false);
+    fIRCut->SetUnitCategory("Energy");
+    fIRCut->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fThinningRatio = std::make_unique<G4UIcmdWithADouble>("/MACE/Generator/MatrixElement/ThinningRatio", this);
+    fThinningRatio->SetGuidance("Thinning ratio in MCMC sampling.");
+    fThinningRatio->SetParameterName("ratio", false);
+    fThinningRatio->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fACFSampleSize = std::make_unique<G4UIcmdWithAnInteger>("/MACE/Generator/MatrixElement/ACFSampleSize", this);
+    fACFSampleSize->SetGuidance("Sample size for estimation autocorrelation function (ACF).");
+    fACFSampleSize->SetParameterName("n", false);
+    fACFSampleSize->SetRange("n >= 1");
+    fACFSampleSize->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fIntegralPrecisionGoal = std::make_unique<G4UIcmdWithADouble>("/MACE/Generator/MatrixElement/IntegralPrecisionGoal", this);
+    fIntegralPrecisionGoal->SetGuidance("Precision goal for phase-space integral.");
+    fIntegralPrecisionGoal->SetParameterName("precision", false);
+    fIntegralPrecisionGoal->SetRange("precision > 0");
+    fIntegralPrecisionGoal->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fIntegrationCacheDirectory = std::make_unique<G4UIcmdWithAString>("/MACE/Generator/MatrixElement/IntegrationCache", this);
+    fIntegrationCacheDirectory->SetGuidance("Directory of the phase-space integration cache (shared with GenM2ENN*), or 'none' to disable it.");
+    fIntegrationCacheDirectory->SetParameterName("directory", false);
+    fIntegrationCacheDirectory->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fVertexPosition = std::make_unique<G4UIcmdWith3VectorAndUnit>("/MACE/Generator/MatrixElement/VertexPosition", this);
+    fVertexPosition->SetGuidance("Fixed decay position (used if no decay vertex data loaded).");
+    fVertexPosition->SetParameterName("x", "y", "z", false);
+    fVertexPosition->SetUnitCategory("Length");
+    fVertexPosition->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fVertexTime = std::make_unique<G4UIcmdWithADoubleAndUnit>("/MACE/Generator/MatrixElement/VertexTime", this);
+    fVertexTime->SetGuidance("Fixed decay time (used if no decay vertex data loaded).");
+    fVertexTime->SetParameterName("t", false);
+    fVertexTime->SetUnitCategory("Time");
+    fVertexTime->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fDecayVertexData = std::make_unique<G4UIcommand>("/MACE/Generator/MatrixElement/DecayVertexData", this);
+    fDecayVertexData->SetGuidance("Draw decay position and time from decay vertices (columns 't' and 'x') in a ROOT file, "
+                                  "e.g. SimTarget's G4Run0/MuoniumTrack.");
+    fDecayVertexData->SetParameter(new G4UIparameter{"file", 's', false});
+    fDecayVertexData->SetParameter(new G4UIparameter{"tree", 's', false});
+    fDecayVertexData->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fInitialize = std::make_unique<G4UIcmdWithoutParameter>("/MACE/Generator/MatrixElement/Initialize", this);
+    fInitialize->SetGuidance("Integrate phase space (with cache) and burn in the generator. Must be executed by all processes.");
+    fInitialize->AvailableForStates(G4State_Idle);
+}
+
+MatrixElementPrimaryGeneratorMessenger::~MatrixElementPrimaryGeneratorMessenger() = default;
+
+auto MatrixElementPrimaryGeneratorMessenger::SetNewValue(G4UIcommand* command, G4String value) -> void {
+    if (command == fProcess.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            using enum MatrixElementPrimaryGenerator::Process;
+            r.SelectedProcess(value == "M2ENNE" ? M2ENNE : (value == "M2ENNGG" ? M2ENNGG : M2ENNEE));
+        });
+    } else if (command == fMomentum.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.Momentum(fMomentum->GetNew3VectorValue(value));
+        });
+    } else if (command == fPolarization.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.Polarization(fPolarization->GetNew3VectorValue(value));
+        });
+    } else if (command == fIRCut.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.IRCut(fIRCut->GetNewDoubleValue(value));
+        });
+    } else if (command == fThinningRatio.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.ThinningRatio(fThinningRatio->GetNewDoubleValue(value));
+        });
+    } else if (command == fACFSampleSize.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.ACFSampleSize(fACFSampleSize->GetNewIntValue(value));
+        });
+    } else if (command == fIntegralPrecisionGoal.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.IntegralPrecisionGoal(fIntegralPrecisionGoal->GetNewDoubleValue(value));
+        });
+    } else if (command == fIntegrationCacheDirectory.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.IntegrationCacheDirectory(value == "none" ? std::string{} : std::string{value});
+        });
+    } else if (command == fVertexPosition.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.VertexPosition(fVertexPosition->GetNew3VectorValue(value));
+        });
+    } else if (command == fVertexTime.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.VertexTime(fVertexTime->GetNewDoubleValue(value));
+        });
+    } else if (command == fDecayVertexData.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            std::istringstream is{value};
+            std::string file;
+            std::string tree;
+            is >> file >> tree;
+            r.LoadDecayVertex(file, tree);
+        });
+    } else if (command == fInitialize.get()) {
+        Deliver<MatrixElementPrimaryGenerator>([&](auto&& r) {
+            r.Initialize();
+        });
+    }
+}
+
+} // namespace MACE::inline Simulation::inline Messenger
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Mustard/Geant4X/Interface/SingletonMessenger.h++"
+
+#include <memory>
+
+class G4UIcmdWith3Vector;
+class G4UIcmdWith3VectorAndUnit;
+class G4UIcmdWithADouble;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+class G4UIcommand;
+class G4UIdirectory;
+
+namespace MACE::inline Simulation {
+
+inline namespace Generator {
+class MatrixElementPrimaryGenerator;
+} // namespace Generator
+
+inline namespace Messenger {
+
+class MatrixElementPrimaryGeneratorMessenger final : public Mustard::Geant4X::SingletonMessenger<MatrixElementPrimaryGeneratorMessenger,
+                                                                                                 MatrixElementPrimaryGenerator> {
+    friend Mustard::Env::Memory::SingletonInstantiator;
+
+private:
+    MatrixElementPrimaryGeneratorMessenger();
+    ~MatrixElementPrimaryGeneratorMessenger();
+
+public:
+    auto SetNewValue(G4UIcommand* command, G4String value) -> void override;
+
+private:
+    std::unique_ptr<G4UIdirectory> fDirectory;
+    std::unique_ptr<G4UIcmdWithAString> fProcess;
+    std::unique_ptr<G4UIcmdWith3VectorAndUnit> fMomentum;
+    std::unique_ptr<G4UIcmdWith3Vector> fPolarization;
+    std::unique_ptr<G4UIcmdWithADoubleAndUnit> fIRCut;
+    std::unique_ptr<G4UIcmdWithADouble> fThinningRatio;
+    std::unique_ptr<G4UIcmdWithAnInteger> fACFSampleSize;
+    std::unique_ptr<G4UIcmdWithADouble> fIntegralPrecisionGoal;
+    std::unique_ptr<G4UIcmdWithAString> fIntegrationCacheDirectory;
+    std::unique_ptr<G4UIcmdWith3VectorAndUnit> fVertexPosition;
+    std::unique_ptr<G4UIcmdWithADoubleAndUnit> fVertexTime;
+    std::unique_ptr<G4UIcommand> fDecayVertexData;
+    std::unique_ptr<G4UIcmdWithoutParameter> fInitialize;
+};
+
+} // namespace Messenger
+
+} // namespace MACE::inline Simulation
@@ -0,0 +1,78 @@
+#include "MACE/Simulation/Generator/PrimaryIndex.h++"
+
+#include "G4DynamicParticle.hh"
+#include "G4PrimaryParticle.hh"
+#include "G4PrimaryVertex.hh"
+#include "G4Track.hh"
+#include "G4VUserPrimaryParticleInformation.hh"
+#include "G4VUserTrackInformation.hh"
+#include "G4ios.hh"
+
+namespace MACE::inline Simulation::inline Generator {
+
+namespace {
+
+class PrimaryParticleInformation final : public G4VUserPrimaryParticleInformation {
+public:
+    explicit PrimaryParticleInformation(int index) :
+        G4VUserPrimaryParticleInformation{},
+        fIndex{index} {}
+
+    auto Index() const -> auto { return fIndex; }
+
+    auto Print() const -> void override { G4cout << "PrmID: " << fIndex << G4endl; }
+
+private:
+    int fIndex;
+};
+
+class TrackInformation final : public G4VUserTrackInformation {
+public:
+    explicit TrackInformation(int index) :
+        G4VUserTrackInformation{"PrimaryIndex"},
+        fIndex{index} {}
+
+    auto Index() const -> auto { return fIndex; }
+
+    auto Print() const -> void override { G4cout << "PrmID: " << fIndex << G4endl; }
+
+private:
+    int fIndex;
+};
+
+} // namespace
+
+auto PrimaryIndex::Assign(G4PrimaryVertex& vertex, int index) -> void {
+    for (auto pp{vertex.GetPrimary()}; pp; pp = pp->GetNext()) {
+        pp->SetUserInformation(new PrimaryParticleInformation{index}); // G4PrimaryParticle takes ownership
+    }
+}
+
+auto PrimaryIndex::PropagateToSecondary(const G4Track& track, const G4TrackVector& secondary) -> void {
+    const auto index{Of(track)};
+    if (index == 0) {
+        return; // index 0 is the default, save the allocations
+    }
+    for (auto&& sec : secondary) {
+        if (sec->GetUserInformation() == nullptr) {
+            sec->SetUserInformation(new TrackInformation{index}); // G4Track takes ownership
+        }
+    }
+}
+
+auto PrimaryIndex::Of(const G4PrimaryParticle& particle) -> int {
+    const auto info{dynamic_cast<const PrimaryParticleInformation*>(particle.GetUserInformation())};
+    return info ? info->Index() : 0;
+}
+
+auto PrimaryIndex::Of(const G4Track& track) -> int {
+    if (const auto info{dynamic_cast<const TrackInformation*>(track.GetUserInformation())}) {
+        return info->Index();
+    }
+    if (const auto primary{track.GetDynamicParticle()->GetPrimaryParticle()}) {
+        return Of(*primary);
+    }
+    return 0;
+}
+
+} // namespace MACE::inline Simulation::inline Generator
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "G4TrackVector.hh"
+
+class G4PrimaryParticle;
+class G4PrimaryVertex;
+class G4Track;
+
+namespace MACE::inline Simulation::inline Generator {
+
+/// @brief Index of the primary (e.g. the k-th beam muon of a pile-up event) that a particle
+/// descends from, recorded as "PrmID" in the MC truth.
+///
+/// The primary generator assigns it to primary vertices, and the tracking action passes it
+/// on to secondaries with PropagateToSecondary. Particles without an assigned index
+/// (i.e. all particles of an ordinary single-primary event) have index 0.
+class PrimaryIndex final {
+public:
+    PrimaryIndex() = delete;
+
+    static auto Assign(G4PrimaryVertex& vertex, int index) -> void;
+    static auto PropagateToSecondary(const G4Track& track, const G4TrackVector& secondary) -> void;
+
+    static auto Of(const G4PrimaryParticle& particle) -> int;
+    static auto Of(const G4Track& track) -> int;
+};
+
+} // namespace MACE::inline Simulation::inline Generator
@@ -0,0 +1,214 @@
+#include "MACE/Simulation/Run/DesignScan.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "G4GeometryManager.hh"
+#include "G4StateManager.hh"
+#include "G4UImanager.hh"
+
+#include "mplr/mplr.hpp"
+
+#include "yaml-cpp/yaml.h"
+
+#include "fmt/format.h"
+#include "fmt/ranges.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <unistd.h>
+
+namespace MACE::inline Simulation::inline Run {
+
+namespace {
+
+auto SetNode(YAML::Node node, std::span<const std::string> key, const YAML::Node& value) -> void {
+    if (key.size() == 1) {
+        node[key.front()] = value;
+        return;
+    }
+    SetNode(node[key.front()], key.subspan(1), value);
+}
+
+} // namespace
+
+DesignScan::DesignScan(std::function<void()> destroyGeometry) :
+    fDestroyGeometry{std::move(destroyGeometry)},
+    fParameter{},
+    fOutputDirectory{"DesignScan"},
+    fPointMacro{},
+    fMessengerRegister{this} {}
+
+auto DesignScan::AddParameter(std::string field, std::vector<std::string> value) -> void {
+    std::vector<std::string> key;
+    for (auto&& k : field | std::views::split('.')) {
+        key.emplace_back(k.begin(), k.end());
+    }
+    if (key.size() < 2 or std::ranges::any_of(key, [](auto&& k) { return k.empty(); })) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Invalid design scan field '{}' (expect <Description>.<Field>[.<SubField>...])", field));
+    }
+    if (value.empty()) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("No value given for design scan field '{}'", field));
+    }
+    if (std::ranges::find(fParameter, field, &Parameter::field) != fParameter.cend()) {
+        Mustard::Throw<std::invalid_argument>(fmt::format("Design scan field '{}' added twice", field));
+    }
+    fParameter.push_back({std::move(field), std::move(key), std::move(value)});
+}
+
+auto DesignScan::Run(int nEvent) const -> void {
+    if (fParameter.empty()) {
+        Mustard::Throw<std::runtime_error>("No design scan parameter (see /MACE/DesignScan/Parameter)");
+    }
+    const auto& worldComm{mplr::comm_world()};
+    const auto nPoint{NPoint()};
+    const auto nameWidth{fmt::formatted_size("{}", nPoint - 1)};
+
+    Mustard::MasterPrintLn("Design scan: {} point(s) over {}, {} event(s) per point, output in '{}'",
+                           nPoint, fmt::join(fParameter | std::views::transform(&Parameter::field), " x "),
+                           nEvent, fOutputDirectory.generic_string());
+
+    const auto uiManager{G4UImanager::GetUIpointer()};
+    std::vector<PointRecord> record;
+    record.reserve(nPoint);
+    std::vector<gsl::index> lastIndex;
+    for (gsl::index point{}; point < nPoint; ++point) {
+        const auto index{PointIndex(point)};
+        const auto name{fmt::format("point{:0{}}", point, nameWidth)};
+        const auto pointDirectory{fOutputDirectory / name};
+        if (worldComm.rank() == 0) {
+            std::filesystem::create_directories(pointDirectory);
+        }
+        worldComm.barrier();
+
+        // re-import changed fields and rebuild geometry, then let physics tables catch up
+        using Clock = std::chrono::steady_clock;
+        const auto setupBegin{Clock::now()};
+        ImportChanged(index, lastIndex, pointDirectory);
+        const auto initialize{G4StateManager::GetStateManager()->GetCurrentState() == G4State_PreInit};
+        if (initialize) {
+            Apply("/run/initialize");
+        } else {
+            // destroy the old geometry (reinitializeGeometry alone would leak it), then clean the stores
+            G4GeometryManager::GetInstance()->OpenGeometry();
+            fDestroyGeometry();
+            Apply("/run/reinitializeGeometry true");
+        }
+        Apply("/run/beamOn 0");
+        worldComm.barrier();
+        const std::chrono::duration<double> setupTime{Clock::now() - setupBegin};
+
+        uiManager->SetAlias(fmt::format("scanPointDirectory {}", pointDirectory.generic_string()).c_str());
+        uiManager->SetAlias(fmt::format("scanPointName {}", name).c_str());
+        if (not fPointMacro.empty()) {
+            Apply(fmt::format("/control/execute {}", fPointMacro));
+        }
+
+        const auto eventLoopBegin{Clock::now()};
+        Apply(fmt::format("/run/beamOn {}", nEvent));
+        worldComm.barrier();
+        const std::chrono::duration<double> eventLoopTime{Clock::now() - eventLoopBegin};
+
+        record.push_back({name, setupTime.count(), eventLoopTime.count()});
+        Mustard::MasterPrintLn("Design scan point {}/{} ({}): {}\n"
+                               "  setup {:.3f} s ({}), event loop {:.3f} s, {:.2f} events/s",
+                               point + 1, nPoint, name,
+                               fmt::join(std::views::iota(gsl::index{}, std::ssize(fParameter)) | std::views::transform([&](auto i) {
+                                             return fmt::format("{}={}", fParameter[i].field, fParameter[i].value[index[i]]);
+                                         }),
+                                         ", "),
+                               setupTime.count(), initialize ? "kernel initialized" : (point == 0 ? "geometry rebuilt" : "geometry rebuilt, unchanged physics tables kept"),
+                               eventLoopTime.count(), nEvent / eventLoopTime.count());
+        lastIndex = index;
+    }
+
+    WriteSummary(record, nEvent);
+}
+
+auto DesignScan::NPoint() const -> gsl::index {
+    return std::transform_reduce(fParameter.cbegin(), fParameter.cend(), gsl::index{1}, std::multiplies{},
+                                 [](auto&& p) { return std::ssize(p.value); });
+}
+
+auto DesignScan::PointIndex(gsl::index point) const -> std::vector<gsl::index> {
+    // mixed radix, last parameter varies fastest
+    std::vector<gsl::index> index(fParameter.size());
+    for (auto i{std::ssize(fParameter) - 1}; i >= 0; --i) {
+        const auto n{std::ssize(fParameter[i].value)};
+        index[i] = point % n;
+        point /= n;
+    }
+    return index;
+}
+
+auto DesignScan::ImportChanged(const std::vector<gsl::index>& index, const std::vector<gsl::index>& lastIndex,
+                               const std::filesystem::path& pointDirectory) const -> void {
+    YAML::Node changed{YAML::NodeType::Map};
+    YAML::Node full{YAML::NodeType::Map};
+    for (gsl::index i{}; i < std::ssize(fParameter); ++i) {
+        const auto& [field, key, value]{fParameter[i]};
+        const auto node{YAML::Load(value[index[i]])};
+        SetNode(full, key, node);
+        if (lastIndex.empty() or index[i] != lastIndex[i]) {
+            SetNode(changed, key, node);
+        }
+    }
+
+    // rank-local file: does not rely on a shared file system
+    const auto changedPath{std::filesystem::temp_directory_path() /
+                           fmt::format("MACE_DesignScan_{}_{}.yaml", ::getpid(), mplr::comm_world().rank())};
+    std::ofstream{changedPath} << YAML::Dump(changed) << '\n';
+    Apply(fmt::format("/Mustard/Detector/Description/Import {}", changedPath.generic_string()));
+    std::filesystem::remove(changedPath);
+
+    if (mplr::comm_world().rank() == 0) {
+        std::ofstream{pointDirectory / "design.yaml"} << YAML::Dump(full) << '\n';
+    }
+}
+
+auto DesignScan::WriteSummary(const std::vector<PointRecord>& record, int nEvent) const -> void {
+    if (mplr::comm_world().rank() != 0) {
+        return;
+    }
+    std::ofstream csv{fOutputDirectory / "scan.csv"};
+    csv << fmt::format("point,{},setup_s,event_loop_s,events_per_s\n",
+                       fmt::join(fParameter | std::views::transform(&Parameter::field), ","));
+    for (gsl::index point{}; point < std::ssize(record); ++point) {
+        const auto index{PointIndex(point)};
+        const auto& [name, setupTime, eventLoopTime]{record[point]};
+        csv << fmt::format("{},{},{},{},{}\n", name,
+                           fmt::join(std::views::iota(gsl::index{}, std::ssize(fParameter)) | std::views::transform([&](auto i) {
+                                         return fParameter[i].value[index[i]];
+                                     }),
+                                     ","),
+                           setupTime, eventLoopTime, nEvent / eventLoopTime);
+    }
+
+    const auto sumOf{[&](auto member, gsl::index first) {
+        return std::transform_reduce(std::next(record.cbegin(), first), record.cend(), 0., std::plus{},
+                                     [&](auto&& r) { return std::invoke(member, r); });
+    }};
+    Mustard::MasterPrintLn("Design scan done: {} point(s), {:.2f} events/s on average. Setup: {:.3f} s at the first point{}. Summary in '{}'",
+                           record.size(), record.size() * nEvent / sumOf(&PointRecord::eventLoopTime, 0), record.front().setupTime,
+                           record.size() > 1 ?
+                               fmt::format(", {:.3f} s per point afterwards", sumOf(&PointRecord::setupTime, 1) / (record.size() - 1)) :
+                               "",
+                           (fOutputDirectory / "scan.csv").generic_string());
+}
+
+auto DesignScan::Apply(const std::string& command) -> void {
+    if (const auto status{G4UImanager::GetUIpointer()->ApplyCommand(command)};
+        status != fCommandSucceeded) {
+        Mustard::Throw<std::runtime_error>(fmt::format("Design scan: '{}' failed (G4UIcommandStatus {})", command, status));
+    }
+}
+
+} // namespace MACE::inline Simulation::inline Run
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "MACE/Simulation/Run/DesignScanMessenger.h++"
+
+#include "gsl/gsl"
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace MACE::inline Simulation::inline Run {
+
+/// @brief Runs a grid of detector designs in one long-lived (MPI) Geant4 job.
+///
+/// Each parameter is a detector description field (e.g. ECAL.InnerRadius) with a list of
+/// YAML values; the scan visits the Cartesian product of all value lists, the last
+/// parameter varying fastest. For every point, only the fields changed since the previous
+/// point are re-imported, the old geometry is destroyed and rebuilt through
+/// /run/reinitializeGeometry, and an optional per-point macro plus /run/beamOn are executed.
+/// Physics lists, physics tables of unchanged material-cut couples and everything else set
+/// up before the scan are kept across points. If the kernel is not initialized yet, the
+/// first point runs /run/initialize itself.
+///
+/// The point output directory and name are exported as the macro aliases
+/// {scanPointDirectory} and {scanPointName}, so the per-point macro can e.g. set
+/// /MACE/Analysis/FilePath {scanPointDirectory}/SimECAL.root.
+/// Setup (geometry rebuild + physics-table update) and event-loop wall time are reported
+/// per point and summarized in <output directory>/scan.csv.
+///
+/// @note The detector construction must be re-entrant, i.e. rebuild volumes from the
+/// current descriptions, and reuse sensitive detectors already registered after reloading
+/// their description-derived state. destroyGeometry must delete the volumes it owns
+/// (e.g. reset the world definition); whatever is left in the Geant4 stores is cleaned
+/// by /run/reinitializeGeometry afterwards.
+class DesignScan {
+public:
+    explicit DesignScan(std::function<void()> destroyGeometry);
+
+    auto AddParameter(std::string field, std::vector<std::string> value) -> void;
+    auto ClearParameter() -> void { fParameter.clear(); }
+    auto OutputDirectory(std::filesystem::path val) -> void { fOutputDirectory = std::move(val); }
+    auto PointMacro(std::string val) -> void { fPointMacro = std::move(val); }
+
+    auto Run(int nEvent) const -> void;
+
+private:
+    struct Parameter {
+        std::string field;
+        std::vector<std::string> key;
+        std::vector<std::string> value;
+    };
+
+    struct PointRecord {
+        std::string name;
+        double setupTime;
+        double eventLoopTime;
+    };
+
+private:
+    auto NPoint() const -> gsl::index;
+    auto PointIndex(gsl::index point) const -> std::vector<gsl::index>;
+    auto ImportChanged(const std::vector<gsl::index>& index, const std::vector<gsl::index>& lastIndex,
+                       const std::filesystem::path& pointDirectory) const -> void;
+    auto WriteSummary(const std::vector<PointRecord>& record, int nEvent) const -> void;
+
+    static auto Apply(const std::string& command) -> void;
+
+private:
+    std::function<void()> fDestroyGeometry;
+    std::vector<Parameter> fParameter;
+    std::filesystem::path fOutputDirectory;
+    std::string fPointMacro;
+
+    DesignScanMessenger::Register<DesignScan> fMessengerRegister;
+};
+
+} // namespace MACE::inline Simulation::inline Run
@@ -0,0 +1,87 @@
+#include "MACE/Simulation/Run/DesignScan.h++"
+#include "MACE/Simulation/Run/DesignScanMessenger.h++"
+
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithoutParameter.hh"
+#include "G4UIcommand.hh"
+#include "G4UIdirectory.hh"
+#include "G4UIparameter.hh"
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace MACE::inline Simulation::inline Messenger {
+
+DesignScanMessenger::DesignScanMessenger() :
+    SingletonMessenger{},
+    fDirectory{},
+    fParameter{},
+    fClearParameter{},
+    fOutputDirectory{},
+    fPointMacro{},
+    fRun{} {
+
+    fDirectory = std::make_unique<G4UIdirectory>("/MACE/DesignScan/");
+    fDirectory->SetGuidance("Scan a grid of detector designs in one job.");
+
+    fParameter = std::make_unique<G4UIcommand>("/MACE/DesignScan/Parameter", this);
+    fParameter->SetGuidance("Add a scan parameter: a detector description field (e.g. ECAL.InnerRadius) "
+                            "followed by its values (YAML scalars or flow sequences without spaces).");
+    fParameter->SetParameter(new G4UIparameter{"field", 's', false});
+    fParameter->SetParameter(new G4UIparameter{"values", 's', false});
+    fParameter->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fClearParameter = std::make_unique<G4UIcmdWithoutParameter>("/MACE/DesignScan/ClearParameter", this);
+    fClearParameter->SetGuidance("Remove all scan parameters.");
+    fClearParameter->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fOutputDirectory = std::make_unique<G4UIcmdWithAString>("/MACE/DesignScan/OutputDirectory", this);
+    fOutputDirectory->SetGuidance("Output directory. Each point gets a subdirectory, available as alias {scanPointDirectory}.");
+    fOutputDirectory->SetParameterName("directory", false);
+    fOutputDirectory->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fPointMacro = std::make_unique<G4UIcmdWithAString>("/MACE/DesignScan/PointMacro", this);
+    fPointMacro->SetGuidance("Macro executed at each point after the geometry rebuild, before /run/beamOn.");
+    fPointMacro->SetParameterName("macro", false);
+    fPointMacro->AvailableForStates(G4State_PreInit, G4State_Idle);
+
+    fRun = std::make_unique<G4UIcmdWithAnInteger>("/MACE/DesignScan/Run", this);
+    fRun->SetGuidance("Run the scan with N events per point. Must be executed by all processes.");
+    fRun->SetParameterName("N", false);
+    fRun->SetRange("N >= 0");
+    fRun->AvailableForStates(G4State_Idle);
+}
+
+DesignScanMessenger::~DesignScanMessenger() = default;
+
+auto DesignScanMessenger::SetNewValue(G4UIcommand* command, G4String value) -> void {
+    if (command == fParameter.get()) {
+        Deliver<DesignScan>([&](auto&& r) {
+            std::istringstream is{value};
+            std::string field;
+            is >> field;
+            r.AddParameter(std::move(field), {std::istream_iterator<std::string>{is}, {}});
+        });
+    } else if (command == fClearParameter.get()) {
+        Deliver<DesignScan>([&](auto&& r) {
+            r.ClearParameter();
+        });
+    } else if (command == fOutputDirectory.get()) {
+        Deliver<DesignScan>([&](auto&& r) {
+            r.OutputDirectory(std::string{value});
+        });
+    } else if (command == fPointMacro.get()) {
+        Deliver<DesignScan>([&](auto&& r) {
+            r.PointMacro(value);
+        });
+    } else if (command == fRun.get()) {
+        Deliver<DesignScan>([&](auto&& r) {
+            r.Run(fRun->GetNewIntValue(value));
+        });
+    }
+}
+
+} // namespace MACE::inline Simulation::inline Messenger
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Mustard/Geant4X/Interface/SingletonMessenger.h++"
+
+#include <memory>
+
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+class G4UIcommand;
+class G4UIdirectory;
+
+namespace MACE::inline Simulation {
+
+inline namespace Run {
+class DesignScan;
+} // namespace Run
+
+inline namespace Messenger {
+
+class DesignScanMessenger final : public Mustard::Geant4X::SingletonMessenger<DesignScanMessenger,
+                                                                              DesignScan> {
+    friend Mustard::Env::Memory::SingletonInstantiator;
+
+private:
+    DesignScanMessenger();
+    ~DesignScanMessenger();
+
+public:
+    auto SetNewValue(G4UIcommand* command, G4String value) -> void override;
+
+private:
+    std::unique_ptr<G4UIdirectory> fDirectory;
+    std::unique_ptr<G4UIcommand> fParameter;
+    std::unique_ptr<G4UIcmdWithoutParameter> fClearParameter;
+    std::unique_ptr<G4UIcmdWithAString> fOutputDirectory;
+    std::unique_ptr<G4UIcmdWithAString> fPointMacro;
+    std::unique_ptr<G4UIcmdWithAnInteger> fRun;
+};
+
+} // namespace Messenger
+
+} // namespace MACE::inline Simulation
@@ -1,4 +1,5 @@
 #include "MACE/Detector/Description/MMSField.h++"
+#include "MACE/Simulation/Generator/PrimaryIndex.h++"
 #include "MACE/Simulation/SD/CDCSD.h++"
 
 #include "Mustard/IO/PrettyLog.h++"
@@ -10,13 +11,14 @@
 #include "G4EventManager.hh"
 #include "G4HCofThisEvent.hh"
 #include "G4ParticleDefinition.hh"
+#include "G4Poisson.hh"
 #include "G4SDManager.hh"
 #include "G4Step.hh"
 #include "G4StepPoint.hh"
 #include "G4ThreeVector.hh"
-#include "G4TwoVector.hh"
 #include "G4VProcess.hh"
 #include "G4VTouchable.hh"
+#include "Randomize.hh"
 
 #include "muc/algorithm"
 #include "muc/numeric"
@@ -24,6 +26,8 @@
 
 #include <cassert>
 #include <cmath>
+#include <limits>
+#include <numbers>
 #include <ranges>
 #include <string_view>
 #include <tuple>
@@ -37,15 +41,18 @@ using namespace Mustard::VectorArithmeticOperator;
 CDCSD::CDCSD(const G4String& sdName) :
     G4VSensitiveDetector{sdName},
     fIonizingEnergyDepositionThreshold{25_eV},
-    fMeanDriftVelocity{},
+    fMeanClusterDensity{},
+    fXTRelation{},
     fCellMap{},
     fSplitHit{},
+    fPendingEdep{},
     fHitsCollection{},
     fMessengerRegister{this} {
     collectionName.emplace_back(sdName + "HC");
 
     const auto& cdc{Detector::Description::CDC::Instance()};
-    fMeanDriftVelocity = cdc.MeanDriftVelocity();
+    fMeanClusterDensity = cdc.MeanClusterDensity();
+    fXTRelation = &cdc.XTRelation();
     fCellMap = &cdc.CellMap();
 
     fSplitHit.reserve(fCellMap->size());
@@ -77,35 +84,72 @@ auto CDCSD::ProcessHits(G4Step* theStep, G4TouchableHistory*) -> G4bool {
     const auto cellID{touchable.GetReplicaNumber(1)};
     const auto& cellInfo{fCellMap->at(cellID)};
     assert(cellID == cellInfo.cellID);
-    const auto xWire{Mustard::VectorCast<G4TwoVector>(cellInfo.position)};
+    const G4ThreeVector xWire{cellInfo.position.x(), cellInfo.position.y(), 0};
     const auto tWire{Mustard::VectorCast<G4ThreeVector>(cellInfo.direction)};
-    // calculate drift distance
-    double driftDistance;
-    if (const auto pHat{muc::midpoint(preStepPoint.GetMomentumDirection(), postStepPoint.GetMomentumDirection())};
-        not pHat.isParallel(tWire)) {
-        const auto n{tWire.cross(pHat)};
-        driftDistance = std::abs((position - xWire).dot(n)) / n.mag();
-    } else {
-        const auto delta{position - xWire};
-        const auto n{tWire.dot(delta) * tWire - delta}; // == t x (t x delta)
-        const auto n2{n.mag2()};
-        driftDistance = std::isnormal(n2) ? std::abs(delta.dot(n)) / std::sqrt(n2) : 0;
+    const auto Transverse{[&tWire](const G4ThreeVector& v) { return v - v.dot(tWire) * tWire; }};
+    // entrance angle: track direction w.r.t. radial direction, both transverse to the wire, folded into [-pi/2, pi/2]
+    const auto pT{Transverse(muc::midpoint(preStepPoint.GetMomentumDirection(), postStepPoint.GetMomentumDirection()))};
+    const auto rT{Transverse(xWire)};
+    auto entranceAngle{std::atan2(rT.cross(pT).dot(tWire), rT.dot(pT))};
+    if (entranceAngle > std::numbers::pi / 2) {
+        entranceAngle -= std::numbers::pi;
+    } else if (entranceAngle < -std::numbers::pi / 2) {
+        entranceAngle += std::numbers::pi;
+    }
+    // primary ionization clusters are uniform along the step (x = x0 + f * dx, 0 <= f <= 1),
+    // a neutral particle only deposits locally at the post-step point.
+    // The earliest cluster to reach the wire makes the signal
+    const auto charged{particle.GetPDGCharge() != 0};
+    const auto nCluster{charged ? static_cast<int>(G4Poisson(fMeanClusterDensity * step.GetStepLength())) : 1};
+    if (nCluster == 0) {
+        // no signal, but the energy is still deposited: fold it into the latest hit of this track on this cell,
+        // or keep it for the next one
+        auto cellHit{fSplitHit[cellID] | std::views::reverse};
+        if (const auto sameTrack{std::ranges::find(cellHit, track.GetTrackID(),
+                                                   [](const auto& hit) { return *Get<"TrkID">(*hit); })};
+            sameTrack != cellHit.end()) {
+            Get<"Edep">(**sameTrack) += eDep;
+        } else {
+            fPendingEdep[cellID][track.GetTrackID()] += eDep;
+        }
+        return true;
+    }
+    const auto& xt{(*fXTRelation)[cellInfo.senseLayerID]};
+    const auto x0T{Transverse(preStepPoint.GetPosition() - xWire)};
+    const auto dxT{Transverse(postStepPoint.GetPosition() - preStepPoint.GetPosition())};
+    const auto t0{preStepPoint.GetGlobalTime()};
+    const auto dt{postStepPoint.GetGlobalTime() - t0};
+    auto signalTime{std::numeric_limits<double>::max()};
+    double driftDistance{};
+    for (int i{}; i < nCluster; ++i) {
+        const auto f{charged ? G4UniformRand() : 1};
+        const auto d{(x0T + f * dxT).mag()};
+        if (const auto t{t0 + f * dt + xt.DriftTime(d, entranceAngle)};
+            t < signalTime) {
+            signalTime = t;
+            driftDistance = d;
+        }
     }
-    const auto driftTime{driftDistance / fMeanDriftVelocity};
     const auto hitTime{muc::midpoint(preStepPoint.GetGlobalTime(), postStepPoint.GetGlobalTime())};
-    const auto signalTime{hitTime + driftTime};
     // vertex Ek and p
     const auto vertexEk{track.GetVertexKineticEnergy()};
     const auto vertexMomentum{track.GetVertexMomentumDirection() * std::sqrt(vertexEk * (vertexEk + 2 * particle.GetPDGMass()))};
     // track creator process
     const auto creatorProcess{track.GetCreatorProcess()};
     // new a hit
+    auto pendingEdep{0.};
+    if (const auto cellPending{fPendingEdep.find(cellID)}; cellPending != fPendingEdep.end()) {
+        if (const auto trackPending{cellPending->second.find(track.GetTrackID())}; trackPending != cellPending->second.end()) {
+            pendingEdep = trackPending->second;
+            cellPending->second.erase(trackPending);
+        }
+    }
     const auto& hit{fSplitHit[cellID].emplace_back(std::make_unique_for_overwrite<CDCHit>())};
     Get<"EvtID">(*hit) = G4EventManager::GetEventManager()->GetConstCurrentEvent()->GetEventID();
     Get<"HitID">(*hit) = -1; // to be determined
     Get<"CellID">(*hit) = cellID;
     Get<"t">(*hit) = signalTime;
-    Get<"Edep">(*hit) = eDep;
+    Get<"Edep">(*hit) = eDep + pendingEdep;
     Get<"d">(*hit) = driftDistance;
     Get<"Good">(*hit) = false; // to be determined
     Get<"tHit">(*hit) = hitTime;
@@ -113,6 +157,7 @@ auto CDCSD::ProcessHits(G4Step* theStep, G4TouchableHistory*) -> G4bool {
     Get<"Ek">(*hit) = preStepPoint.GetKineticEnergy();
     Get<"p">(*hit) = preStepPoint.GetMomentum();
     Get<"TrkID">(*hit) = track.GetTrackID();
+    Get<"PrmID">(*hit) = PrimaryIndex::Of(track);
     Get<"PDGID">(*hit) = particle.GetPDGEncoding();
     Get<"t0">(*hit) = track.GetGlobalTime() - track.GetLocalTime();
     Get<"x0">(*hit) = track.GetVertexPosition();
@@ -132,8 +177,8 @@ auto CDCSD::EndOfEvent(G4HCofThisEvent*) -> void {
 
     for (auto&& [cellID, splitHit] : fSplitHit) {
         switch (splitHit.size()) {
-        case 0:
-            muc::unreachable();
+        case 0: // only steps without ionization cluster
+            break;
         case 1: {
             auto& hit{splitHit.front()};
             assert(Get<"CellID">(*hit) == cellID);
@@ -165,8 +210,10 @@ auto CDCSD::EndOfEvent(G4HCofThisEvent*) -> void {
                                                        [](const auto& hit1, const auto& hit2) {
                                                            return Get<"TrkID">(*hit1) < Get<"TrkID">(*hit2);
                                                        })};
-                // construct real hit
+                // construct real hit, the signal is the leading edge
                 assert(Get<"CellID">(*topHit) == cellID);
+                Get<"t">(*topHit) = *Get<"t">(*cluster.front());
+                Get<"d">(*topHit) = *Get<"d">(*cluster.front());
                 auto nTopHit{1};
                 for (const auto& hit : cluster) {
                     if (hit == topHit) {
@@ -187,6 +234,8 @@ auto CDCSD::EndOfEvent(G4HCofThisEvent*) -> void {
         }
     }
     fSplitHit.clear();
+    // a track crossing a cell without any ionization cluster makes no hit
+    fPendingEdep.clear();
 
     muc::timsort(*fHitsCollection->GetVector(),
                  [](const auto& hit1, const auto& hit2) {
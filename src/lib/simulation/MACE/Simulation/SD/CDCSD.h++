@@ -30,10 +30,13 @@ public:
 protected:
     double fIonizingEnergyDepositionThreshold;
 
-    double fMeanDriftVelocity;
+    double fMeanClusterDensity;
+    const std::vector<Detector::Description::CDC::XTRelationTable>* fXTRelation;
     const std::vector<Detector::Description::CDC::CellInformation>* fCellMap;
 
     muc::flat_hash_map<int, muc::unique_ptrvec<CDCHit>> fSplitHit;
+    /// Edep of steps without an ionization cluster, waiting for a hit of the same track (cell ID -> track ID -> Edep)
+    muc::flat_hash_map<int, muc::flat_hash_map<int, double>> fPendingEdep;
     CDCHitCollection* fHitsCollection;
 
     CDCSDMessenger::Register<CDCSD> fMessengerRegister;
@@ -1,4 +1,5 @@
 #include "MACE/Detector/Description/ECAL.h++"
+#include "MACE/Simulation/Generator/PrimaryIndex.h++"
 #include "MACE/Simulation/SD/ECALPMSD.h++"
 #include "MACE/Simulation/SD/ECALSD.h++"
 
@@ -42,7 +43,10 @@ ECALSD::ECALSD(const G4String& sdName, const ECALPMSD* ecalPMSD) :
     fSplitHit{},
     fHitsCollection{} {
     collectionName.insert(sdName + "HC");
+    ReloadDescription();
+}
 
+auto ECALSD::ReloadDescription() -> void {
     const auto& ecal{Detector::Description::ECAL::Instance()};
     assert(ecal.ScintillationEnergyBin().size() == ecal.ScintillationComponent1().size());
     std::vector<double> dE(ecal.ScintillationEnergyBin().size());
@@ -100,6 +104,7 @@ auto ECALSD::ProcessHits(G4Step* theStep, G4TouchableHistory*) -> G4bool {
     Get<"Ek">(*hit) = preStepPoint.GetKineticEnergy();
     Get<"p">(*hit) = preStepPoint.GetMomentum();
     Get<"TrkID">(*hit) = track.GetTrackID();
+    Get<"PrmID">(*hit) = PrimaryIndex::Of(track);
     Get<"PDGID">(*hit) = particle.GetPDGEncoding();
     Get<"t0">(*hit) = track.GetGlobalTime() - track.GetLocalTime();
     Get<"x0">(*hit) = track.GetVertexPosition();
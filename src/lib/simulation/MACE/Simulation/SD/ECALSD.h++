@@ -15,6 +15,9 @@ class ECALSD : public G4VSensitiveDetector {
 public:
     ECALSD(const G4String& sdName, const ECALPMSD* ecalPMSD = {});
 
+    /// @brief Recompute the state derived from the ECAL description (e.g. after a re-import in a design scan).
+    auto ReloadDescription() -> void;
+
     virtual auto Initialize(G4HCofThisEvent* hitsCollection) -> void override;
     virtual auto ProcessHits(G4Step* theStep, G4TouchableHistory*) -> G4bool override;
     virtual auto EndOfEvent(G4HCofThisEvent*) -> void override;
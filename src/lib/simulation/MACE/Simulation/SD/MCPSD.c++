@@ -1,4 +1,5 @@
 #include "MACE/Detector/Description/MCP.h++"
+#include "MACE/Simulation/Generator/PrimaryIndex.h++"
 #include "MACE/Simulation/SD/MCPSD.h++"
 
 #include "Mustard/IO/PrettyLog.h++"
@@ -38,7 +39,12 @@ MCPSD::MCPSD(const G4String& sdName) :
     fSplitHit{},
     fHitsCollection{} {
     collectionName.insert(sdName + "HC");
+    ReloadDescription();
+}
+
+MCPSD::~MCPSD() = default;
 
+auto MCPSD::ReloadDescription() -> void {
     const auto& mcp{Detector::Description::MCP::Instance()};
     if (mcp.EfficiencyEnergy().size() != mcp.EfficiencyValue().size()) {
         Mustard::Throw<std::runtime_error>("mcp.EfficiencyEnergy().size() != mcp.EfficiencyValue().size()");
@@ -51,8 +57,6 @@ MCPSD::MCPSD(const G4String& sdName) :
                                                         (mcp.EfficiencyValue()[n - 1] - mcp.EfficiencyValue()[n - 2]) / (mcp.EfficiencyEnergy()[n - 1] - mcp.EfficiencyEnergy()[n - 2]));
 }
 
-MCPSD::~MCPSD() = default;
-
 auto MCPSD::Initialize(G4HCofThisEvent* hitsCollectionOfThisEvent) -> void {
     fHitsCollection = new MCPHitCollection{SensitiveDetectorName, collectionName[0]};
     auto hitsCollectionID{G4SDManager::GetSDMpointer()->GetCollectionID(fHitsCollection)};
@@ -91,6 +95,7 @@ auto MCPSD::ProcessHits(G4Step* theStep, G4TouchableHistory*) -> G4bool {
     Get<"Ek">(*hit) = preStepPoint.GetKineticEnergy();
     Get<"p">(*hit) = preStepPoint.GetMomentum();
     Get<"TrkID">(*hit) = track.GetTrackID();
+    Get<"PrmID">(*hit) = PrimaryIndex::Of(track);
     Get<"PDGID">(*hit) = particle.GetPDGEncoding();
     Get<"t0">(*hit) = track.GetGlobalTime() - track.GetLocalTime();
     Get<"x0">(*hit) = track.GetVertexPosition();
@@ -17,6 +17,9 @@ public:
     MCPSD(const G4String& sdName);
     ~MCPSD();
 
+    /// @brief Recompute the state derived from the MCP description (e.g. after a re-import in a design scan).
+    auto ReloadDescription() -> void;
+
     virtual auto Initialize(G4HCofThisEvent* hitsCollection) -> void override;
     virtual auto ProcessHits(G4Step* theStep, G4TouchableHistory*) -> G4bool override;
     virtual auto EndOfEvent(G4HCofThisEvent*) -> void override;
@@ -1,5 +1,6 @@
 #include "MACE/Detector/Description/TTC.h++"
 #include "MACE/PhaseI/Detector/Description/TTC.h++"
+#include "MACE/Simulation/Generator/PrimaryIndex.h++"
 #include "MACE/Simulation/SD/TTCSD.h++"
 #include "MACE/Simulation/SD/TTCSiPMSD.h++"
 
@@ -113,6 +114,7 @@ auto TTCSD::ProcessHits(G4Step* theStep, G4TouchableHistory*) -> G4bool {
     Get<"Ek">(*hit) = preStepPoint.GetKineticEnergy();
     Get<"p">(*hit) = preStepPoint.GetMomentum();
     Get<"TrkID">(*hit) = track.GetTrackID();
+    Get<"PrmID">(*hit) = PrimaryIndex::Of(track);
     Get<"PDGID">(*hit) = particle.GetPDGEncoding();
     Get<"t0">(*hit) = track.GetGlobalTime() - track.GetLocalTime();
     Get<"x0">(*hit) = track.GetVertexPosition();
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace MACE::inline Utility {
+
+/// @brief 64-bit FNV-1a hash, stable across compilers and standard libraries (unlike std::hash),
+/// for naming and keying files of on-disk caches.
+class FNV1a {
+public:
+    constexpr auto Update(std::string_view data) -> void {
+        for (auto c : data) {
+            fHash = (fHash ^ static_cast<unsigned char>(c)) * 0x0000'0100'0000'01b3;
+        }
+    }
+    constexpr auto Hash() const -> auto { return fHash; }
+
+    static constexpr auto Of(std::string_view data) -> std::uint64_t {
+        FNV1a fnv;
+        fnv.Update(data);
+        return fnv.Hash();
+    }
+
+private:
+    std::uint64_t fHash{0xcbf2'9ce4'8422'2325};
+};
+
+} // namespace MACE::inline Utility
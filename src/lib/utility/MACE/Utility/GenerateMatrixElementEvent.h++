@@ -0,0 +1,47 @@
+#pragma once
+
+#include "MACE/Utility/MatrixElementIntegrand.h++"
+#include "MACE/Utility/MultiChainMCMC.h++"
+#include "MACE/Utility/VegasEventSampler.h++"
+#include "MACE/Utility/WriteAutocorrelationFunction.h++"
+
+#include "Mustard/Data/GeneratedEvent.h++"
+#include "Mustard/Data/Output.h++"
+#include "Mustard/Data/Tuple.h++"
+#include "Mustard/Execution/Executor.h++"
+#include "Mustard/IO/File.h++"
+#include "Mustard/IO/Print.h++"
+#include "Mustard/Utility/MathConstant.h++"
+#include "Mustard/Utility/PhysicalConstant.h++"
+
+#include "CLHEP/Random/Random.h"
+#include "CLHEP/Vector/LorentzVector.h"
+
+#include "TFile.h"
+
+#include "muc/math"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cstdlib>
+#include <initializer_list>
+#include <string_view>
+#include <vector>
+
+namespace MACE::inline Utility {
+
+/// @brief Common part of the GenM2ENN* apps, after the generator and its acceptance are set up.
+///
+/// Integrates the phase space (see MatrixElementBasedGeneratorCLIModule::PhaseSpaceIntegral),
+/// prints the branching ratio of the decay of a parent of given mass and lifetime, then
+/// generates the requested events with VEGAS (--vegas) or with multi-chain MCMC, and writes
+/// the final-state particles listed in outputIndex (e.g. not the neutrinos).
+/// @return The exit code of the app.
+template<typename ACLI, typename AGenerator>
+auto GenerateMatrixElementEvent(ACLI& cli, AGenerator& generator, std::string_view physicsKey,
+                                double parentMass, double parentLifetime, std::initializer_list<gsl::index> outputIndex) -> int;
+
+} // namespace MACE::inline Utility
+
+#include "MACE/Utility/GenerateMatrixElementEvent.inl"
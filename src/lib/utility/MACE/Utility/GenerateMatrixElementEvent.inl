@@ -0,0 +1,104 @@
+namespace MACE::inline Utility {
+
+template<typename ACLI, typename AGenerator>
+auto GenerateMatrixElementEvent(ACLI& cli, AGenerator& generator, std::string_view physicsKey,
+                                double parentMass, double parentLifetime, std::initializer_list<gsl::index> outputIndex) -> int {
+    using namespace Mustard::MathConstant;
+    using namespace Mustard::PhysicalConstant;
+
+    // Integrate matrix element
+    Mustard::Executor<unsigned long long> executor{"Generation", "Sample"};
+    const auto [phaseSpaceIntegral, nEff, integrationState]{cli.PhaseSpaceIntegral(executor, generator, physicsKey)};
+    const auto width{muc::pow(2 * pi, 4) / (2 * parentMass) * phaseSpaceIntegral};
+    const auto branchingRatio{width * (parentLifetime / hbar_Planck)};
+    Mustard::MasterPrint("Branching ratio:\n"
+                         "  {} +/- {}  (rel. unc.: {:.3}%, N_eff: {:.2f})\n"
+                         "\n",
+                         branchingRatio.value, branchingRatio.uncertainty,
+                         branchingRatio.uncertainty / branchingRatio.value * 100, nEff);
+
+    // Return if nothing to be generated
+    const auto nEvent{cli.GenerateOrExit()};
+    if (not nEvent.has_value()) {
+        return EXIT_SUCCESS;
+    }
+
+    Mustard::ProcessSpecificFile<TFile> file{cli->get("--output"), cli->get("--output-mode")};
+    const auto Fill{[&outputIndex](auto& writer, double w, auto&& pdgID, auto&& p) {
+        std::vector<int> outPDGID;
+        std::vector<float> outE;
+        std::vector<float> outPx;
+        std::vector<float> outPy;
+        std::vector<float> outPz;
+        for (auto&& i : outputIndex) {
+            outPDGID.emplace_back(pdgID[i]);
+            outE.emplace_back(p[i].e());
+            outPx.emplace_back(p[i].x());
+            outPy.emplace_back(p[i].y());
+            outPz.emplace_back(p[i].z());
+        }
+        Mustard::Data::Tuple<Mustard::Data::GeneratedKinematics> event;
+        Get<"pdgID">(event) = std::move(outPDGID);
+        Get<"E">(event) = std::move(outE);
+        Get<"px">(event) = std::move(outPx);
+        Get<"py">(event) = std::move(outPy);
+        Get<"pz">(event) = std::move(outPz);
+        Get<"w">(event) = w;
+        writer.Fill(event);
+    }};
+
+    if (cli["--vegas"] == true) {
+        // Adapt VEGAS grid, then generate independent weighted events
+        const CLHEP::HepLorentzVector pI{cli.Momentum(), muc::hypot(cli.Momentum().mag(), parentMass)};
+        MatrixElementIntegrand integrand{generator, {pI}};
+        VegasEventSampler sampler{integrand, integrand.NDim(), cli->template get<int>("--vegas-n-thread"), *CLHEP::HepRandom::getTheEngine(), cli->template get<int>("--vegas-bin")};
+        sampler.Adapt(cli->template get<int>("--vegas-iteration"), cli->template get<unsigned long long>("--vegas-sample"), cli->template get<double>("--vegas-alpha"));
+        if (*nEvent == 0) {
+            return EXIT_SUCCESS;
+        }
+        Mustard::Data::Output<Mustard::Data::GeneratedKinematics> writer{cli->get("--output-tree")};
+        const auto referenceWeight{cli->template get<double>("--vegas-unweighting-ratio") * sampler.MaxWeight()};
+        const auto blockSize{cli->template get<int>("--vegas-n-thread") * 1000ull};
+        executor((*nEvent + blockSize - 1) / blockSize, [&](auto i) {
+            sampler.Sample(std::min(blockSize, *nEvent - i * blockSize), referenceWeight, [&](double weight, auto&& generated) {
+                const auto& [biasWeight, pdgID, p]{generated};
+                Fill(writer, branchingRatio.value * weight * biasWeight, pdgID, p);
+            });
+        });
+        executor.PrintExecutionSummary();
+        sampler.PrintEfficiency();
+        writer.Write();
+        return EXIT_SUCCESS;
+    }
+
+    // Initialize chains and write ACF of chain 0
+    MultiChainMCMC sampler{generator, cli->template get<int>("--n-chain"), *CLHEP::HepRandom::getTheEngine()};
+    const auto PositronEnergy{[](auto&& generated) {
+        const auto& [weight, pdgID, p]{generated};
+        return p[0].e();
+    }};
+    const auto rHatGoal{cli->template get<double>("--r-hat-goal")};
+    const auto autocorrelationFunction{sampler.Initialize(PositronEnergy, rHatGoal, cli->template get<unsigned>("--max-burn-in-round"), 10 * sampler.BatchSize())};
+    WriteAutocorrelationFunction(autocorrelationFunction);
+
+    // Generate events
+    if (*nEvent == 0) {
+        return EXIT_SUCCESS;
+    }
+    Mustard::Data::Output<Mustard::Data::GeneratedKinematics> writer{cli->get("--output-tree")};
+    // Each task draws one batch from every chain
+    const auto blockSize{static_cast<unsigned long long>(sampler.NChain()) * sampler.BatchSize()};
+    executor((*nEvent + blockSize - 1) / blockSize, [&](auto i) {
+        sampler.Sample(std::min(blockSize, *nEvent - i * blockSize), PositronEnergy, [&](auto&& generated) {
+            const auto& [weight, pdgID, p]{generated};
+            Fill(writer, branchingRatio.value * weight, pdgID, p);
+        });
+    });
+    executor.PrintExecutionSummary();
+    sampler.PrintDiagnostics(rHatGoal);
+    writer.Write();
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace MACE::inline Utility
@@ -17,6 +17,28 @@ MCMCGeneratorCLIModule::MCMCGeneratorCLIModule(gsl::not_null<Mustard::CLI::CLI<>
         .help("Sample size for estimation autocorrelation function (ACF).")
         .nargs(1)
         .scan<'i', unsigned>();
+    TheCLI()
+        ->add_argument("--n-chain")
+        .help("Number of independent MCMC chains per process, each on its own thread. "
+              "Chain 0 uses the main random engine, other chains are seeded from it.")
+        .default_value(1)
+        .required()
+        .nargs(1)
+        .scan<'i', int>();
+    TheCLI()
+        ->add_argument("--r-hat-goal")
+        .help("Burn-in is extended until the Gelman-Rubin R-hat across chains drops below this value (requires --n-chain > 1).")
+        .default_value(1.01)
+        .required()
+        .nargs(1)
+        .scan<'g', double>();
+    TheCLI()
+        ->add_argument("--max-burn-in-round")
+        .help("Maximum number of extra burn-in rounds spent on reaching --r-hat-goal.")
+        .default_value(10u)
+        .required()
+        .nargs(1)
+        .scan<'i', unsigned>();
 }
 
 } // namespace MACE::inline Utility
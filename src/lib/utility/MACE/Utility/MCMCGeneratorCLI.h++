@@ -1,6 +1,7 @@
 #pragma once
 
 #include "MACE/Utility/MatrixElementBasedGeneratorCLI.h++"
+#include "MACE/Utility/VegasGeneratorCLI.h++"
 
 #include "Mustard/CLI/Module/ModuleBase.h++"
 
@@ -13,6 +14,7 @@ public:
 
 template<std::derived_from<Mustard::CLI::ModuleBase>... AExtraModules>
 using MCMCGeneratorCLI = MatrixElementBasedGeneratorCLI<MCMCGeneratorCLIModule,
+                                                        VegasGeneratorCLIModule,
                                                         AExtraModules...>;
 
 } // namespace MACE::inline Utility
@@ -2,6 +2,7 @@
 
 #include "Mustard/IO/PrettyLog.h++"
 
+#include <string>
 #include <vector>
 
 namespace MACE::inline Utility {
@@ -25,6 +26,17 @@ MatrixElementBasedGeneratorCLIModule::MatrixElementBasedGeneratorCLIModule(gsl::
         .help("Integration state for continuing phase-space integration.")
         .nargs(3)
         .scan<'g', long double>();
+    TheCLI()
+        ->add_argument("--integration-cache")
+        .help("Directory of the phase-space integration cache. Integration states are looked up there automatically, "
+              "refined, and merged back (safe for concurrent jobs).")
+        .default_value(std::string{"mace_integration_cache"})
+        .required()
+        .nargs(1);
+    TheCLI()
+        ->add_argument("--no-integration-cache")
+        .help("Do not read or update the phase-space integration cache.")
+        .flag();
 }
 
 auto MatrixElementBasedGeneratorCLIModule::ContinueIntegration() const -> std::optional<Mustard::Math::MCIntegrationState> {
@@ -43,4 +55,11 @@ auto MatrixElementBasedGeneratorCLIModule::ContinueIntegration() const -> std::o
     return state;
 }
 
+auto MatrixElementBasedGeneratorCLIModule::IntegrationCache(std::string key) const -> std::optional<PhaseSpaceIntegrationCache> {
+    if (TheCLI()->get<bool>("--no-integration-cache")) {
+        return {};
+    }
+    return PhaseSpaceIntegrationCache{TheCLI()->get("--integration-cache"), std::move(key)};
+}
+
 } // namespace MACE::inline Utility
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "MACE/Utility/EventGeneratorCLI.h++"
+#include "MACE/Utility/PhaseSpaceIntegrationCache.h++"
 
 #include "Mustard/CLI/CLI.h++"
 #include "Mustard/CLI/Module/ModuleBase.h++"
@@ -13,11 +14,15 @@
 
 #include "muc/array"
 
+#include "fmt/format.h"
+
 #include <algorithm>
 #include <array>
 #include <cmath>
 #include <limits>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <tuple>
 
 namespace MACE::inline Utility {
@@ -26,12 +31,18 @@ class MatrixElementBasedGeneratorCLIModule : public Mustard::CLI::ModuleBase {
 public:
     MatrixElementBasedGeneratorCLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli);
 
+    /// @brief Integrate phase space, or reuse a previous integration.
+    /// @param physicsKey Text describing everything the integral depends on, starting with the process name
+    /// (e.g. "M2ENNE|"), then initial-state momentum/polarization, IR cut, acceptance parameters.
+    /// Used as the integration cache key, so it must not depend on the toolchain (no typeid names).
     template<int M, int N, typename A>
     auto PhaseSpaceIntegral(Mustard::Executor<unsigned long long>& executor,
-                            Mustard::MatrixElementBasedGenerator<M, N, A>& generator) const -> std::tuple<Mustard::Math::Estimate, double, Mustard::Math::MCIntegrationState>;
+                            Mustard::MatrixElementBasedGenerator<M, N, A>& generator,
+                            std::string_view physicsKey) const -> std::tuple<Mustard::Math::Estimate, double, Mustard::Math::MCIntegrationState>;
 
 private:
     auto ContinueIntegration() const -> std::optional<Mustard::Math::MCIntegrationState>;
+    auto IntegrationCache(std::string key) const -> std::optional<PhaseSpaceIntegrationCache>;
 };
 
 template<std::derived_from<Mustard::CLI::ModuleBase>... AExtraModules>
@@ -2,7 +2,8 @@ namespace MACE::inline Utility {
 
 template<int M, int N, typename A>
 auto MatrixElementBasedGeneratorCLIModule::PhaseSpaceIntegral(Mustard::Executor<unsigned long long>& executor,
-                                                              Mustard::MatrixElementBasedGenerator<M, N, A>& generator) const -> std::tuple<Mustard::Math::Estimate, double, Mustard::Math::MCIntegrationState> {
+                                                              Mustard::MatrixElementBasedGenerator<M, N, A>& generator,
+                                                              std::string_view physicsKey) const -> std::tuple<Mustard::Math::Estimate, double, Mustard::Math::MCIntegrationState> {
     std::tuple<Mustard::Math::Estimate, double, Mustard::Math::MCIntegrationState> result;
     auto& [integral, nEff, integrationState]{result};
     if (TheCLI()->is_used("--phase-space-integral")) {
@@ -13,16 +14,32 @@ auto MatrixElementBasedGeneratorCLIModule::PhaseSpaceIntegral(Mustard::Executor<
         Mustard::MasterPrintLn("Using pre-computed phase-space integral {}.", integralFromConsole);
     } else {
         const auto precisionGoal{TheCLI()->get<double>("--integral-precision-goal")};
-        Mustard::Math::MCIntegrationState _;
-        if (const auto integrationState{ContinueIntegration()}) {
-            result = generator.PhaseSpaceIntegral(executor, precisionGoal, *integrationState);
+        const auto cache{IntegrationCache(std::string{physicsKey})};
+        auto initialState{ContinueIntegration()};
+        if (not initialState and cache) {
+            initialState = cache->Load();
+            if (initialState) {
+                if (not TheCLI()->is_used("--seed")) {
+                    Mustard::MasterPrintWarning("Continuing integration from cache but --seed not set! You are probably using the previous seed, "
+                                                "and the cached samples will be repeated. Try set exclusive seeds for each run, or simply --seed 0");
+                }
+                Mustard::MasterPrintLn("Continuing phase-space integration from cache {} ({} samples).", cache->Path().generic_string(), initialState->n);
+            }
+        }
+        if (initialState) {
+            result = generator.PhaseSpaceIntegral(executor, precisionGoal, *initialState);
         } else {
             result = generator.PhaseSpaceIntegral(executor, precisionGoal);
         }
-        Mustard::MasterPrintLn("You can save the above phase-space integral and integration state for future use "
-                               "as long as initial state properties and acceptance function does not change "
-                               "(see option -i or --phase-space-integral and --continue-integration)."
-                               "\n");
+        if (cache) {
+            const auto merged{cache->Merge(initialState.value_or(Mustard::Math::MCIntegrationState{}), integrationState)};
+            Mustard::MasterPrintLn("Phase-space integration state merged into cache {} ({} samples in total).\n", cache->Path().generic_string(), merged.n);
+        } else {
+            Mustard::MasterPrintLn("You can save the above phase-space integral and integration state for future use "
+                                   "as long as initial state properties and acceptance function does not change "
+                                   "(see option -i or --phase-space-integral and --continue-integration)."
+                                   "\n");
+        }
     }
     return result;
 }
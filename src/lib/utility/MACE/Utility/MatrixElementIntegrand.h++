@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Mustard/Physics/Generator/MatrixElementBasedGenerator.h++"
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <utility>
+
+namespace MACE::inline Utility {
+
+/// @brief Unit-hypercube integrand of a matrix-element-based generator, for VegasEventSampler.
+///
+/// u drives the generator's phase-space generator (GENBOD, 3N - 4 random numbers), and
+/// f = phase-space weight x |M|^2 x acceptance, i.e. the integrand of PhaseSpaceIntegral.
+/// The returned event carries 1 / acceptance as its weight, the same bias compensation the
+/// MCMC sampling applies. The integrand owns a copy of the generator, so copies of it can be
+/// evaluated on different threads.
+template<typename AGenerator>
+class MatrixElementIntegrand {
+public:
+    using Generator = AGenerator;
+    using Event = typename Generator::Event;
+    using InitialStateMomenta = typename Generator::InitialStateMomenta;
+
+public:
+    MatrixElementIntegrand(const AGenerator& generator, const InitialStateMomenta& pI) :
+        fGenerator{generator},
+        fInitialStateMomenta{pI} {}
+
+    static constexpr auto NDim() -> int { return 3 * NFinalState(static_cast<const AGenerator*>(nullptr)) - 4; }
+
+    auto operator()(std::span<const double> u) const -> std::pair<double, Event> {
+        std::array<double, NDim()> randomState;
+        std::ranges::copy(u.first<NDim()>(), randomState.begin());
+        auto event{fGenerator.PhaseSpace()(randomState, fInitialStateMomenta)};
+        auto& [weight, pdgID, p]{event};
+        const auto& acceptance{fGenerator.Acceptance()};
+        const double bias{acceptance ? acceptance(p) : 1};
+        const auto f{weight * fGenerator.MatrixElement()(fInitialStateMomenta, p) * bias};
+        weight = bias > 0 ? 1 / bias : 0;
+        return {f, std::move(event)};
+    }
+
+private:
+    template<int M, int N, typename A>
+    static constexpr auto NFinalState(const Mustard::MatrixElementBasedGenerator<M, N, A>*) -> int { return N; }
+
+private:
+    Generator fGenerator;
+    InitialStateMomenta fInitialStateMomenta;
+};
+
+} // namespace MACE::inline Utility
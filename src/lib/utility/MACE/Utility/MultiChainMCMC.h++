@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Mustard/Env/BasicEnv.h++"
+#include "Mustard/IO/Print.h++"
+
+#include "CLHEP/Random/MixMaxRng.h"
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "mplr/mplr.hpp"
+
+#include "muc/math"
+
+#include "gsl/gsl"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MACE::inline Utility {
+
+/// @brief Runs several independent copies of an MCMC generator and monitors their convergence.
+///
+/// Chain 0 draws from the engine passed at construction (the one installed by UseXoshiro),
+/// so a single chain reproduces the plain generation bit by bit. The other chains own an
+/// AEngine seeded from that engine, hence the streams are derived from --seed and reproducible.
+/// Each chain runs on its own worker thread with its own copy of the generator and its own
+/// engine; a copy of AGenerator must therefore not share mutable state with the original, and
+/// the observable must be callable concurrently. Events are handed to the consumer on the
+/// calling thread.
+///
+/// A scalar observable of each event is monitored per chain. Gelman-Rubin R-hat is computed
+/// from the between- and within-chain variances, and the effective sample size from
+/// non-overlapping batch means. The proposal, including its step size, belongs to the
+/// generator and is tuned by its MCMCInitialize(); no step-size adaptation is done here.
+/// Initialize() only extends burn-in in rounds until R-hat drops below the goal.
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine = CLHEP::MixMaxRng>
+class MultiChainMCMC {
+public:
+    using Event = std::invoke_result_t<AGenerator&, CLHEP::HepRandomEngine&>;
+
+public:
+    MultiChainMCMC(const AGenerator& generator, int nChain, CLHEP::HepRandomEngine& engine, unsigned batchSize = 1000);
+
+    auto NChain() const -> auto { return std::ssize(fChain); }
+    auto BatchSize() const -> auto { return fBatchSize; }
+
+    /// @brief Burn in every chain with the generator's own initialization, then
+    /// discard further rounds of nChain x roundSize samples until R-hat < rHatGoal or
+    /// maxRound is reached. Returns the autocorrelation function of chain 0.
+    template<typename AObservable>
+    auto Initialize(AObservable&& Observable, double rHatGoal, unsigned maxRound, unsigned long long roundSize) -> auto;
+    /// @brief Draw n events spread over the chains, then hand them to Consume chain by chain.
+    template<typename AObservable, std::invocable<const Event&> AConsumer>
+    auto Sample(unsigned long long n, AObservable&& Observable, AConsumer&& Consume) -> void;
+
+    /// @brief Gelman-Rubin potential scale reduction of the chains on this rank.
+    auto RHat() const -> double { return Diagnose(LocalSummary())[0]; }
+    /// @brief Batch-means effective sample size summed over the chains on this rank.
+    auto EffectiveSampleSize() const -> double { return Diagnose(LocalSummary())[1]; }
+    /// @brief Print R-hat and ESS over all chains of all ranks. Collective over MPI_COMM_WORLD.
+    auto PrintDiagnostics(double rHatGoal) const -> void;
+
+private:
+    struct Moment {
+        auto Add(double x) -> void;
+        auto Variance() const -> double { return n > 1 ? m2 / (n - 1) : std::numeric_limits<double>::quiet_NaN(); }
+
+        unsigned long long n{};
+        double mean{};
+        double m2{};
+    };
+
+    struct Chain {
+        AGenerator generator;
+        std::unique_ptr<AEngine> ownedEngine;
+        CLHEP::HepRandomEngine* engine;
+        Moment sample;
+        Moment batchMean;
+        double batchSum;
+        unsigned batchCount;
+        std::vector<Event> buffer;
+    };
+
+    /// nChain, sum of means, sum of squared means, sum of variances, sum of n, sum of ESS
+    using Summary = std::array<double, 6>;
+
+private:
+    template<typename AObservable>
+    auto Draw(Chain& chain, unsigned long long n, AObservable& Observable, bool keep) const -> void;
+    auto ForEachChain(const std::function<void(Chain&, gsl::index)>& Task) -> void;
+    auto ResetStatistics() -> void;
+    auto LocalSummary() const -> Summary;
+    static auto Diagnose(const Summary& summary) -> std::array<double, 2>;
+
+private:
+    std::vector<Chain> fChain;
+    unsigned fBatchSize;
+};
+
+} // namespace MACE::inline Utility
+
+#include "MACE/Utility/MultiChainMCMC.inl"
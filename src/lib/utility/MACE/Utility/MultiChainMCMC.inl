@@ -0,0 +1,183 @@
+namespace MACE::inline Utility {
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+MultiChainMCMC<AGenerator, AEngine>::MultiChainMCMC(const AGenerator& generator, int nChain, CLHEP::HepRandomEngine& engine, unsigned batchSize) :
+    fChain{},
+    fBatchSize{batchSize} {
+    Expects(nChain >= 1);
+    Expects(batchSize >= 1);
+    fChain.reserve(nChain);
+    for (int i{}; i < nChain; ++i) {
+        auto& chain{fChain.emplace_back(Chain{.generator = generator,
+                                              .ownedEngine = nullptr,
+                                              .engine = &engine,
+                                              .sample = {},
+                                              .batchMean = {},
+                                              .batchSum = 0,
+                                              .batchCount = 0,
+                                              .buffer = {}})};
+        if (i == 0) {
+            continue;
+        }
+        const auto seed{static_cast<unsigned long long>(static_cast<unsigned>(engine)) << 32 | static_cast<unsigned>(engine)};
+        chain.ownedEngine = std::make_unique<AEngine>(static_cast<long>(seed >> 1));
+        chain.engine = chain.ownedEngine.get();
+    }
+}
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+template<typename AObservable>
+auto MultiChainMCMC<AGenerator, AEngine>::Initialize(AObservable&& Observable, double rHatGoal, unsigned maxRound, unsigned long long roundSize) -> auto {
+    std::vector<decltype(fChain.front().generator.MCMCInitialize(*fChain.front().engine))> autocorrelationFunction(fChain.size());
+    ForEachChain([&](Chain& chain, gsl::index i) {
+        autocorrelationFunction[i] = chain.generator.MCMCInitialize(*chain.engine);
+    });
+    if (NChain() == 1) {
+        return std::move(autocorrelationFunction.front());
+    }
+
+    auto rHat{std::numeric_limits<double>::infinity()};
+    unsigned round{};
+    for (; round < maxRound and not(rHat < rHatGoal); ++round) {
+        ResetStatistics();
+        ForEachChain([&](Chain& chain, gsl::index) {
+            Draw(chain, roundSize, Observable, false);
+        });
+        rHat = RHat();
+    }
+    ResetStatistics();
+
+    if (Mustard::Env::VerboseLevelReach<'I'>()) {
+        Mustard::MasterPrintLn("MCMC: {} chain(s) per rank, {} extra burn-in round(s) of {} sample(s) per chain, R-hat = {:.4f}",
+                               NChain(), round, roundSize, rHat);
+    }
+    if (not(rHat < rHatGoal)) {
+        Mustard::PrintWarning(fmt::format("MCMC chains not converged after {} extra burn-in round(s) (R-hat = {:.4f} >= {}). "
+                                          "Consider a larger thinning ratio",
+                                          round, rHat, rHatGoal));
+    }
+    return std::move(autocorrelationFunction.front());
+}
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+template<typename AObservable, std::invocable<const typename MultiChainMCMC<AGenerator, AEngine>::Event&> AConsumer>
+auto MultiChainMCMC<AGenerator, AEngine>::Sample(unsigned long long n, AObservable&& Observable, AConsumer&& Consume) -> void {
+    const auto nChain{static_cast<unsigned long long>(NChain())};
+    ForEachChain([&](Chain& chain, gsl::index i) {
+        Draw(chain, n / nChain + (static_cast<unsigned long long>(i) < n % nChain), Observable, true);
+    });
+    for (auto&& chain : fChain) {
+        for (auto&& event : chain.buffer) {
+            Consume(event);
+        }
+    }
+}
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto MultiChainMCMC<AGenerator, AEngine>::PrintDiagnostics(double rHatGoal) const -> void {
+    auto summary{LocalSummary()};
+    const auto& worldComm{mplr::comm_world()};
+    worldComm.reduce(
+        [](const Summary& a, const Summary& b) {
+            Summary c;
+            std::ranges::transform(a, b, c.begin(), std::plus{});
+            return c;
+        },
+        0, summary);
+    if (worldComm.rank() != 0) {
+        return;
+    }
+    const auto [rHat, ess]{Diagnose(summary)};
+    Mustard::MasterPrintLn("MCMC diagnostics over {} chain(s): R-hat = {:.4f}, ESS = {:.1f} ({:.3}% of {} sample(s))",
+                           summary[0], rHat, ess, ess / summary[4] * 100, summary[4]);
+    if (not(rHat < rHatGoal)) {
+        Mustard::MasterPrintWarning(fmt::format("R-hat = {:.4f} >= {}, MCMC chains may not have converged", rHat, rHatGoal));
+    }
+}
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto MultiChainMCMC<AGenerator, AEngine>::Moment::Add(double x) -> void {
+    ++n;
+    const auto delta{x - mean};
+    mean += delta / n;
+    m2 += delta * (x - mean);
+}
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+template<typename AObservable>
+auto MultiChainMCMC<AGenerator, AEngine>::Draw(Chain& chain, unsigned long long n, AObservable& Observable, bool keep) const -> void {
+    chain.buffer.clear();
+    if (keep) {
+        chain.buffer.reserve(n);
+    }
+    for (unsigned long long k{}; k < n; ++k) {
+        auto event{chain.generator(*chain.engine)};
+        const double x{Observable(std::as_const(event))};
+        chain.sample.Add(x);
+        chain.batchSum += x;
+        if (++chain.batchCount == fBatchSize) {
+            chain.batchMean.Add(chain.batchSum / fBatchSize);
+            chain.batchSum = 0;
+            chain.batchCount = 0;
+        }
+        if (keep) {
+            chain.buffer.emplace_back(std::move(event));
+        }
+    }
+}
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto MultiChainMCMC<AGenerator, AEngine>::ForEachChain(const std::function<void(Chain&, gsl::index)>& Task) -> void {
+    if (fChain.size() == 1) {
+        Task(fChain.front(), 0);
+        return;
+    }
+    std::vector<std::jthread> thread;
+    thread.reserve(fChain.size());
+    for (gsl::index i{}; i < NChain(); ++i) {
+        thread.emplace_back(Task, std::ref(fChain[i]), i);
+    }
+}
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto MultiChainMCMC<AGenerator, AEngine>::ResetStatistics() -> void {
+    for (auto&& chain : fChain) {
+        chain.sample = {};
+        chain.batchMean = {};
+        chain.batchSum = 0;
+        chain.batchCount = 0;
+    }
+}
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto MultiChainMCMC<AGenerator, AEngine>::LocalSummary() const -> Summary {
+    Summary summary{};
+    auto& [nChain, sumMean, sumMean2, sumVariance, sumN, sumESS]{summary};
+    for (auto&& chain : fChain) {
+        nChain += 1;
+        sumMean += chain.sample.mean;
+        sumMean2 += muc::pow(chain.sample.mean, 2);
+        sumVariance += chain.sample.Variance();
+        sumN += chain.sample.n;
+        // Var(mean) ~ sigma^2 / ESS ~ Var(batch mean) / nBatch, not estimable with less than 2 batches
+        if (const auto batchVariance{chain.batchMean.Variance()}; batchVariance > 0) {
+            sumESS += chain.sample.n * chain.sample.Variance() / (fBatchSize * batchVariance);
+        }
+    }
+    return summary;
+}
+
+template<typename AGenerator, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto MultiChainMCMC<AGenerator, AEngine>::Diagnose(const Summary& summary) -> std::array<double, 2> {
+    const auto& [nChain, sumMean, sumMean2, sumVariance, sumN, sumESS]{summary};
+    if (nChain < 2) {
+        return {std::numeric_limits<double>::quiet_NaN(), sumESS};
+    }
+    const auto n{sumN / nChain};
+    const auto betweenOverN{(sumMean2 - muc::pow(sumMean, 2) / nChain) / (nChain - 1)};
+    const auto within{sumVariance / nChain};
+    const auto pooled{(n - 1) / n * within + betweenOverN};
+    return {std::sqrt(pooled / within), sumESS};
+}
+
+} // namespace MACE::inline Utility
@@ -0,0 +1,212 @@
+#include "MACE/Utility/PhaseSpaceIntegrationCache.h++"
+
+#include "Mustard/IO/PrettyLog.h++"
+
+#include "mplr/mplr.hpp"
+
+#include "mpi.h"
+
+#include "fmt/format.h"
+#include "fmt/std.h"
+
+#if defined _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+namespace MACE::inline Utility {
+
+namespace {
+
+/// Exclusive lock on a lock file, held for the lifetime of the object: fcntl on POSIX (works
+/// on NFS), LockFileEx on Windows. Locked() is false if the lock could not be taken.
+class FileLock {
+public:
+    explicit FileLock(const std::filesystem::path& path);
+    ~FileLock();
+
+    FileLock(const FileLock&) = delete;
+    auto operator=(const FileLock&) -> FileLock& = delete;
+
+    auto Locked() const -> auto { return fLocked; }
+
+private:
+#if defined _WIN32
+    HANDLE fFile;
+#else
+    int fFD;
+#endif
+    bool fLocked;
+};
+
+#if defined _WIN32
+
+FileLock::FileLock(const std::filesystem::path& path) :
+    fFile{::CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                        nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr)},
+    fLocked{} {
+    if (fFile == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    OVERLAPPED overlapped{};
+    fLocked = ::LockFileEx(fFile, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped);
+}
+
+FileLock::~FileLock() {
+    if (fFile != INVALID_HANDLE_VALUE) {
+        ::CloseHandle(fFile); // closing releases the lock
+    }
+}
+
+#else
+
+FileLock::FileLock(const std::filesystem::path& path) :
+    fFD{::open(path.c_str(), O_RDWR | O_CREAT, 0644)},
+    fLocked{} {
+    if (fFD < 0) {
+        return;
+    }
+    struct flock lock {};
+    lock.l_type = F_WRLCK;
+    lock.l_whence = SEEK_SET;
+    int status;
+    while ((status = ::fcntl(fFD, F_SETLKW, &lock)) == -1 and errno == EINTR) {}
+    fLocked = status != -1;
+}
+
+FileLock::~FileLock() {
+    if (fFD >= 0) {
+        ::close(fFD); // closing releases the lock
+    }
+}
+
+#endif
+
+/// 64-bit FNV-1a, stable across compilers and standard libraries (unlike std::hash)
+constexpr auto FNV1a(std::string_view text) -> std::uint64_t {
+    std::uint64_t hash{0xcbf29ce484222325};
+    for (auto c : text) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+auto Broadcast(std::optional<Mustard::Math::MCIntegrationState>& state) -> void {
+    const auto comm{mplr::comm_world().native_handle()};
+    auto found{state.has_value()};
+    MPI_Bcast(&found, sizeof(found), MPI_BYTE, 0, comm);
+    if (not found) {
+        state.reset();
+        return;
+    }
+    if (not state.has_value()) {
+        state.emplace();
+    }
+    MPI_Bcast(&*state, sizeof(*state), MPI_BYTE, 0, comm);
+}
+
+} // namespace
+
+PhaseSpaceIntegrationCache::PhaseSpaceIntegrationCache(const std::filesystem::path& directory, std::string key) :
+    fPath{directory / fmt::format("{:016x}.integration", FNV1a(key))},
+    fKey{std::move(key)} {}
+
+auto PhaseSpaceIntegrationCache::Load() const -> std::optional<Mustard::Math::MCIntegrationState> {
+    std::optional<Mustard::Math::MCIntegrationState> state;
+    if (mplr::comm_world().rank() == 0) {
+        state = Read();
+    }
+    Broadcast(state);
+    return state;
+}
+
+auto PhaseSpaceIntegrationCache::Merge(const Mustard::Math::MCIntegrationState& initial, const Mustard::Math::MCIntegrationState& final) const -> Mustard::Math::MCIntegrationState {
+    std::optional<Mustard::Math::MCIntegrationState> merged;
+    std::string error;
+    if (mplr::comm_world().rank() == 0) {
+        error = [&]() -> std::string {
+            std::error_code ec;
+            std::filesystem::create_directories(fPath.parent_path(), ec);
+            const FileLock lock{fPath.string() + ".lock"};
+            if (not lock.Locked()) {
+                return fmt::format("Cannot lock {}.lock", fPath);
+            }
+            // stored + (final - initial): samples added by other jobs since Load() are kept
+            auto state{Read().value_or(Mustard::Math::MCIntegrationState{})};
+            state.sum[0] += final.sum[0] - initial.sum[0];
+            state.sum[1] += final.sum[1] - initial.sum[1];
+            state.n += final.n - initial.n;
+
+            const auto temporary{fmt::format("{}.{:08x}.tmp", fPath.string(), std::random_device{}())};
+            {
+                std::ofstream file{temporary};
+                file << fKey << '\n'
+                     << fmt::format("{:.21g}\n{:.21g}\n{}\n", state.sum[0], state.sum[1], state.n);
+                if (not file) {
+                    return fmt::format("Cannot write integration cache {}", temporary);
+                }
+            }
+            std::filesystem::rename(temporary, fPath, ec);
+            if (ec) {
+                return fmt::format("Cannot move {} to {} ({})", temporary, fPath, ec.message());
+            }
+            merged = state;
+            return {};
+        }();
+    }
+    // all processes throw together, none is left waiting in Broadcast
+    auto success{error.empty()};
+    MPI_Bcast(&success, sizeof(success), MPI_BYTE, 0, mplr::comm_world().native_handle());
+    if (not success) {
+        Mustard::Throw<std::runtime_error>(mplr::comm_world().rank() == 0 ?
+                                               error :
+                                               fmt::format("Merging integration cache {} failed on rank 0", fPath));
+    }
+    Broadcast(merged);
+    return *merged;
+}
+
+auto PhaseSpaceIntegrationCache::Read() const -> std::optional<Mustard::Math::MCIntegrationState> {
+    std::ifstream file{fPath};
+    if (not file.is_open()) {
+        return {};
+    }
+    std::string key;
+    std::string sum0;
+    std::string sum1;
+    std::string n;
+    if (not std::getline(file, key) or not std::getline(file, sum0) or not std::getline(file, sum1) or not std::getline(file, n)) {
+        Mustard::PrintWarning(fmt::format("Integration cache {} is corrupted, ignoring it", fPath));
+        return {};
+    }
+    if (key != fKey) {
+        Mustard::PrintWarning(fmt::format("Integration cache {} belongs to another configuration (hash collision), ignoring it", fPath));
+        return {};
+    }
+    Mustard::Math::MCIntegrationState state;
+    try {
+        state.sum[0] = std::stold(sum0);
+        state.sum[1] = std::stold(sum1);
+        state.n = std::stold(n);
+    } catch (const std::logic_error&) { // std::invalid_argument or std::out_of_range
+        Mustard::PrintWarning(fmt::format("Integration cache {} is corrupted, ignoring it", fPath));
+        return {};
+    }
+    return state;
+}
+
+} // namespace MACE::inline Utility
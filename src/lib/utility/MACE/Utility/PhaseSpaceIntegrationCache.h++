@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Mustard/Math/MCIntegrationUtility.h++"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace MACE::inline Utility {
+
+/// @brief On-disk store of phase-space integration states, keyed by a text description of
+/// everything that affects the integral (generator type, initial state, cuts, acceptance).
+///
+/// Load() returns the stored state for the key (if any). Merge(initial, final) adds the
+/// samples accumulated in this job (final - initial) to whatever is stored at that time,
+/// under an exclusive file lock, so that many jobs finishing at once never lose samples.
+/// Both are collective over MPI_COMM_WORLD; only rank 0 touches the file system.
+class PhaseSpaceIntegrationCache {
+public:
+    PhaseSpaceIntegrationCache(const std::filesystem::path& directory, std::string key);
+
+    auto Path() const -> const auto& { return fPath; }
+
+    auto Load() const -> std::optional<Mustard::Math::MCIntegrationState>;
+    auto Merge(const Mustard::Math::MCIntegrationState& initial, const Mustard::Math::MCIntegrationState& final) const -> Mustard::Math::MCIntegrationState;
+
+private:
+    auto Read() const -> std::optional<Mustard::Math::MCIntegrationState>;
+
+private:
+    std::filesystem::path fPath;
+    std::string fKey;
+};
+
+} // namespace MACE::inline Utility
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "MACE/Utility/VegasGrid.h++"
+
+#include "Mustard/Env/BasicEnv.h++"
+#include "Mustard/IO/Print.h++"
+#include "Mustard/Math/Estimate.h++"
+
+#include "CLHEP/Random/MixMaxRng.h"
+#include "CLHEP/Random/RandomEngine.h"
+
+#include "mplr/mplr.hpp"
+
+#include "mpi.h"
+
+#include "muc/math"
+
+#include "gsl/gsl"
+
+#include "fmt/core.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MACE::inline Utility {
+
+/// @brief Independent weighted-event generation with an adaptive VEGAS grid.
+///
+/// AIntegrand maps a point of the unit hypercube to {f, event}: f is the density the grid
+/// adapts to (e.g. phase-space weight x |M|^2 x acceptance), and event is a generator event
+/// whose weight is the bias compensation factor, as returned by the MCMC generators.
+/// Sampled events get weight f J / I x (event weight), where I is the VEGAS integral, hence
+/// follow the same normalization convention as the MCMC output.
+///
+/// Points are drawn on nThread worker threads. Each worker evaluates its own copy of the
+/// integrand, hence copies of AIntegrand must not share mutable state. Thread 0 uses the
+/// engine passed at construction, others own an AEngine seeded from it. Adapt() and PrintEfficiency() are
+/// collective over MPI_COMM_WORLD; the grid stays identical on all ranks.
+template<typename AIntegrand, std::derived_from<CLHEP::HepRandomEngine> AEngine = CLHEP::MixMaxRng>
+class VegasEventSampler {
+public:
+    using Event = typename std::invoke_result_t<const AIntegrand&, std::span<const double>>::second_type;
+
+public:
+    VegasEventSampler(AIntegrand integrand, int nDim, int nThread, CLHEP::HepRandomEngine& engine, int nBin = 50);
+
+    auto Grid() const -> const auto& { return fGrid; }
+    /// @brief Integral combined over adaptation iterations (inverse-variance weighted).
+    auto Integral() const -> const auto& { return fIntegral; }
+    /// @brief Largest f J seen in the last adaptation iteration over all ranks.
+    auto MaxWeight() const -> auto { return fMaxWeight; }
+
+    /// @brief Run nIteration rounds of nSample points (over all ranks), refining the grid after each.
+    auto Adapt(int nIteration, unsigned long long nSample, double alpha = 1.5) -> Mustard::Math::Estimate;
+    /// @brief Draw n points and hand the resulting events with their weights to Consume(weight, event)
+    /// on the calling thread. Points with f J below referenceWeight are kept with probability
+    /// f J / referenceWeight and raised to it (partial unweighting; 0 keeps every nonzero point).
+    template<std::invocable<double, const Event&> AConsumer>
+    auto Sample(unsigned long long n, double referenceWeight, AConsumer&& Consume) -> void;
+    /// @brief Print unweighting and Kish effective-sample-size efficiencies of Sample() so far.
+    auto PrintEfficiency() const -> void;
+
+private:
+    struct Worker {
+        AIntegrand integrand;
+        std::unique_ptr<AEngine> ownedEngine;
+        CLHEP::HepRandomEngine* engine;
+        std::vector<double> accumulator;
+        std::vector<std::pair<double, Event>> buffer;
+        /// n, sum f J, sum (f J)^2, max f J
+        std::array<double, 4> moment;
+        /// n trial, n kept, sum weight, sum weight^2
+        std::array<double, 4> efficiency;
+    };
+
+private:
+    auto Draw(Worker& worker, std::span<double> u, std::span<double> x, std::span<int> bin) const -> std::pair<double, Event>;
+    auto ForEachWorker(const std::function<void(Worker&, gsl::index)>& Task) -> void;
+    static auto Split(unsigned long long n, int nPart, gsl::index i) -> unsigned long long { return n / nPart + (static_cast<unsigned long long>(i) < n % nPart); }
+
+private:
+    VegasGrid fGrid;
+    std::vector<Worker> fWorker;
+    Mustard::Math::Estimate fIntegral;
+    double fMaxWeight;
+};
+
+} // namespace MACE::inline Utility
+
+#include "MACE/Utility/VegasEventSampler.inl"
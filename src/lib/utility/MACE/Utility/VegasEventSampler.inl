@@ -0,0 +1,188 @@
+namespace MACE::inline Utility {
+
+template<typename AIntegrand, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+VegasEventSampler<AIntegrand, AEngine>::VegasEventSampler(AIntegrand integrand, int nDim, int nThread, CLHEP::HepRandomEngine& engine, int nBin) :
+    fGrid{nDim, nBin},
+    fWorker{},
+    fIntegral{},
+    fMaxWeight{} {
+    Expects(nThread >= 1);
+    fWorker.reserve(nThread);
+    for (int i{}; i < nThread; ++i) {
+        auto& worker{fWorker.emplace_back(Worker{.integrand = integrand,
+                                                 .ownedEngine = nullptr,
+                                                 .engine = &engine,
+                                                 .accumulator = fGrid.NewAccumulator(),
+                                                 .buffer = {},
+                                                 .moment = {},
+                                                 .efficiency = {}})};
+        if (i == 0) {
+            continue;
+        }
+        const auto seed{static_cast<unsigned long long>(static_cast<unsigned>(engine)) << 32 | static_cast<unsigned>(engine)};
+        worker.ownedEngine = std::make_unique<AEngine>(static_cast<long>(seed >> 1));
+        worker.engine = worker.ownedEngine.get();
+    }
+}
+
+template<typename AIntegrand, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto VegasEventSampler<AIntegrand, AEngine>::Adapt(int nIteration, unsigned long long nSample, double alpha) -> Mustard::Math::Estimate {
+    Expects(nIteration >= 1);
+    const auto& worldComm{mplr::comm_world()};
+    const auto nLocalSample{Split(nSample, worldComm.size(), worldComm.rank())};
+
+    auto accumulator{fGrid.NewAccumulator()};
+    double sumWeightedValue{};
+    double sumInverseVariance{};
+    double sumChi2Term{};
+    std::vector<double> iterationValue;
+    std::vector<double> iterationVariance;
+    for (int iteration{}; iteration < nIteration; ++iteration) {
+        ForEachWorker([&](Worker& worker, gsl::index i) {
+            std::ranges::fill(worker.accumulator, 0);
+            worker.moment = {};
+            std::vector<double> u(fGrid.NDim());
+            std::vector<double> x(fGrid.NDim());
+            std::vector<int> bin(fGrid.NDim());
+            auto& [n, sum, sum2, max]{worker.moment};
+            for (auto k{Split(nLocalSample, std::ssize(fWorker), i)}; k > 0; --k) {
+                const auto fJ{Draw(worker, u, x, bin).first};
+                fGrid.Accumulate(worker.accumulator, bin, fJ * fJ);
+                n += 1;
+                sum += fJ;
+                sum2 += fJ * fJ;
+                max = std::max(max, fJ);
+            }
+        });
+
+        // combine threads, then ranks
+        std::ranges::fill(accumulator, 0);
+        std::array<double, 3> moment{};
+        double max{};
+        for (auto&& worker : fWorker) {
+            std::ranges::transform(accumulator, worker.accumulator, accumulator.begin(), std::plus{});
+            std::ranges::transform(moment, std::span{worker.moment}.template first<3>(), moment.begin(), std::plus{});
+            max = std::max(max, worker.moment[3]);
+        }
+        MPI_Allreduce(MPI_IN_PLACE, accumulator.data(), accumulator.size(), MPI_DOUBLE, MPI_SUM, worldComm.native_handle());
+        MPI_Allreduce(MPI_IN_PLACE, moment.data(), moment.size(), MPI_DOUBLE, MPI_SUM, worldComm.native_handle());
+        MPI_Allreduce(MPI_IN_PLACE, &max, 1, MPI_DOUBLE, MPI_MAX, worldComm.native_handle());
+
+        const auto& [n, sum, sum2]{moment};
+        const auto value{sum / n};
+        const auto variance{(sum2 / n - value * value) / (n - 1)};
+        iterationValue.emplace_back(value);
+        iterationVariance.emplace_back(variance);
+        // the first iteration runs on an untrained grid, leave it out of the average if there are others
+        if ((iteration > 0 or nIteration == 1) and variance > 0) {
+            sumWeightedValue += value / variance;
+            sumInverseVariance += 1 / variance;
+        }
+        fIntegral.value = sumWeightedValue / sumInverseVariance;
+        fIntegral.uncertainty = 1 / std::sqrt(sumInverseVariance);
+        fMaxWeight = max;
+        if (Mustard::Env::VerboseLevelReach<'I'>()) {
+            Mustard::MasterPrintLn("VEGAS iteration {}: {} +/- {} (rel. unc.: {:.3}%), <fJ>/max(fJ) = {:.3}%",
+                                   iteration, value, std::sqrt(variance), std::sqrt(variance) / value * 100, value / max * 100);
+        }
+        // keep the grid of the last iteration, so that MaxWeight() refers to the grid used for sampling
+        if (iteration + 1 < nIteration) {
+            fGrid.Refine(accumulator, alpha);
+        }
+    }
+
+    if (nIteration > 2) {
+        for (int iteration{1}; iteration < nIteration; ++iteration) {
+            sumChi2Term += muc::pow(iterationValue[iteration] - fIntegral.value, 2) / iterationVariance[iteration];
+        }
+        Mustard::MasterPrintLn("VEGAS integral: {} +/- {} (rel. unc.: {:.3}%, chi2/dof: {:.2f})",
+                               fIntegral.value, fIntegral.uncertainty, fIntegral.uncertainty / fIntegral.value * 100,
+                               sumChi2Term / (nIteration - 2));
+    } else {
+        Mustard::MasterPrintLn("VEGAS integral: {} +/- {} (rel. unc.: {:.3}%)",
+                               fIntegral.value, fIntegral.uncertainty, fIntegral.uncertainty / fIntegral.value * 100);
+    }
+    return fIntegral;
+}
+
+template<typename AIntegrand, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+template<std::invocable<double, const typename VegasEventSampler<AIntegrand, AEngine>::Event&> AConsumer>
+auto VegasEventSampler<AIntegrand, AEngine>::Sample(unsigned long long n, double referenceWeight, AConsumer&& Consume) -> void {
+    ForEachWorker([&](Worker& worker, gsl::index i) {
+        worker.buffer.clear();
+        std::vector<double> u(fGrid.NDim());
+        std::vector<double> x(fGrid.NDim());
+        std::vector<int> bin(fGrid.NDim());
+        auto& [nTrial, nKept, sumWeight, sumWeight2]{worker.efficiency};
+        for (auto k{Split(n, std::ssize(fWorker), i)}; k > 0; --k) {
+            auto [fJ, event]{Draw(worker, u, x, bin)};
+            nTrial += 1;
+            if (not(fJ > 0)) {
+                continue;
+            }
+            if (fJ < referenceWeight) {
+                if (worker.engine->flat() * referenceWeight > fJ) {
+                    continue;
+                }
+                fJ = referenceWeight;
+            }
+            const auto weight{fJ / fIntegral.value};
+            nKept += 1;
+            sumWeight += weight;
+            sumWeight2 += weight * weight;
+            worker.buffer.emplace_back(weight, std::move(event));
+        }
+    });
+    for (auto&& worker : fWorker) {
+        for (auto&& [weight, event] : worker.buffer) {
+            Consume(weight, event);
+        }
+    }
+}
+
+template<typename AIntegrand, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto VegasEventSampler<AIntegrand, AEngine>::PrintEfficiency() const -> void {
+    std::array<double, 4> efficiency{};
+    for (auto&& worker : fWorker) {
+        std::ranges::transform(efficiency, worker.efficiency, efficiency.begin(), std::plus{});
+    }
+    const auto& worldComm{mplr::comm_world()};
+    worldComm.reduce(
+        [](const std::array<double, 4>& a, const std::array<double, 4>& b) {
+            std::array<double, 4> c;
+            std::ranges::transform(a, b, c.begin(), std::plus{});
+            return c;
+        },
+        0, efficiency);
+    if (worldComm.rank() != 0) {
+        return;
+    }
+    const auto& [nTrial, nKept, sumWeight, sumWeight2]{efficiency};
+    const auto ess{sumWeight * sumWeight / sumWeight2};
+    Mustard::MasterPrintLn("VEGAS sampling: {} point(s), {} event(s) kept ({:.3}%), Kish ESS = {:.1f} ({:.3}% per point), "
+                           "full unweighting efficiency <fJ>/max(fJ) = {:.3}%",
+                           nTrial, nKept, nKept / nTrial * 100, ess, ess / nTrial * 100, fIntegral.value / fMaxWeight * 100);
+}
+
+template<typename AIntegrand, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto VegasEventSampler<AIntegrand, AEngine>::Draw(Worker& worker, std::span<double> u, std::span<double> x, std::span<int> bin) const -> std::pair<double, Event> {
+    worker.engine->flatArray(u.size(), u.data());
+    const auto jacobian{fGrid.Map(u, x, bin)};
+    auto [f, event]{worker.integrand(x)};
+    return {f * jacobian, std::move(event)};
+}
+
+template<typename AIntegrand, std::derived_from<CLHEP::HepRandomEngine> AEngine>
+auto VegasEventSampler<AIntegrand, AEngine>::ForEachWorker(const std::function<void(Worker&, gsl::index)>& Task) -> void {
+    if (fWorker.size() == 1) {
+        Task(fWorker.front(), 0);
+        return;
+    }
+    std::vector<std::jthread> thread;
+    thread.reserve(fWorker.size());
+    for (gsl::index i{}; i < std::ssize(fWorker); ++i) {
+        thread.emplace_back(Task, std::ref(fWorker[i]), i);
+    }
+}
+
+} // namespace MACE::inline Utility
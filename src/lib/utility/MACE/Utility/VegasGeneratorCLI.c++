@@ -0,0 +1,59 @@
+#include "MACE/Utility/VegasGeneratorCLI.h++"
+
+#include "Mustard/CLI/CLI.h++"
+
+namespace MACE::inline Utility {
+
+VegasGeneratorCLIModule::VegasGeneratorCLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli) :
+    ModuleBase{cli} {
+    TheCLI()
+        ->add_argument("--vegas")
+        .help("Generate independent weighted events from an adapted VEGAS grid instead of MCMC. "
+              "The number of events then counts sampled points, of which those rejected by --vegas-unweighting-ratio are not written.")
+        .flag();
+    TheCLI()
+        ->add_argument("--vegas-iteration")
+        .help("Number of VEGAS grid adaptation iterations.")
+        .default_value(10)
+        .required()
+        .nargs(1)
+        .scan<'i', int>();
+    TheCLI()
+        ->add_argument("--vegas-sample")
+        .help("Number of samples per VEGAS adaptation iteration (over all processes).")
+        .default_value(1'000'000ull)
+        .required()
+        .nargs(1)
+        .scan<'i', unsigned long long>();
+    TheCLI()
+        ->add_argument("--vegas-bin")
+        .help("Number of VEGAS grid bins per dimension.")
+        .default_value(50)
+        .required()
+        .nargs(1)
+        .scan<'i', int>();
+    TheCLI()
+        ->add_argument("--vegas-alpha")
+        .help("VEGAS grid adaptation damping exponent (0 freezes the grid, larger adapts faster).")
+        .default_value(1.5)
+        .required()
+        .nargs(1)
+        .scan<'g', double>();
+    TheCLI()
+        ->add_argument("--vegas-unweighting-ratio")
+        .help("Partial unweighting: events with weight below this fraction of the maximum weight are accepted or rejected "
+              "with probability proportional to their weight. 0 keeps every weighted event, 1 unweights fully.")
+        .default_value(0.)
+        .required()
+        .nargs(1)
+        .scan<'g', double>();
+    TheCLI()
+        ->add_argument("--vegas-n-thread")
+        .help("Number of threads per process drawing VEGAS points.")
+        .default_value(1)
+        .required()
+        .nargs(1)
+        .scan<'i', int>();
+}
+
+} // namespace MACE::inline Utility
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "Mustard/CLI/Module/ModuleBase.h++"
+
+namespace MACE::inline Utility {
+
+class VegasGeneratorCLIModule : public Mustard::CLI::ModuleBase {
+public:
+    VegasGeneratorCLIModule(gsl::not_null<Mustard::CLI::CLI<>*> cli);
+};
+
+} // namespace MACE::inline Utility
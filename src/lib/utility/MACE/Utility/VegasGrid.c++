@@ -0,0 +1,84 @@
+#include "MACE/Utility/VegasGrid.h++"
+
+#include "gsl/gsl"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace MACE::inline Utility {
+
+VegasGrid::VegasGrid(int nDim, int nBin) :
+    fNDim{nDim},
+    fNBin{nBin},
+    fEdge((nBin + 1) * nDim) {
+    Expects(nDim >= 1);
+    Expects(nBin >= 2);
+    for (int d{}; d < fNDim; ++d) {
+        for (int k{}; k <= fNBin; ++k) {
+            fEdge[d * (fNBin + 1) + k] = static_cast<double>(k) / fNBin;
+        }
+    }
+}
+
+auto VegasGrid::Map(std::span<const double> u, std::span<double> x, std::span<int> bin) const -> double {
+    Expects(std::ssize(u) == fNDim and std::ssize(x) == fNDim and std::ssize(bin) == fNDim);
+    double jacobian{1};
+    for (int d{}; d < fNDim; ++d) {
+        const auto y{u[d] * fNBin};
+        const auto k{std::min(static_cast<int>(y), fNBin - 1)};
+        const auto* const edge{&fEdge[d * (fNBin + 1) + k]};
+        const auto width{edge[1] - edge[0]};
+        x[d] = edge[0] + (y - k) * width;
+        bin[d] = k;
+        jacobian *= fNBin * width;
+    }
+    return jacobian;
+}
+
+auto VegasGrid::Accumulate(std::span<double> accumulator, std::span<const int> bin, double fJ2) const -> void {
+    for (int d{}; d < fNDim; ++d) {
+        accumulator[d * fNBin + bin[d]] += fJ2;
+    }
+}
+
+auto VegasGrid::Refine(std::span<const double> accumulator, double alpha) -> void {
+    Expects(std::ssize(accumulator) == fNDim * fNBin);
+    std::vector<double> smoothed(fNBin);
+    std::vector<double> importance(fNBin);
+    std::vector<double> newEdge(fNBin + 1);
+    for (int d{}; d < fNDim; ++d) {
+        const auto* const a{&accumulator[d * fNBin]};
+        // smooth over neighbouring bins and normalize
+        smoothed.front() = (a[0] + a[1]) / 2;
+        for (int k{1}; k < fNBin - 1; ++k) {
+            smoothed[k] = (a[k - 1] + a[k] + a[k + 1]) / 3;
+        }
+        smoothed.back() = (a[fNBin - 2] + a[fNBin - 1]) / 2;
+        const auto sum{std::reduce(smoothed.cbegin(), smoothed.cend())};
+        if (not(sum > 0)) {
+            continue; // nothing seen in this dimension, keep the grid
+        }
+        // damped importance of each bin
+        for (int k{}; k < fNBin; ++k) {
+            const auto r{smoothed[k] / sum};
+            importance[k] = r > 0 and r < 1 ? std::pow((1 - r) / std::log(1 / r), alpha) : (r >= 1 ? 1 : 0);
+        }
+        const auto perBin{std::reduce(importance.cbegin(), importance.cend()) / fNBin};
+        // redistribute edges so that every new bin holds the same importance
+        auto* const edge{&fEdge[d * (fNBin + 1)]};
+        newEdge.front() = 0;
+        newEdge.back() = 1;
+        double carried{};
+        for (int i{1}, k{}; i < fNBin; ++i) {
+            while (carried < perBin and k < fNBin) {
+                carried += importance[k++];
+            }
+            carried -= perBin;
+            newEdge[i] = edge[k] - (edge[k] - edge[k - 1]) * carried / importance[k - 1];
+        }
+        std::ranges::copy(newEdge, edge);
+    }
+}
+
+} // namespace MACE::inline Utility
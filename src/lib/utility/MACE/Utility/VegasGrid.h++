@@ -0,0 +1,38 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+namespace MACE::inline Utility {
+
+/// @brief Factorized VEGAS grid over the unit hypercube.
+///
+/// Every dimension is split into NBin() bins of equal probability but adaptive width.
+/// Map() sends a uniform point u to x and returns the Jacobian dx/du, so that
+/// E[f(x) J] = integral of f. Refine() moves the bin edges so that each bin carries
+/// an equal share of the accumulated (f J)^2 (Lepage's algorithm).
+class VegasGrid {
+public:
+    VegasGrid(int nDim, int nBin = 50);
+
+    auto NDim() const -> auto { return fNDim; }
+    auto NBin() const -> auto { return fNBin; }
+    /// @brief Bin edges, NBin() + 1 per dimension.
+    auto Edge() const -> const auto& { return fEdge; }
+
+    /// @brief Map u to x, store the bin index of each dimension in bin, and return the Jacobian.
+    auto Map(std::span<const double> u, std::span<double> x, std::span<int> bin) const -> double;
+
+    /// @brief An empty (f J)^2 accumulator, NBin() per dimension.
+    auto NewAccumulator() const -> std::vector<double> { return std::vector<double>(fNDim * fNBin); }
+    auto Accumulate(std::span<double> accumulator, std::span<const int> bin, double fJ2) const -> void;
+    /// @brief Adapt the edges to the accumulated importance. alpha controls the damping (0 = no adaptation).
+    auto Refine(std::span<const double> accumulator, double alpha = 1.5) -> void;
+
+private:
+    int fNDim;
+    int fNBin;
+    std::vector<double> fEdge;
+};
+
+} // namespace MACE::inline Utility
@@ -55,6 +55,10 @@ parexec() {
     fi
 }
 
+echo "Running unit checks..."
+run_command $script_dir/TestEventWeight
+run_command $script_dir/TestTargetPerforation
+
 echo "Start simulation..."
 run_command parexec $build_dir/MACE SimMMS --seed 0 $build_dir/SimMMS/run_em_flat.mac
 run_command parexec $build_dir/MACE SimTTC --seed 0 $build_dir/SimTTC/run_em_flat.mac
@@ -0,0 +1,42 @@
+#include "MACE/Analysis/EventJoiner.h++"
+
+#include "Mustard/Data/Tuple.h++"
+
+#include "fmt/core.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+// An N-particle vertex with weight w gives the event weight w, and independent primaries
+// (pile-up, distinct PrmID) multiply.
+auto main() -> int {
+    using MACE::Analysis::EventJoiner;
+    using Row = Mustard::Data::Tuple<EventJoiner::PrimaryWeight>;
+
+    const auto Vertex{[](std::vector<std::shared_ptr<Row>>& primary, int prmID, int nParticle, float w) {
+        for (int i{}; i < nParticle; ++i) {
+            const auto& row{primary.emplace_back(std::make_shared<Row>())};
+            Get<"EvtID">(*row) = 0;
+            Get<"PrmID">(*row) = prmID;
+            Get<"w">(*row) = w;
+        }
+    }};
+
+    auto failed{false};
+    const auto Check{[&](const char* name, double weight, double expected) {
+        const auto pass{std::abs(weight - expected) <= 1e-6 * std::abs(expected)};
+        fmt::println("{:<32} {:>12.6g} (expected {:.6g}) {}", name, weight, expected, pass ? "PASSED" : "FAILED");
+        failed |= not pass;
+    }};
+
+    std::vector<std::shared_ptr<Row>> primary;
+    Check("No primary", EventJoiner::EventWeight(primary), 1);
+    Vertex(primary, 0, 3, 0.25f);
+    Check("3-particle vertex", EventJoiner::EventWeight(primary), 0.25);
+    Vertex(primary, 1, 5, 0.5f);
+    Check("Pile-up of 2 vertices", EventJoiner::EventWeight(primary), 0.25 * 0.5);
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
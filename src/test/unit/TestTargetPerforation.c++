@@ -0,0 +1,156 @@
+#include "MACE/Detector/Description/Target.h++"
+
+#include "Mustard/CLI/BasicCLI.h++"
+#include "Mustard/Env/BasicEnv.h++"
+
+#include "muc/array"
+#include "muc/math"
+
+#include "fmt/core.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace {
+
+using MACE::Detector::Description::Target;
+
+// Perforation tests as they were before the branch-free rewrite, kept as the reference
+
+auto ReferenceDetailContain(const Target::CuboidTarget& cuboid, const muc::array3d& x) -> bool {
+    const auto& perforated{cuboid.Perforated()};
+    const auto x1{cuboid.CosTiltAngle() * x[0] + cuboid.SinTiltAngle() * x[2]};
+    const auto y1{x[1]};
+    const auto z1{-cuboid.SinTiltAngle() * x[0] + cuboid.CosTiltAngle() * x[2]};
+    if (z1 < -perforated.Depth() or std::abs(x1) > perforated.WidthExtent() / 2 or std::abs(y1) > perforated.HeightExtent() / 2) {
+        return true;
+    }
+    using std::numbers::sqrt3;
+    const auto p{perforated.Spacing() + perforated.Diameter()};
+
+    const auto u0{p * muc::llround((x1 - (1 / sqrt3) * y1) / p)};
+    const auto v0{p * muc::llround((2 / sqrt3) * y1 / p)};
+    const auto x0{u0 + v0 / 2};
+    const auto y0{(sqrt3 / 2) * v0};
+
+    const auto deltaX{x1 - x0};
+    const auto deltaY{y1 - y0};
+    const auto radius{perforated.Diameter() / 2};
+    const auto deltaXY2MinusR2{muc::pow(deltaX, 2) + (deltaY + radius) * (deltaY - radius)};
+
+    if (deltaXY2MinusR2 <= 0) {
+        return false;
+    }
+    const auto deltaXY2MinusR2PlusP2{deltaXY2MinusR2 + muc::pow(p, 2)};
+    const auto pDeltaX{p * deltaX};
+    return deltaXY2MinusR2PlusP2 > std::abs(2 * pDeltaX) and
+           deltaXY2MinusR2PlusP2 > std::abs(pDeltaX + sqrt3 * p * deltaY);
+}
+
+auto ReferenceDetailContain(const Target::MultiLayerTarget& multiLayer, const muc::array3d& x) -> bool {
+    const auto& perforated{multiLayer.Perforated()};
+    if (std::abs(x[2]) > perforated.HalfExtentZ() or std::abs(x[1]) > perforated.HalfExtentY()) {
+        return true;
+    }
+    using std::numbers::sqrt3;
+    const auto p{perforated.Pitch()};
+
+    const auto u0{p * muc::llround((x[2] - (1 / sqrt3) * x[1]) / p)};
+    const auto v0{p * muc::llround((2 / sqrt3) * x[1] / p)};
+    const auto z0{u0 + v0 / 2};
+    const auto y0{(sqrt3 / 2) * v0};
+
+    const auto deltaZ{x[2] - z0};
+    const auto deltaY{x[1] - y0};
+    const auto radius{perforated.Radius()};
+    const auto deltaZY2MinusR2{muc::pow(deltaZ, 2) + (deltaY + radius) * (deltaY - radius)};
+
+    if (deltaZY2MinusR2 <= 0) {
+        return false;
+    }
+    const auto deltaZY2MinusR2PlusP2{deltaZY2MinusR2 + muc::pow(p, 2)};
+    const auto pDeltaZ{p * deltaZ};
+    return deltaZY2MinusR2PlusP2 > std::abs(2 * pDeltaZ) and
+           deltaZY2MinusR2PlusP2 > std::abs(pDeltaZ + sqrt3 * p * deltaY);
+}
+
+} // namespace
+
+// Random points over and around the perforated region: the new DetailContain agrees with the
+// reference, and the batched (SoA) Contain agrees with the scalar one.
+auto main(int argc, char* argv[]) -> int {
+    Mustard::CLI::BasicCLI<> cli;
+    Mustard::Env::BasicEnv env{argc, argv, cli};
+
+    auto& target{Target::Instance()};
+    auto& cuboid{target.Cuboid()};
+    cuboid.TiltAngle(0.3);
+    cuboid.DetailType(Target::CuboidTarget::ShapeDetailType::Perforated);
+    auto& multiLayer{target.MultiLayer()};
+    multiLayer.DetailType(Target::MultiLayerTarget::ShapeDetailType::Perforated);
+
+    constexpr auto nPoint{1'000'000};
+    std::mt19937_64 random{20261019};
+    const auto Points{[&](double halfX, double halfY, double halfZ) {
+        std::uniform_real_distribution<double> x{-halfX, halfX};
+        std::uniform_real_distribution<double> y{-halfY, halfY};
+        std::uniform_real_distribution<double> z{-halfZ, halfZ};
+        std::vector<muc::array3d> point(nPoint);
+        for (auto&& p : point) {
+            p = {x(random), y(random), z(random)};
+        }
+        return point;
+    }};
+
+    auto failed{false};
+    const auto Check{[&](const char* name, long long nMismatch) {
+        fmt::println("{:<40} {:>8} mismatch(es) in {} point(s) {}", name, nMismatch, nPoint, nMismatch == 0 ? "PASSED" : "FAILED");
+        failed |= nMismatch != 0;
+    }};
+
+    {
+        const auto& perforated{cuboid.Perforated()};
+        const auto point{Points(0.6 * perforated.WidthExtent(), 0.6 * perforated.HeightExtent(), 2 * perforated.Depth() + cuboid.Thickness())};
+        long long nMismatch{};
+        for (auto&& x : point) {
+            nMismatch += perforated.DetailContain(x) != ReferenceDetailContain(cuboid, x);
+        }
+        Check("Cuboid DetailContain vs reference", nMismatch);
+    }
+    {
+        const auto& perforated{multiLayer.Perforated()};
+        const auto point{Points(multiLayer.Count() * (multiLayer.Spacing() + multiLayer.Thickness()),
+                                1.2 * perforated.HalfExtentY(), 1.2 * perforated.HalfExtentZ())};
+        long long nMismatch{};
+        for (auto&& x : point) {
+            nMismatch += perforated.DetailContain(x) != ReferenceDetailContain(multiLayer, x);
+        }
+        Check("MultiLayer DetailContain vs reference", nMismatch);
+    }
+
+    for (auto shape : {Target::TargetShapeType::Cuboid, Target::TargetShapeType::MultiLayer, Target::TargetShapeType::Cylinder}) {
+        target.ShapeType(shape);
+        const auto point{Points(50, 50, 50)};
+        std::vector<double> x(nPoint);
+        std::vector<double> y(nPoint);
+        std::vector<double> z(nPoint);
+        for (int i{}; i < nPoint; ++i) {
+            x[i] = point[i][0];
+            y[i] = point[i][1];
+            z[i] = point[i][2];
+        }
+        const auto contain{std::make_unique<bool[]>(nPoint)};
+        target.Contain(x, y, z, {contain.get(), nPoint});
+        long long nMismatch{};
+        for (int i{}; i < nPoint; ++i) {
+            nMismatch += contain[i] != target.Contain(point[i]);
+        }
+        Check(fmt::format("{} batched vs scalar Contain", target.ShapeTypeString()).c_str(), nMismatch);
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}